@@ -0,0 +1,755 @@
+//  --------------------------------------------
+//  data_l_bench: core operations of every container, next to the std ones
+//
+//  for each element type, size and container, every operation the
+//  container supports is timed on its own:
+//
+//      push, emplace       fill an empty container with `size` elements
+//      pop                 empty a full one, element by element
+//      insert_at, erase_at `probes` random positions of a full container
+//      find                `probes` random keys, all present
+//      erase               `probes` distinct keys, all present
+//      copy                copy construction of a full container
+//      clear               clear(), or the destructor when there is none
+//      iterate             one pass over a full container
+//
+//  the container is built outside the clock, the timing is divided by
+//  the elements ( or probes ) touched, and each case is repeated; the
+//  median and the minimum ns per element are reported. input comes from
+//  a fixed seed, so two runs of one binary time the same work.
+//
+//  probes that walk the container are capped so one repetition stays
+//  near 2e7 element visits; the op count is part of every record.
+//
+//  results go out as JSON ( stdout, or --out ), progress to stderr.
+//
+//  usage: data_l_bench [--sizes 1e3,1e4,1e5,1e6] [--types int,string]
+//                      [--reps 5] [--probes 1000] [--seed 42]
+//                      [--filter text] [--out file.json]
+//  --------------------------------------------
+
+#include <ds/b_tree.hxx>
+#include <ds/binary_search_tree.hxx>
+#include <ds/chunked_stack.hxx>
+#include <ds/concurrent_stack.hxx>
+#include <ds/forward_list.hxx>
+#include <ds/indexed_list.hxx>
+#include <ds/list.hxx>
+#include <ds/mpmc_queue.hxx>
+#include <ds/persistent_search_tree.hxx>
+#include <ds/queue.hxx>
+#include <ds/ring_queue.hxx>
+#include <ds/spsc_queue.hxx>
+#include <ds/stack.hxx>
+#include <ds/static_search_set.hxx>
+#include <ds/unrolled_forward_list.hxx>
+#include <ds/work_stealing_deque.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <deque>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace
+{
+    using clock_type = std::chrono::steady_clock;
+
+    /** element visits one repetition of a walking probe is allowed **/
+    constexpr std::size_t walk_budget = 20'000'000ul;
+
+
+    struct options
+    {
+        std::vector<std::size_t> m_sizes  {1'000ul, 10'000ul, 100'000ul, 1'000'000ul};
+        std::vector<std::string> m_types  {"int", "string"};
+        std::size_t              m_reps   {5ul};
+        std::size_t              m_probes {1'000ul};
+        std::uint64_t            m_seed   {42ull};
+        std::string              m_filter {};
+        std::string              m_out    {};
+    };
+
+
+    struct record
+    {
+        std::string m_name;
+        std::string m_container;
+        std::string m_type;
+        std::string m_operation;
+        std::size_t m_size;
+        std::size_t m_ops;
+        std::size_t m_reps;
+        double      m_median;
+        double      m_min;
+    };
+
+
+    std::vector<record> g_records;
+
+    /** everything read back from a container ends up here, so no loop is dead **/
+    volatile std::size_t g_sink {};
+
+
+
+    /** ELEMENT TYPES **/
+
+    template <class T> constexpr char const* type_name = "";
+    template <> constexpr char const* type_name<int>         = "int";
+    template <> constexpr char const* type_name<std::string> = "std::string";
+
+
+    template <class T> auto make_value(std::size_t) -> T;
+
+    template <> auto make_value<int>(std::size_t p_key) -> int
+    {
+        return static_cast<int>(p_key);
+    }
+
+    /** 24 characters, past the small string buffer, so every copy allocates **/
+    template <> auto make_value<std::string>(std::size_t p_key) -> std::string
+    {
+        char v_buffer[32];
+
+        std::snprintf(v_buffer, sizeof(v_buffer), "key:%020zu", p_key);
+
+        return v_buffer;
+    }
+
+
+    auto digest(int p_value) -> std::size_t
+    {
+        return static_cast<std::size_t>(p_value);
+    }
+
+    auto digest(std::string const& p_value) -> std::size_t
+    {
+        return p_value.size() + static_cast<unsigned char>(p_value.back());
+    }
+
+
+    /** `size` DISTINCT KEYS IN A SHUFFLED ORDER **/
+    template <class T>
+    auto make_input(std::size_t p_size, std::uint64_t p_seed) -> std::vector<T>
+    {
+        std::vector<std::size_t> v_keys(p_size);
+
+        std::iota(v_keys.begin(), v_keys.end(), 0ul);
+        std::shuffle(v_keys.begin(), v_keys.end(), std::mt19937_64 {p_seed ^ p_size});
+
+        std::vector<T> v_values;
+        v_values.reserve(p_size);
+
+        for (std::size_t v_key : v_keys) v_values.push_back(make_value<T>(v_key));
+
+        return v_values;
+    }
+
+
+
+    /** CONTAINER TRAITS **/
+
+    /** takes a capacity at construction and never grows past it **/
+    template <class C> constexpr bool bounded = false;
+    template <class T> constexpr bool bounded<spsc_queue<T>> = true;
+    template <class T> constexpr bool bounded<mpmc_queue<T>> = true;
+
+    /** ordered by key, so find and erase do not walk **/
+    template <class C> constexpr bool associative = false;
+    template <class T>                    constexpr bool associative<std::set<T>>                   = true;
+    template <class T, class B, class A>  constexpr bool associative<binary_search_tree<T, B, A>>   = true;
+    template <class T, class A>           constexpr bool associative<b_tree<T, A>>                  = true;
+    template <class T>                    constexpr bool associative<persistent_search_tree<T>>     = true;
+    template <class T>                    constexpr bool associative<static_search_set<T>>          = true;
+
+
+    template <class C>
+    auto make_empty(std::size_t p_size) -> std::unique_ptr<C>
+    {
+        if constexpr (bounded<C>) return std::make_unique<C>(p_size + 1ul);
+        else                      return std::make_unique<C>();
+    }
+
+
+
+    /** OPERATIONS ( each container through the member it has ) **/
+
+    template <class C, class T>
+    concept puttable = requires(C& c, T const& v) { c.push_back(v); } ||
+                       requires(C& c, T const& v) { c.push(v); } ||
+                       requires(C& c, T const& v) { c.try_push(v); } ||
+                       requires(C& c, T const& v) { c.push_front(v); } ||
+                       requires(C& c, T const& v) { c.insert(v); };
+
+    template <class C, class T>
+    void put(C& p_container, T const& p_value)
+    {
+        if constexpr      (requires { p_container.push_back(p_value); })  p_container.push_back(p_value);
+        else if constexpr (requires { p_container.push(p_value); })       static_cast<void>(p_container.push(p_value));
+        else if constexpr (requires { p_container.try_push(p_value); })   static_cast<void>(p_container.try_push(p_value));
+        else if constexpr (requires { p_container.push_front(p_value); }) p_container.push_front(p_value);
+        else                                                             p_container.insert(p_value);
+    }
+
+
+    template <class C, class T>
+    concept emplaceable = requires(C& c, T const& v) { c.emplace_back(v); } ||
+                          requires(C& c, T const& v) { c.emplace(v); } ||
+                          requires(C& c, T const& v) { c.emplace_front(v); };
+
+    template <class C, class T>
+    void place(C& p_container, T const& p_value)
+    {
+        if constexpr      (requires { p_container.emplace_back(p_value); }) p_container.emplace_back(p_value);
+        else if constexpr (requires { p_container.emplace(p_value); })      static_cast<void>(p_container.emplace(p_value));
+        else                                                               p_container.emplace_front(p_value);
+    }
+
+
+    template <class C>
+    concept takeable = requires(C& c) { c.pop_front(); } ||
+                       requires(C& c) { c.try_pop(); } ||
+                       requires(C& c) { c.pop(); } ||
+                       requires(C& c) { c.pop_back(); };
+
+    template <class C>
+    void take(C& p_container)
+    {
+        if constexpr      (requires { p_container.pop_front(); }) p_container.pop_front();
+        else if constexpr (requires { p_container.try_pop(); })   static_cast<void>(p_container.try_pop());
+        else if constexpr (requires { p_container.pop(); })       static_cast<void>(p_container.pop());
+        else                                                     p_container.pop_back();
+    }
+
+
+    /** THE NEW ELEMENT BECOMES ELEMENT `pos` **/
+    template <class T>
+    void insert_at(std::vector<T>& p_container, std::size_t p_pos, T const& p_value)
+    {
+        p_container.insert(p_container.begin() + static_cast<std::ptrdiff_t>(p_pos), p_value);
+    }
+
+    template <class T>
+    void insert_at(std::deque<T>& p_container, std::size_t p_pos, T const& p_value)
+    {
+        p_container.insert(p_container.begin() + static_cast<std::ptrdiff_t>(p_pos), p_value);
+    }
+
+    template <class T>
+    void insert_at(std::list<T>& p_container, std::size_t p_pos, T const& p_value)
+    {
+        p_container.insert(std::next(p_container.begin(), static_cast<std::ptrdiff_t>(p_pos)), p_value);
+    }
+
+    template <class T>
+    void insert_at(std::forward_list<T>& p_container, std::size_t p_pos, T const& p_value)
+    {
+        p_container.insert_after(std::next(p_container.before_begin(), static_cast<std::ptrdiff_t>(p_pos)), p_value);
+    }
+
+    template <class T, class A>
+    void insert_at(list<T, A>& p_container, std::size_t p_pos, T const& p_value)
+    {
+        if (p_pos == 0ul) p_container.push_front(p_value);
+        else              p_container.push_after(p_value, p_pos - 1ul);
+    }
+
+    template <class T, class A>
+    void insert_at(forward_list<T, A>& p_container, std::size_t p_pos, T const& p_value)
+    {
+        if (p_pos == 0ul) p_container.push_front(p_value);
+        else              p_container.push_after(p_value, p_pos - 1ul);
+    }
+
+    template <class T, class A>
+    void insert_at(indexed_list<T, A>& p_container, std::size_t p_pos, T const& p_value)
+    {
+        p_container.push_at(p_value, p_pos);
+    }
+
+    template <class T, class A>
+    void insert_at(unrolled_forward_list<T, A>& p_container, std::size_t p_pos, T const& p_value)
+    {
+        p_container.push_at(p_value, p_pos);
+    }
+
+
+    /** ELEMENT `pos` GOES **/
+    template <class T>
+    void erase_at(std::vector<T>& p_container, std::size_t p_pos)
+    {
+        p_container.erase(p_container.begin() + static_cast<std::ptrdiff_t>(p_pos));
+    }
+
+    template <class T>
+    void erase_at(std::deque<T>& p_container, std::size_t p_pos)
+    {
+        p_container.erase(p_container.begin() + static_cast<std::ptrdiff_t>(p_pos));
+    }
+
+    template <class T>
+    void erase_at(std::list<T>& p_container, std::size_t p_pos)
+    {
+        p_container.erase(std::next(p_container.begin(), static_cast<std::ptrdiff_t>(p_pos)));
+    }
+
+    template <class T>
+    void erase_at(std::forward_list<T>& p_container, std::size_t p_pos)
+    {
+        p_container.erase_after(std::next(p_container.before_begin(), static_cast<std::ptrdiff_t>(p_pos)));
+    }
+
+    template <class T, class A>
+    void erase_at(forward_list<T, A>& p_container, std::size_t p_pos)
+    {
+        if (p_pos == 0ul) p_container.pop_front();
+        else              p_container.pop_at(p_pos);
+    }
+
+    template <class T, class A>
+    void erase_at(indexed_list<T, A>& p_container, std::size_t p_pos)
+    {
+        p_container.pop_at(p_pos);
+    }
+
+    template <class T, class A>
+    void erase_at(unrolled_forward_list<T, A>& p_container, std::size_t p_pos)
+    {
+        p_container.pop_at(p_pos);
+    }
+
+
+    template <class C, class T>
+    concept insertable_at = requires(C& c, T const& v) { insert_at(c, 0ul, v); };
+
+    template <class C>
+    concept erasable_at = requires(C& c) { erase_at(c, 0ul); };
+
+
+    template <class C, class T>
+    concept searchable = requires(C const& c, T const& v) { c.contains(v); } ||
+                         requires(C const& c, T const& v) { c.search(v); } ||
+                         std::ranges::input_range<C>;
+
+    template <class C, class T>
+    auto has_key(C& p_container, T const& p_key) -> bool
+    {
+        if constexpr      (requires { p_container.contains(p_key); }) return p_container.contains(p_key);
+        else if constexpr (requires { p_container.search(p_key); })   return p_container.search(p_key).has_value();
+        else return std::ranges::find(p_container, p_key) != std::ranges::end(p_container);
+    }
+
+
+    template <class C, class T>
+    concept erasable = associative<C> && (requires(C& c, T const& v) { c.remove(v); } ||
+                                          requires(C& c, T const& v) { c.erase(v); });
+
+    template <class C, class T>
+    void erase_key(C& p_container, T const& p_key)
+    {
+        if constexpr (requires { p_container.remove(p_key); }) p_container.remove(p_key);
+        else                                                   static_cast<void>(p_container.erase(p_key));
+    }
+
+
+
+    /** TIMING **/
+
+    /**
+     * `reps` times: build a state outside the clock, time `body` on it.
+     * The state ( and whatever the body parked in it ) dies after the clock stops.
+     * **/
+    template <class Setup, class Body>
+    void measure(record p_record, Setup&& p_setup, Body&& p_body)
+    {
+        std::vector<double> v_ns;
+        v_ns.reserve(p_record.m_reps);
+
+        for (std::size_t r = 0ul; r < p_record.m_reps; ++r)
+        {
+            auto v_state = p_setup();
+
+            const auto v_start = clock_type::now();
+
+            p_body(v_state);
+
+            const auto v_stop = clock_type::now();
+
+            v_ns.push_back(std::chrono::duration<double, std::nano>(v_stop - v_start).count()
+                           / static_cast<double>(std::max<std::size_t>(p_record.m_ops, 1ul)));
+        }
+
+        std::sort(v_ns.begin(), v_ns.end());
+
+        p_record.m_median = v_ns[v_ns.size() / 2ul];
+        p_record.m_min    = v_ns.front();
+
+        std::fprintf(stderr, "%-52s %10.2f ns  ( min %.2f, %zu ops x %zu )\n",
+                     p_record.m_name.c_str(), p_record.m_median, p_record.m_min, p_record.m_ops, p_record.m_reps);
+
+        g_records.push_back(std::move(p_record));
+    }
+
+
+
+    /** EVERY OPERATION `C` SUPPORTS, ON `values` **/
+    template <class C, class T>
+    void suite(char const* p_container, std::vector<T> const& p_values, options const& p_options)
+    {
+        const std::size_t v_size = p_values.size();
+
+        // small sizes are cheap and noisy, give them more repetitions
+        const std::size_t v_reps = std::max(p_options.m_reps, std::min<std::size_t>(100ul, 1'000'000ul / v_size));
+
+        const std::size_t v_walks = std::clamp<std::size_t>(walk_budget / v_size, 8ul, p_options.m_probes);
+
+        std::mt19937_64 v_rng {p_options.m_seed ^ (v_size * 0x9E3779B97F4A7C15ull)};
+
+        auto run = [&](char const* p_operation, std::size_t p_ops, auto&& p_setup, auto&& p_body) -> void
+        {
+            record v_record {};
+
+            v_record.m_name      = std::string(p_container) + '<' + type_name<T> + ">/" + p_operation + '/' + std::to_string(v_size);
+            v_record.m_container = p_container;
+            v_record.m_type      = type_name<T>;
+            v_record.m_operation = p_operation;
+            v_record.m_size      = v_size;
+            v_record.m_ops       = p_ops;
+            v_record.m_reps      = v_reps;
+
+            if (v_record.m_name.find(p_options.m_filter) == std::string::npos) return;
+
+            measure(std::move(v_record), p_setup, p_body);
+        };
+
+        auto v_empty = [&]() { return make_empty<C>(v_size); };
+
+        auto v_full = [&]() -> std::unique_ptr<C>
+        {
+            if constexpr (puttable<C, T>)
+            {
+                auto v_container = make_empty<C>(v_size);
+
+                for (T const& v_value : p_values) put(*v_container, v_value);
+
+                return v_container;
+            }
+            else {
+                return std::make_unique<C>(p_values);
+            }
+        };
+
+
+        if constexpr (puttable<C, T>)
+        {
+            run("push", v_size, v_empty, [&](auto& c) { for (T const& v_value : p_values) put(*c, v_value); });
+        }
+
+        if constexpr (emplaceable<C, T>)
+        {
+            run("emplace", v_size, v_empty, [&](auto& c) { for (T const& v_value : p_values) place(*c, v_value); });
+        }
+
+        if constexpr (takeable<C>)
+        {
+            run("pop", v_size, v_full, [&](auto& c) { for (std::size_t i = 0ul; i < v_size; ++i) take(*c); });
+        }
+
+        if constexpr (insertable_at<C, T>)
+        {
+            std::vector<std::size_t> v_pos(v_walks);
+
+            // the container grows by one per probe
+            for (std::size_t i = 0ul; i < v_walks; ++i) v_pos[i] = v_rng() % (v_size + i + 1ul);
+
+            run("insert_at", v_walks, v_full, [&](auto& c) {
+                for (std::size_t i = 0ul; i < v_walks; ++i) insert_at(*c, v_pos[i], p_values[i % v_size]);
+            });
+        }
+
+        if constexpr (erasable_at<C>)
+        {
+            const std::size_t v_ops = std::min(v_walks, v_size / 2ul);
+
+            std::vector<std::size_t> v_pos(v_ops);
+
+            // and shrinks by one here
+            for (std::size_t i = 0ul; i < v_ops; ++i) v_pos[i] = v_rng() % (v_size - i);
+
+            run("erase_at", v_ops, v_full, [&](auto& c) {
+                for (std::size_t i = 0ul; i < v_ops; ++i) erase_at(*c, v_pos[i]);
+            });
+        }
+
+        if constexpr (searchable<C, T>)
+        {
+            const std::size_t v_ops = associative<C> ? p_options.m_probes : v_walks;
+
+            std::vector<T const*> v_keys(v_ops);
+
+            for (std::size_t i = 0ul; i < v_ops; ++i) v_keys[i] = &p_values[v_rng() % v_size];
+
+            run("find", v_ops, v_full, [&](auto& c) {
+                std::size_t v_hits = 0ul;
+
+                for (T const* v_key : v_keys) v_hits += has_key(*c, *v_key) ? 1ul : 0ul;
+
+                g_sink = g_sink + v_hits;
+            });
+        }
+
+        if constexpr (erasable<C, T>)
+        {
+            const std::size_t v_ops = std::min(p_options.m_probes, v_size);
+
+            // the input is shuffled, so its head is a set of distinct random keys
+            run("erase", v_ops, v_full, [&](auto& c) {
+                for (std::size_t i = 0ul; i < v_ops; ++i) erase_key(*c, p_values[i]);
+            });
+        }
+
+        if constexpr (std::is_copy_constructible<C>::value)
+        {
+            std::unique_ptr<C> v_copy;
+
+            run("copy", v_size, [&]() { v_copy.reset(); return v_full(); }, [&](auto& c) { v_copy = std::make_unique<C>(*c); });
+
+            v_copy.reset();
+        }
+
+        run("clear", v_size, v_full, [&](auto& c) {
+            if constexpr (requires { c->clear(); }) c->clear();
+            else                                    c.reset();
+        });
+
+        if constexpr (std::ranges::input_range<C>)
+        {
+            run("iterate", v_size, v_full, [&](auto& c) {
+                std::size_t v_sum = 0ul;
+
+                for (auto const& v_value : *c) v_sum += digest(v_value);
+
+                g_sink = g_sink + v_sum;
+            });
+        }
+    }
+
+
+    template <class T>
+    void run_type(options const& p_options)
+    {
+        for (std::size_t v_size : p_options.m_sizes)
+        {
+            const std::vector<T> v_values = make_input<T>(v_size, p_options.m_seed);
+
+            suite<std::vector<T>>("std::vector", v_values, p_options);
+            suite<std::deque<T>>("std::deque", v_values, p_options);
+            suite<std::list<T>>("std::list", v_values, p_options);
+            suite<std::forward_list<T>>("std::forward_list", v_values, p_options);
+            suite<std::set<T>>("std::set", v_values, p_options);
+
+            suite<list<T>>("list", v_values, p_options);
+            suite<forward_list<T>>("forward_list", v_values, p_options);
+            suite<indexed_list<T>>("indexed_list", v_values, p_options);
+            suite<unrolled_forward_list<T>>("unrolled_forward_list", v_values, p_options);
+
+            suite<queue<T>>("queue", v_values, p_options);
+            suite<ring_queue<T>>("ring_queue", v_values, p_options);
+            suite<stack<T>>("stack", v_values, p_options);
+            suite<chunked_stack<T>>("chunked_stack", v_values, p_options);
+
+            suite<binary_search_tree<T>>("binary_search_tree", v_values, p_options);
+            suite<binary_search_tree<T, red_black>>("binary_search_tree<red_black>", v_values, p_options);
+            suite<b_tree<T>>("b_tree", v_values, p_options);
+            suite<persistent_search_tree<T>>("persistent_search_tree", v_values, p_options);
+            suite<static_search_set<T>>("static_search_set", v_values, p_options);
+
+            // single threaded: the cost of the synchronisation alone
+            suite<spsc_queue<T>>("spsc_queue", v_values, p_options);
+            suite<mpmc_queue<T>>("mpmc_queue", v_values, p_options);
+            suite<concurrent_stack<T>>("concurrent_stack", v_values, p_options);
+
+            // the pooled variants and work_stealing_deque are built for the arithmetic types only
+            if constexpr (std::is_same<T, int>::value)
+            {
+                suite<pooled::list<T>>("pooled::list", v_values, p_options);
+                suite<pooled::forward_list<T>>("pooled::forward_list", v_values, p_options);
+                suite<pooled::queue<T>>("pooled::queue", v_values, p_options);
+
+                suite<work_stealing_deque<T>>("work_stealing_deque", v_values, p_options);
+            }
+        }
+    }
+
+
+
+    /** OUTPUT **/
+
+    auto quoted(std::string_view p_text) -> std::string
+    {
+        std::string v_out {'"'};
+
+        for (char v_char : p_text)
+        {
+            if (v_char == '"' or v_char == '\\') v_out += '\\';
+            v_out += v_char;
+        }
+
+        return v_out += '"';
+    }
+
+
+    void write_json(std::FILE* p_file, options const& p_options, char const* p_executable)
+    {
+        char v_date[32] {};
+
+        const std::time_t v_now = std::time(nullptr);
+        std::strftime(v_date, sizeof(v_date), "%Y-%m-%dT%H:%M:%S", std::localtime(&v_now));
+
+        std::string v_sizes;
+
+        for (std::size_t v_size : p_options.m_sizes) v_sizes += (v_sizes.empty() ? "" : ", ") + std::to_string(v_size);
+
+        std::fprintf(p_file, "{\n  \"context\": {\n");
+        std::fprintf(p_file, "    \"date\": %s,\n", quoted(v_date).c_str());
+        std::fprintf(p_file, "    \"executable\": %s,\n", quoted(p_executable).c_str());
+#ifdef __VERSION__
+        std::fprintf(p_file, "    \"compiler\": %s,\n", quoted(__VERSION__).c_str());
+#endif
+#ifdef NDEBUG
+        std::fprintf(p_file, "    \"assertions\": false,\n");
+#else
+        std::fprintf(p_file, "    \"assertions\": true,\n");
+#endif
+        std::fprintf(p_file, "    \"seed\": %llu,\n", static_cast<unsigned long long>(p_options.m_seed));
+        std::fprintf(p_file, "    \"repetitions\": %zu,\n", p_options.m_reps);
+        std::fprintf(p_file, "    \"probes\": %zu,\n", p_options.m_probes);
+        std::fprintf(p_file, "    \"sizes\": [%s]\n", v_sizes.c_str());
+        std::fprintf(p_file, "  },\n  \"benchmarks\": [\n");
+
+        for (std::size_t i = 0ul; i < g_records.size(); ++i)
+        {
+            record const& v_record = g_records[i];
+
+            std::fprintf(p_file,
+                         "    {\"name\": %s, \"container\": %s, \"value_type\": %s, \"operation\": %s, "
+                         "\"size\": %zu, \"iterations\": %zu, \"repetitions\": %zu, "
+                         "\"real_time\": %.3f, \"min_time\": %.3f, \"time_unit\": \"ns\"}%s\n",
+                         quoted(v_record.m_name).c_str(), quoted(v_record.m_container).c_str(),
+                         quoted(v_record.m_type).c_str(), quoted(v_record.m_operation).c_str(),
+                         v_record.m_size, v_record.m_ops, v_record.m_reps,
+                         v_record.m_median, v_record.m_min,
+                         (i + 1ul < g_records.size()) ? "," : "");
+        }
+
+        std::fprintf(p_file, "  ]\n}\n");
+    }
+
+
+
+    /** COMMAND LINE **/
+
+    template <class T, class Parse>
+    auto split(std::string_view p_list, Parse p_parse) -> std::vector<T>
+    {
+        std::vector<T> v_items;
+
+        while (not p_list.empty())
+        {
+            const std::size_t v_comma = std::min(p_list.find(','), p_list.size());
+
+            v_items.push_back(p_parse(std::string(p_list.substr(0ul, v_comma))));
+
+            p_list.remove_prefix(std::min(v_comma + 1ul, p_list.size()));
+        }
+
+        return v_items;
+    }
+
+
+    /** `1e6` AND `1000000` ALIKE **/
+    auto parse_count(std::string const& p_text) -> std::size_t
+    {
+        return static_cast<std::size_t>(std::strtod(p_text.c_str(), nullptr));
+    }
+
+
+    [[noreturn]] void usage(char const* p_executable)
+    {
+        std::fprintf(stderr,
+                     "usage: %s [--sizes 1e3,1e4,1e5,1e6] [--types int,string] [--reps 5]\n"
+                     "       [--probes 1000] [--seed 42] [--filter text] [--out file.json]\n",
+                     p_executable);
+        std::exit(2);
+    }
+
+
+    auto parse(int argc, char** argv) -> options
+    {
+        options v_options;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view v_flag {argv[i]};
+
+            if (i + 1 == argc) usage(argv[0]);
+
+            const std::string v_value {argv[++i]};
+
+            if      (v_flag == "--sizes")  v_options.m_sizes  = split<std::size_t>(v_value, parse_count);
+            else if (v_flag == "--types")  v_options.m_types  = split<std::string>(v_value, [](std::string s) { return s; });
+            else if (v_flag == "--reps")   v_options.m_reps   = std::max<std::size_t>(1ul, parse_count(v_value));
+            else if (v_flag == "--probes") v_options.m_probes = std::max<std::size_t>(1ul, parse_count(v_value));
+            else if (v_flag == "--seed")   v_options.m_seed   = std::strtoull(v_value.c_str(), nullptr, 10);
+            else if (v_flag == "--filter") v_options.m_filter = v_value;
+            else if (v_flag == "--out")    v_options.m_out    = v_value;
+            else                           usage(argv[0]);
+        }
+
+        std::erase(v_options.m_sizes, 0ul);
+
+        if (v_options.m_sizes.empty()) usage(argv[0]);
+
+        return v_options;
+    }
+}
+
+
+auto main(int argc, char** argv) -> int
+{
+    const options v_options = parse(argc, argv);
+
+    for (std::string const& v_type : v_options.m_types)
+    {
+        if      (v_type == "int")    run_type<int>(v_options);
+        else if (v_type == "string") run_type<std::string>(v_options);
+        else                         usage(argv[0]);
+    }
+
+    std::FILE* v_file = v_options.m_out.empty() ? stdout : std::fopen(v_options.m_out.c_str(), "w");
+
+    if (v_file == nullptr)
+    {
+        std::perror(v_options.m_out.c_str());
+        return 1;
+    }
+
+    write_json(v_file, v_options, argv[0]);
+
+    if (v_file != stdout) std::fclose(v_file);
+
+    return 0;
+}
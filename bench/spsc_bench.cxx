@@ -0,0 +1,181 @@
+//  --------------------------------------------
+//  spsc_queue throughput against a mutex-wrapped queue
+//
+//  one producer thread hands `items` longs to one consumer thread;
+//  prints items per second for each, single and batched transfers.
+//  a side that finds the queue full / empty yields, so the numbers
+//  stay meaningful on machines with fewer cores than threads.
+//
+//  usage: spsc_bench [items] [capacity]
+//  --------------------------------------------
+
+#include <ds/queue.hxx>
+#include <ds/spsc_queue.hxx>
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+
+namespace
+{
+    using clock_type = std::chrono::steady_clock;
+
+    constexpr std::size_t batch_size = 64ul;
+
+
+    /** RUN PRODUCER AND CONSUMER, RETURN SECONDS ELAPSED **/
+    template <class Producer, class Consumer>
+    auto timed(Producer&& p_producer, Consumer&& p_consumer) -> double
+    {
+        const auto v_start = clock_type::now();
+
+        std::thread v_thread {std::forward<Producer>(p_producer)};
+
+        p_consumer();
+        v_thread.join();
+
+        return std::chrono::duration<double>(clock_type::now() - v_start).count();
+    }
+
+
+    auto bench_mutex(long p_items) -> double
+    {
+        queue<long> v_queue;
+        std::mutex  v_mutex;
+        long        v_sum {};
+
+        double v_secs = timed(
+            [&]() {
+                for (long i = 0; i < p_items; ++i)
+                {
+                    std::lock_guard v_lock {v_mutex};
+                    v_queue.push(i);
+                }
+            },
+            [&]() {
+                for (long v_seen = 0; v_seen < p_items;)
+                {
+                    std::unique_lock v_lock {v_mutex};
+
+                    if (auto v_item = v_queue.front())
+                    {
+                        v_sum += *v_item;
+                        v_queue.pop();
+                        ++v_seen;
+                    }
+                    else {
+                        v_lock.unlock();
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+        if (v_sum != p_items * (p_items - 1) / 2) std::abort();
+
+        return v_secs;
+    }
+
+
+    auto bench_spsc(long p_items, std::size_t p_capacity) -> double
+    {
+        spsc_queue<long> v_queue {p_capacity};
+        long             v_sum {};
+
+        double v_secs = timed(
+            [&]() {
+                for (long i = 0; i < p_items;)
+                {
+                    if (v_queue.try_push(i)) ++i;
+                    else                     std::this_thread::yield();
+                }
+            },
+            [&]() {
+                for (long v_seen = 0; v_seen < p_items;)
+                {
+                    if (auto v_item = v_queue.try_pop())
+                    {
+                        v_sum += *v_item;
+                        ++v_seen;
+                    }
+                    else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+        if (v_sum != p_items * (p_items - 1) / 2) std::abort();
+
+        return v_secs;
+    }
+
+
+    auto bench_spsc_batch(long p_items, std::size_t p_capacity) -> double
+    {
+        spsc_queue<long> v_queue {p_capacity};
+        long             v_sum {};
+
+        double v_secs = timed(
+            [&]() {
+                std::array<long, batch_size> v_batch {};
+
+                for (long i = 0; i < p_items;)
+                {
+                    const auto v_want = static_cast<std::size_t>(std::min<long>(batch_size, p_items - i));
+
+                    for (std::size_t j = 0ul; j < v_want; ++j) v_batch[j] = i + static_cast<long>(j);
+
+                    for (std::size_t j = 0ul; j < v_want;)
+                    {
+                        const std::size_t v_put = v_queue.push_n(v_batch.begin() + static_cast<long>(j), v_want - j);
+
+                        if (v_put == 0ul) std::this_thread::yield();
+
+                        j += v_put;
+                    }
+
+                    i += static_cast<long>(v_want);
+                }
+            },
+            [&]() {
+                std::array<long, batch_size> v_batch {};
+
+                for (long v_seen = 0; v_seen < p_items;)
+                {
+                    const std::size_t v_got = v_queue.pop_n(v_batch.begin(), batch_size);
+
+                    if (v_got == 0ul) std::this_thread::yield();
+
+                    for (std::size_t j = 0ul; j < v_got; ++j) v_sum += v_batch[j];
+
+                    v_seen += static_cast<long>(v_got);
+                }
+            });
+
+        if (v_sum != p_items * (p_items - 1) / 2) std::abort();
+
+        return v_secs;
+    }
+
+
+    void report(char const* p_name, long p_items, double p_secs)
+    {
+        std::printf("%-24s %8.3f s %12.0f items/s\n", p_name, p_secs, static_cast<double>(p_items) / p_secs);
+    }
+}
+
+
+auto main(int argc, char** argv) -> int
+{
+    const long        v_items    = (argc > 1) ? std::atol(argv[1]) : 10'000'000l;
+    const std::size_t v_capacity = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 1024ul;
+
+    report("mutex + queue",      v_items, bench_mutex(v_items));
+    report("spsc_queue",         v_items, bench_spsc(v_items, v_capacity));
+    report("spsc_queue (batch)", v_items, bench_spsc_batch(v_items, v_capacity));
+
+    return 0;
+}
@@ -0,0 +1,407 @@
+#ifndef B_TREE_HXX
+#define B_TREE_HXX
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <string>
+
+#include <ds/node_allocator.hxx>
+
+
+/** START CONSTRAINTS **/
+
+/** keys live in fixed arrays inside the nodes, so they must be default constructible **/
+template <class T>
+concept b_tree_key = std::totally_ordered<T> && std::default_initializable<T>;
+
+/** END CONSTRAINTS **/
+
+
+/** FROWARD DECL **/
+template <b_tree_key T, class = std::allocator<T>> class b_tree;
+
+
+/** START NODE **/
+
+/**
+ * Leaf layout; inner nodes extend it with the child array.
+ * The key array spans about four cache lines, so a lookup touches
+ * one short contiguous block per level instead of one node per key.
+ * **/
+template <class T> class b_tree_node
+{
+
+public:
+    template <b_tree_key, class> friend class b_tree;
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using size_type       = std::size_t;
+
+public: /** LAYOUT **/
+    static constexpr size_type cache_line = 64ul;
+
+    /** every node but the root holds [ min_degree - 1, 2 * min_degree - 1 ] keys **/
+    static constexpr size_type min_degree =
+        std::max<size_type>(2ul, (4ul * cache_line) / (2ul * sizeof(T)));
+
+    static constexpr size_type max_keys = (2ul * min_degree) - 1ul;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    explicit b_tree_node(bool p_leaf = true)
+            noexcept(std::is_nothrow_default_constructible<T>::value)
+        : m_leaf(p_leaf)
+    {
+    }
+
+
+private:
+    std::array<value_type, max_keys> m_keys;
+    std::uint16_t                    m_count {};
+    bool                             m_leaf  {true};
+};
+
+
+template <class T> class b_tree_inner final : public b_tree_node<T>
+{
+
+public:
+    template <b_tree_key, class> friend class b_tree;
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    b_tree_inner() noexcept(std::is_nothrow_default_constructible<T>::value)
+        : b_tree_node<T>(false)
+    {
+    }
+
+
+private:
+    std::array<b_tree_node<T>*, b_tree_node<T>::max_keys + 1ul> m_children {};
+};
+
+/** END NODE **/
+
+
+/** START TREE **/
+
+template <b_tree_key T, class Allocator> class b_tree
+{
+
+public: /** TYPE ALIAS **/
+    using node_type  = b_tree_node<T>;
+    using inner_type = b_tree_inner<T>;
+
+private: /** TYPE ALIAS **/
+    /** leaves and inner nodes differ in size, each gets its own rebind **/
+    using leaf_allocator_type  = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+    using inner_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<inner_type>;
+    using alloc_traits         = std::allocator_traits<Allocator>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = typename node_type::value_type;
+    using reference       = typename node_type::reference;
+    using const_reference = typename node_type::const_reference;
+    using pointer         = typename node_type::pointer;
+    using const_pointer   = typename node_type::const_pointer;
+    using size_type       = std::size_t;
+    using allocator_type  = Allocator;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    b_tree() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** ALLOCATOR CTOR **/
+    explicit b_tree(Allocator const& /* alloc */) noexcept(true);
+
+    /**
+     * INITIALIZER_LIST CTOR
+     * (Construct with the contents of the initializer list)
+     * **/
+    b_tree(std::initializer_list<T> /* list */, Allocator const& = Allocator()) noexcept(
+        std::is_nothrow_copy_constructible<T>::value);
+
+    /**
+     * RANGE TYPE CTOR
+     * (Construct with the contents of the range)
+     * **/
+    template <std::ranges::range R>
+    b_tree(R&& /* range */, Allocator const& = Allocator())
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_value_t<R>>::value);
+
+    /**
+     * RANGE CTOR
+     * (Construct with the contents of the range [ begin, end ])
+     * **/
+    template <std::input_iterator I, std::sentinel_for<I> S>
+    b_tree(I /* begin */, S /* end */, Allocator const& = Allocator())
+        noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+        requires(std::is_constructible<T, std::iter_value_t<I>>::value);
+
+    /** COPY CTOR  **/
+    b_tree(b_tree const& /* outer */) noexcept(
+        std::is_nothrow_copy_constructible<T>::value &&
+        std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** COPY CTOR ( allocator-extended ) **/
+    b_tree(b_tree const& /* outer */, Allocator const& /* alloc */) noexcept(
+        std::is_nothrow_copy_constructible<T>::value);
+
+    /** MOVE CTOR **/
+    b_tree(b_tree&& /* outer */) noexcept(true);
+
+    /** ASSIGNMENT **/
+    b_tree& operator=(b_tree /* rhs */) noexcept(
+        std::is_nothrow_copy_constructible<T>::value);
+
+
+
+public: /** MEMBER FUNCTION **/
+
+    /** INSERTING A KEY IN TREE **/
+    template <class U>
+    void insert(U&& /* data */)
+        noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    /** INSERTING A KEY IN TREE ( construct in place ) **/
+    template <class... Args>
+    void emplace(Args&&... /* args */) noexcept(
+        std::is_nothrow_constructible<T, Args...>::value);
+
+
+public:
+    /** SEARCH FOR A KEY IN TREE **/
+    auto search(T const& /* key */) const
+        noexcept(true) -> std::optional<value_type>;
+
+
+public:
+
+    /** DELETE A KEY FROM TREE **/
+    void remove(T const& /* key */) noexcept(
+        std::is_nothrow_destructible<T>::value);
+
+    /** MAKE TREE EMPTY **/
+    void clear() noexcept(std::is_nothrow_destructible<T>::value);
+
+
+public:
+
+    /** PRINT TREE KEYS IN INORDER **/
+    void print_inorder() const noexcept(true);
+
+
+public:
+
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+    [[nodiscard]] auto max() const noexcept(true) -> std::optional<value_type>;
+
+    [[nodiscard]] auto min() const noexcept(true) -> std::optional<value_type>;
+
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+
+public:
+
+    ~b_tree() noexcept(std::is_nothrow_destructible<T>::value);
+
+
+public:
+
+    friend void swap(b_tree& p_lhs, b_tree& p_rhs) noexcept(true)
+    {
+        using std::swap;
+
+        swap(p_lhs.m_root, p_rhs.m_root);
+        swap(p_lhs.m_size, p_rhs.m_size);
+
+        swap_allocators(p_lhs.m_alloc, p_rhs.m_alloc);
+    }
+
+
+private: /** NODE HELPERS **/
+
+    static constexpr size_type min_degree = node_type::min_degree;
+    static constexpr size_type max_keys   = node_type::max_keys;
+
+    [[nodiscard]] static auto children(node_type* p_node) noexcept(true) -> decltype(auto)
+    {
+        return (static_cast<inner_type*>(p_node)->m_children);
+    }
+
+    /** INDEX OF FIRST KEY NOT LESS THAN KEY **/
+    [[nodiscard]] static auto lower_index(node_type const* p_node, T const& p_key) noexcept(true) -> size_type
+    {
+        if constexpr (std::is_arithmetic<T>::value)
+        {
+            // branch-free count; the loop is short and vectorizes
+            size_type v_index = 0ul;
+
+            for (size_type i = 0ul; i < p_node->m_count; ++i)
+            {
+                v_index += static_cast<size_type>(p_node->m_keys[i] < p_key);
+            }
+
+            return v_index;
+        }
+        else {
+            auto v_begin = p_node->m_keys.begin();
+
+            return static_cast<size_type>(
+                std::lower_bound(v_begin, v_begin + p_node->m_count, p_key) - v_begin);
+        }
+    }
+
+    /** INDEX OF FIRST KEY GREATER THAN KEY **/
+    [[nodiscard]] static auto upper_index(node_type const* p_node, T const& p_key) noexcept(true) -> size_type
+    {
+        auto v_begin = p_node->m_keys.begin();
+
+        return static_cast<size_type>(
+            std::upper_bound(v_begin, v_begin + p_node->m_count, p_key) - v_begin);
+    }
+
+    /** EMPTY LEAF OR INNER NODE, nullptr WHEN OUT OF MEMORY **/
+    [[nodiscard]] auto make_node(bool /* leaf */)
+        noexcept(std::is_nothrow_default_constructible<T>::value) -> node_type*;
+
+    /** FREE ONE NODE THROUGH THE ALLOCATOR OF ITS DYNAMIC TYPE **/
+    void free_node(node_type* /* node */) noexcept(std::is_nothrow_destructible<T>::value);
+
+    void destroy(node_type* /* node */) noexcept(std::is_nothrow_destructible<T>::value);
+
+    [[nodiscard]] auto clone(node_type const* /* node */)
+        noexcept(std::is_nothrow_copy_constructible<T>::value) -> node_type*;
+
+    static void print(node_type const* /* node */) noexcept(true);
+
+
+private: /** INSERT HELPERS **/
+
+    /** PLACE AN ALREADY CONSTRUCTED KEY **/
+    void attach(T&& /* data */) noexcept(std::is_nothrow_move_assignable<T>::value);
+
+    /** SPLIT FULL CHILD AT INDEX, FALSE WHEN OUT OF MEMORY **/
+    [[nodiscard]] auto split_child(node_type* /* parent */, size_type /* index */) noexcept(true) -> bool;
+
+
+private: /** REMOVE HELPERS **/
+
+    /** MAKE CHILD AT INDEX HOLD AT LEAST min_degree KEYS, RETURN ITS NEW INDEX **/
+    auto fill(node_type* /* parent */, size_type /* index */) noexcept(true) -> size_type;
+
+    void borrow_from_prev(node_type* /* parent */, size_type /* index */) noexcept(true);
+    void borrow_from_next(node_type* /* parent */, size_type /* index */) noexcept(true);
+
+    /** MERGE CHILD index + 1 AND SEPARATOR KEY INTO CHILD index **/
+    void merge(node_type* /* parent */, size_type /* index */) noexcept(true);
+
+    /** REMOVE AND RETURN GREATEST / SMALLEST KEY OF SUBTREE **/
+    auto take_max(node_type* /* node */) noexcept(true) -> value_type;
+    auto take_min(node_type* /* node */) noexcept(true) -> value_type;
+
+
+private:
+    node_type* m_root {};
+    size_type  m_size {};
+
+    [[no_unique_address]] leaf_allocator_type m_alloc;
+};
+
+/** END TREE **/
+
+// //
+
+template <b_tree_key T, class Allocator>
+template <std::ranges::range R>
+b_tree<T, Allocator>::b_tree(R&& p_range, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_value_t<R>>::value)
+    : b_tree(std::ranges::begin(p_range), std::ranges::end(p_range), p_alloc)
+{
+}
+
+template <b_tree_key T, class Allocator>
+template <std::input_iterator I, std::sentinel_for<I> S>
+b_tree<T, Allocator>::b_tree(I p_begin, S p_end, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+        requires(std::is_constructible<T, std::iter_value_t<I>>::value)
+    : b_tree(p_alloc)
+{
+    using std::placeholders::_1;
+
+    auto lambda = &b_tree::template insert<std::iter_reference_t<I>>;
+
+    std::ranges::for_each(p_begin, p_end, std::bind(lambda, this, _1));
+}
+
+
+template <b_tree_key T, class Allocator>
+template <class U>
+void b_tree<T, Allocator>::insert(U&& p_data)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    attach(T(std::forward<U>(p_data)));
+}
+
+template <b_tree_key T, class Allocator>
+template <class... Args>
+void b_tree<T, Allocator>::emplace(Args&&... p_args)
+    noexcept(std::is_nothrow_constructible<T, Args...>::value)
+{
+    attach(T(std::forward<Args>(p_args)...));
+}
+
+
+/** USER DEFINED TYPE DEDUCTION **/
+template <std::ranges::range R>
+b_tree(R) -> b_tree<std::ranges::range_value_t<R>>;
+
+template <std::input_iterator I, std::sentinel_for<I> S>
+b_tree(I, S) -> b_tree<std::iter_value_t<I>>;
+
+
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <b_tree_key T>
+    using b_tree = ::b_tree<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+extern template class b_tree<int>;
+extern template class b_tree<char>;
+extern template class b_tree<long>;
+extern template class b_tree<short>;
+extern template class b_tree<unsigned int>;
+extern template class b_tree<unsigned char>;
+extern template class b_tree<unsigned long>;
+extern template class b_tree<unsigned short>;
+extern template class b_tree<float>;
+extern template class b_tree<double>;
+extern template class b_tree<std::string>;
+
+#endif
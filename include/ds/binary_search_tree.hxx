@@ -2,20 +2,81 @@
 #define BINARY_SEARCH_TREE_NODE
 
 #include <algorithm>
+#include <bit>
+#include <concepts>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <optional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <ranges>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <ds/container_stats.hxx>
+#include <ds/node_allocator.hxx>
+#include <ds/node_pool.hxx>
+#include <ds/task_scheduler.hxx>
+
+/** BALANCING POLICIES **/
+
+/** plain BST: nodes are linked where the descent ends, no rotations **/
+struct unbalanced final {};
+
+/** red-black tree: height kept below 2 * log2(n + 1) by recolouring and rotations **/
+struct red_black final {};
+
+template <class B>
+concept balance_policy =
+        std::is_same<B, unbalanced>::value ||
+        std::is_same<B, red_black>::value;
+
+
+/** SORTED INPUT TAG **/
+
+/** caller guarantees the input is in non-descending order **/
+struct sorted_range_t final { explicit sorted_range_t() = default; };
+
+inline constexpr sorted_range_t sorted_range {};
+
+
+/** TREE SHAPE ( see binary_search_tree::profile ) **/
+struct tree_profile final
+{
+    std::vector<std::size_t> m_levels {};   // m_levels[d]: nodes at depth d, the root at 0
+
+    [[nodiscard]] auto height() const noexcept(true) -> std::size_t { return m_levels.size(); }
+
+    /** nodes a search for a present key visits, averaged over the keys **/
+    [[nodiscard]] auto average_depth() const noexcept(true) -> double
+    {
+        std::size_t v_nodes = 0ul, v_visits = 0ul;
+
+        for (std::size_t v_depth = 0ul; v_depth < m_levels.size(); ++v_depth)
+        {
+            v_nodes  = v_nodes  + m_levels[v_depth];
+            v_visits = v_visits + m_levels[v_depth] * (v_depth + 1ul);
+        }
+
+        return (v_nodes == 0ul) ? 0.0 : static_cast<double>(v_visits) / static_cast<double>(v_nodes);
+    }
+};
+
 
 /** FROWARD DECL **/
-template <std::totally_ordered> class binary_search_tree;
+template <std::totally_ordered T, balance_policy = unbalanced, class = std::allocator<T>> class binary_search_tree;
+template <class> class InOrder;
 
 /** START NODE **/
-template <class T>  class node final
+template <class T>  class tree_node final
 {
 
 public:
-    friend struct binary_search_tree<T>;
+    template <std::totally_ordered, balance_policy, class> friend class binary_search_tree;
+    friend class InOrder<T>;
 
 public: /** TYPE ALIAS **/
     using value_type = T;
@@ -28,14 +89,14 @@ public: /** TYPE ALIAS **/
 public: /** CONSTRUCTORS **/
     
     /** DEFAULT CTOR **/
-    node()  noexcept(std::is_nothrow_default_constructible<T>::value)
+    tree_node()  noexcept(std::is_nothrow_default_constructible<T>::value)
             requires(std::is_default_constructible<T>::value)
         : m_data(T{})
     {
     }
     
     /** PARAM CTOR **/
-    explicit node(T const& data)
+    explicit tree_node(T const& data)
             noexcept( std::is_nothrow_copy_constructible<T>::value)
             requires(std::is_copy_constructible<T>::value)
         : m_data(data)
@@ -43,7 +104,7 @@ public: /** CONSTRUCTORS **/
     }
     
     /** PARAM CTOR ( rvalue ref ) **/
-    explicit node(T&& data)
+    explicit tree_node(T&& data)
             noexcept( std::is_nothrow_move_constructible<T>::value)
             requires(std::is_move_constructible<T>::value)
         : m_data(std::move(data))
@@ -52,7 +113,7 @@ public: /** CONSTRUCTORS **/
     
     /** **/
     template <class... ARGS>
-    node(std::in_place_t, ARGS&&... p_args)
+    tree_node(std::in_place_t, ARGS&&... p_args)
             noexcept( std::is_nothrow_constructible<T, ARGS...>::value)
             requires(std::is_constructible<T, ARGS...>::value)
         : m_data(std::forward<ARGS>(p_args)...)
@@ -62,21 +123,170 @@ public: /** CONSTRUCTORS **/
     
 
 private:
-    value_type m_data;
-    node* m_left   {};
-    node* m_right  {};
-    node* m_parent {};
+    value_type  m_data;
+    bool        m_red    {};
+    tree_node*  m_left   {};
+    tree_node*  m_right  {};
+    tree_node*  m_parent {};
+    std::size_t m_count  {1ul};   // nodes in the subtree rooted here
 };
 
-/** **/
+/** END NODE **/
+
 
-/** **/
+/** START ITERATOR **/
 
-template <std::totally_ordered T> class binary_search_tree
+/**
+ * In-order traversal over the parent links; keys are read-only.
+ * end() is the null node, so the iterator also keeps the address
+ * of the tree root to step back from it.
+ * **/
+template <class T> class InOrder final
 {
 
+public:
+    template <std::totally_ordered, balance_policy, class> friend class binary_search_tree;
+
 public: /** TYPE ALIAS **/
-    using node_type = node<T>;
+    using node_type = tree_node<T>;
+
+public: /** TYPE ALIAS **/
+    using value_type        = T;
+    using reference         = typename node_type::const_reference;
+    using pointer           = typename node_type::const_pointer;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using iterator_concept  = std::bidirectional_iterator_tag;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    InOrder() noexcept(true) = default;
+
+    /** PARAM CTOR **/
+    InOrder(node_type* p_node, node_type* const* p_root) noexcept(true)
+        : m_node(p_node)
+        , m_root(p_root)
+    {}
+
+
+public:
+
+    /** DEREFERENCE OP **/
+    auto operator*() const noexcept(true) -> reference { return m_node->m_data; }
+
+    /** ARROW OP **/
+    auto operator->() const noexcept(true) -> pointer { return std::addressof( m_node->m_data ); }
+
+
+public:
+
+    /** (POST & PRE ) INCREMENT OP **/
+    auto operator++() noexcept(true) -> InOrder &
+    {
+        if (m_node->m_right != nullptr)
+        {
+            m_node = m_node->m_right;
+
+            while (m_node->m_left != nullptr)
+                m_node = m_node->m_left;
+        }
+        else {
+            node_type* v_parent = m_node->m_parent;
+
+            while ((v_parent != nullptr) && (m_node == v_parent->m_right))
+            {
+                m_node   = v_parent;
+                v_parent = v_parent->m_parent;
+            }
+
+            m_node = v_parent;
+        }
+
+        return *this;
+    }
+
+    auto operator++(int) noexcept(true) -> InOrder
+    {
+        auto copy = auto{ *this };
+        ++(*this);
+
+        return copy;
+    }
+
+    /** (POST & PRE ) DECREMENT OP **/
+    auto operator--() noexcept(true) -> InOrder &
+    {
+        if (m_node == nullptr)
+        {
+            // stepping back from end(): rightmost node of the tree
+            m_node = *m_root;
+
+            while (m_node->m_right != nullptr)
+                m_node = m_node->m_right;
+        }
+        else if (m_node->m_left != nullptr) {
+            m_node = m_node->m_left;
+
+            while (m_node->m_right != nullptr)
+                m_node = m_node->m_right;
+        }
+        else {
+            node_type* v_parent = m_node->m_parent;
+
+            while ((v_parent != nullptr) && (m_node == v_parent->m_left))
+            {
+                m_node   = v_parent;
+                v_parent = v_parent->m_parent;
+            }
+
+            m_node = v_parent;
+        }
+
+        return *this;
+    }
+
+    auto operator--(int) noexcept(true) -> InOrder
+    {
+        auto copy = auto{ *this };
+        --(*this);
+
+        return copy;
+    }
+
+
+public:
+    /** COMPAR OP **/
+    [[nodiscard]] friend auto operator==(InOrder const &p_lhs,
+                                         InOrder const &p_rhs) noexcept(true)
+        -> bool
+    {
+        return (p_lhs.m_node == p_rhs.m_node);
+    }
+
+    /* As of C++20, operator!= is auto generated as !(operator==) */
+
+
+private:
+    node_type*        m_node {};
+    node_type* const* m_root {};
+};
+
+/** END ITERATOR **/
+
+
+/** START TREE **/
+
+template <std::totally_ordered T, balance_policy Balance, class Allocator> class binary_search_tree
+{
+
+public: /** TYPE ALIAS **/
+    using node_type = tree_node<T>;
+
+private: /** TYPE ALIAS **/
+    using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+    using alloc_traits        = std::allocator_traits<Allocator>;
 
 public: /** TYPE ALIAS **/
     using value_type = typename node_type::value_type;
@@ -85,18 +295,30 @@ public: /** TYPE ALIAS **/
     using pointer         = typename node_type::pointer;
     using const_pointer   = typename node_type::const_pointer;
     using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using allocator_type  = Allocator;
+
+    /** keys are immutable in place, so both iterators are read-only **/
+    using iterator               = InOrder<T>;
+    using const_iterator         = InOrder<T>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using range_type             = std::ranges::subrange<const_iterator>;
 
 
 public: /** CONSTRUCTORS **/
         
     /** DEFAULT CTOR **/
-    binary_search_tree() noexcept(true);
+    binary_search_tree() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** ALLOCATOR CTOR **/
+    explicit binary_search_tree(Allocator const& /* alloc */) noexcept(true);
     
     /**
      * INITIALIZER_LIST CTOR
      * (Construct with the contents of the initializer list)
      * **/
-    binary_search_tree(std::initializer_list<T> /* list */) noexcept(
+    binary_search_tree(std::initializer_list<T> /* list */, Allocator const& = Allocator()) noexcept(
         std::is_nothrow_copy_constructible<T>::value);
     
     /**
@@ -104,21 +326,46 @@ public: /** CONSTRUCTORS **/
      * (Construct with the contents of the range)
      * **/
     template <std::ranges::range R>
-    binary_search_tree(R&& /* range */)
+    binary_search_tree(R&& /* range */, Allocator const& = Allocator())
         noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
-        requires(std::is_constructible<T, std::ranges::range_value_t<R>>::value);
+        requires(non_self<R, binary_search_tree> &&
+                 std::is_constructible<T, std::ranges::range_value_t<R>>::value);
     
     /**
      * RANGE CTOR
      * (Construct with the contents of the range [ begin, end ])
      * **/
     template <std::input_iterator I, std::sentinel_for<I> S>
-    binary_search_tree(I /* begin */, S /* end */)
+    binary_search_tree(I /* begin */, S /* end */, Allocator const& = Allocator())
         noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
         requires(std::is_constructible<T, std::iter_value_t<I>>::value);
+
+    /**
+     * SORTED RANGE TYPE CTOR
+     * (Build a balanced tree from an already sorted range in linear time;
+     *  the order is trusted, not checked)
+     * **/
+    template <std::ranges::range R>
+    binary_search_tree(sorted_range_t, R&& /* range */, Allocator const& = Allocator())
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_reference_t<R>>::value);
+
+    /**
+     * SORTED RANGE CTOR
+     * (Build a balanced tree from the sorted range [ begin, end ] in linear time)
+     * **/
+    template <std::input_iterator I, std::sentinel_for<I> S>
+    binary_search_tree(sorted_range_t, I /* begin */, S /* end */, Allocator const& = Allocator())
+        noexcept(std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value)
+        requires(std::is_constructible<T, std::iter_reference_t<I>>::value);
     
     /** COPY CTOR  **/
     binary_search_tree(binary_search_tree const& /* outer */) noexcept(
+        std::is_nothrow_copy_constructible<T>::value &&
+        std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** COPY CTOR ( allocator-extended ) **/
+    binary_search_tree(binary_search_tree const& /* outer */, Allocator const& /* alloc */) noexcept(
         std::is_nothrow_copy_constructible<T>::value);
     
     /** MOVE CTOR **/
@@ -126,7 +373,7 @@ public: /** CONSTRUCTORS **/
     
     /** ASSIGNMENT **/
     binary_search_tree& operator=(binary_search_tree /* rhs */) noexcept(
-        std::is_copy_constructible<T>::value);
+        std::is_nothrow_copy_constructible<T>::value);
     
     
 
@@ -148,6 +395,130 @@ public:
     /** SEARCH FOR A NODE IN TREE **/
     auto search(T const& /* key */) const
         noexcept(true) -> std::optional<value_type>;
+
+
+public: /** HETEROGENEOUS LOOKUP **/
+
+    /**
+     * FIND A NODE EQUAL TO KEY
+     * (Key can be any type ordered with T, e.g. std::string_view for a
+     *  tree of std::string: no temporary is built and nothing is copied)
+     * **/
+    template <class K>
+    [[nodiscard]] auto find(K const& /* key */) const noexcept(true) -> const_iterator
+        requires(std::totally_ordered_with<T, K>);
+
+    template <class K>
+    [[nodiscard]] auto contains(K const& /* key */) const noexcept(true) -> bool
+        requires(std::totally_ordered_with<T, K>);
+
+
+public: /** ORDERED LOOKUP ( O(height) ) **/
+
+    /** FIRST KEY NOT LESS THAN KEY **/
+    [[nodiscard]] auto lower_bound(T const& /* key */) const noexcept(true) -> const_iterator;
+
+    /** FIRST KEY GREATER THAN KEY **/
+    [[nodiscard]] auto upper_bound(T const& /* key */) const noexcept(true) -> const_iterator;
+
+    /** ALL KEYS EQUAL TO KEY **/
+    [[nodiscard]] auto equal_range(T const& /* key */) const noexcept(true) -> range_type;
+
+    /**
+     * ALL KEYS IN [ lo, hi )
+     * (Both ends are located by one descent each, subtrees outside the
+     *  bounds are never visited: a scan costs O(height + k))
+     * **/
+    [[nodiscard]] auto range(T const& /* lo */, T const& /* hi */) const noexcept(true) -> range_type;
+
+
+public: /** ORDER STATISTICS ( O(height), from subtree sizes ) **/
+
+    /** NUMBER OF KEYS LESS THAN KEY **/
+    [[nodiscard]] auto rank(T const& /* key */) const noexcept(true) -> size_type;
+
+    /** K-TH SMALLEST KEY ( 0-based ), end() WHEN OUT OF RANGE **/
+    [[nodiscard]] auto select(size_type /* k */) const noexcept(true) -> const_iterator;
+    [[nodiscard]] auto nth(size_type /* k */) const noexcept(true) -> const_iterator;
+
+
+public: /** SPLIT & JOIN ( O(log n), nodes are relinked, never copied ) **/
+
+    /**
+     * Red-black trees only: the helpers recurse once per level, which an
+     * unbalanced tree built from sorted keys makes as deep as its size.
+     * **/
+
+    /**
+     * SPLIT AROUND A KEY
+     * (First tree gets the keys less than key, second tree the others;
+     *  this tree is left empty)
+     * **/
+    [[nodiscard]] auto split(T const& /* key */) noexcept(true)
+        -> std::pair<binary_search_tree, binary_search_tree>
+        requires(std::same_as<Balance, red_black>);
+
+    /**
+     * JOIN TWO TREES THROUGH A MIDDLE KEY
+     * (Every key of left must be <= key <= every key of right)
+     * **/
+    [[nodiscard]] static auto join(binary_search_tree /* left */, T /* key */,
+                                   binary_search_tree /* right */)
+        noexcept(std::is_nothrow_move_constructible<T>::value) -> binary_search_tree
+        requires(std::same_as<Balance, red_black>);
+
+
+public: /** SET ALGEBRA ( red-black trees only, see split & join ) **/
+
+    /**
+     * Built on split and join: the left tree is split around the root key
+     * of the right one, both halves recurse, and join glues the results.
+     * The halves are independent, so large ones run as separate tasks on
+     * a shared task_scheduler.
+     * Operands are read as sets; for trees without duplicate keys the
+     * results match std::set_union, std::set_intersection and
+     * std::set_difference. Pass the operands by std::move to reuse their
+     * nodes instead of copying them. The result uses the allocator of the
+     * left operand; a right operand from an unequal allocator is copied.
+     * **/
+    [[nodiscard]] friend auto set_union(binary_search_tree p_lhs, binary_search_tree p_rhs)
+        noexcept(std::is_nothrow_destructible<T>::value) -> binary_search_tree
+        requires(std::same_as<Balance, red_black>)
+    {
+        node_type* v_rhs = p_lhs.transfer(p_rhs);
+
+        return adopt(unite(p_lhs.m_alloc, p_lhs.release(), v_rhs, 0ul), p_lhs.m_alloc);
+    }
+
+    [[nodiscard]] friend auto set_intersection(binary_search_tree p_lhs, binary_search_tree p_rhs)
+        noexcept(std::is_nothrow_destructible<T>::value) -> binary_search_tree
+        requires(std::same_as<Balance, red_black>)
+    {
+        node_type* v_rhs = p_lhs.transfer(p_rhs);
+
+        return adopt(intersect(p_lhs.m_alloc, p_lhs.release(), v_rhs, 0ul), p_lhs.m_alloc);
+    }
+
+    [[nodiscard]] friend auto set_difference(binary_search_tree p_lhs, binary_search_tree p_rhs)
+        noexcept(std::is_nothrow_destructible<T>::value) -> binary_search_tree
+        requires(std::same_as<Balance, red_black>)
+    {
+        node_type* v_rhs = p_lhs.transfer(p_rhs);
+
+        return adopt(subtract(p_lhs.m_alloc, p_lhs.release(), v_rhs, 0ul), p_lhs.m_alloc);
+    }
+
+
+public: /** ITERATORS **/
+
+    [[nodiscard]] auto begin() const noexcept(true) -> const_iterator;
+    [[nodiscard]] auto end()   const noexcept(true) -> const_iterator;
+
+    [[nodiscard]] auto cbegin() const noexcept(true) -> const_iterator;
+    [[nodiscard]] auto cend()   const noexcept(true) -> const_iterator;
+
+    [[nodiscard]] auto rbegin() const noexcept(true) -> const_reverse_iterator;
+    [[nodiscard]] auto rend()   const noexcept(true) -> const_reverse_iterator;
     
 
 public:
@@ -183,6 +554,15 @@ public:
     [[nodiscard]] auto max() const noexcept(true) -> std::optional<value_type>;
     
     [[nodiscard]] auto min() const noexcept(true) -> std::optional<value_type>;
+
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+    /**
+     * HEIGHT AND NODES PER LEVEL, O(n)
+     * (the shape behind the average search depth DATA_L_STATS measures;
+     *  needs no counters, so it is there in every build)
+     * **/
+    [[nodiscard]] auto profile() const -> tree_profile;
     
     
 
@@ -199,20 +579,25 @@ public:
 
         swap(p_lhs.m_root, p_rhs.m_root);
         swap(p_lhs.m_size, p_rhs.m_size);
+
+        swap_allocators(p_lhs.m_alloc, p_rhs.m_alloc);
     }
     
 
 private:
     
-    [[nodiscard]] auto clone(node_type* p_root) const
+    [[nodiscard]] auto clone(node_type* p_root)
         noexcept(std::is_nothrow_copy_constructible<T>::value) -> node_type*
     {
         if (p_root != nullptr)
         {
-            auto v_current = new (std::nothrow) node_type(p_root->m_data);
+            auto v_current = allocate_node<node_type>(m_alloc, p_root->m_data);
 
             if (not v_current) return nullptr;
 
+            v_current->m_red   = p_root->m_red;
+            v_current->m_count = p_root->m_count;
+
             auto v_copy = v_current;
 
             while (p_root != nullptr)
@@ -220,10 +605,12 @@ private:
                 if ((p_root->m_left != nullptr) && (not v_copy->m_left))
                 {
                     auto v_node =
-                        new (std::nothrow) node_type(p_root->m_left->m_data);
+                        allocate_node<node_type>(m_alloc, p_root->m_left->m_data);
 
                     if (not v_node) break;
 
+                    v_node->m_red            = p_root->m_left->m_red;
+                    v_node->m_count          = p_root->m_left->m_count;
                     v_copy->m_left           = v_node;
                     v_copy->m_left->m_parent = v_copy;
 
@@ -234,10 +621,12 @@ private:
                            (not v_copy->m_right))
                 {
                     auto v_node =
-                        new (std::nothrow) node_type(p_root->m_right->m_data);
+                        allocate_node<node_type>(m_alloc, p_root->m_right->m_data);
 
                     if (not v_node) break;
 
+                    v_node->m_red             = p_root->m_right->m_red;
+                    v_node->m_count           = p_root->m_right->m_count;
                     v_copy->m_right           = v_node;
                     v_copy->m_right->m_parent = v_copy;
 
@@ -253,35 +642,181 @@ private:
         }
         return p_root;
     }
-    
-    
+
+
+private: /** BULK LOAD HELPERS **/
+
+    /**
+     * ALLOCATE EVERY NODE ( one at a time, they are freed one at a time ),
+     * THEN LINK THEM INTO A BALANCED SHAPE WITHOUT A SINGLE COMPARISON
+     * **/
+    template <std::input_iterator I, std::sentinel_for<I> S>
+    void bulk_load(I /* begin */, S /* end */)
+        noexcept(std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value);
+
+    /** TURN THE NEXT count NODES OF A SORTED CHAIN ( linked by m_right ) INTO A SUBTREE **/
+    [[nodiscard]] static auto assemble(node_type*& /* chain */, size_type /* count */,
+                                       size_type /* depth */, size_type /* red depth */)
+        noexcept(true) -> node_type*;
+
+
+private: /** BALANCING HELPERS **/
+
+    /** LINK A DETACHED NODE BELOW ITS IN-ORDER POSITION **/
+    void attach(node_type* /* node */) noexcept(true);
+
+    /** UNLINK A NODE FROM TREE AND FREE IT **/
+    void erase(node_type* /* node */) noexcept(std::is_nothrow_destructible<T>::value);
+
+    /**
+     * The structural helpers below take the root of the subtree they work
+     * on, so split and join can run them on detached subtrees as well.
+     * **/
+
+    /** REPLACE SUBTREE ROOTED AT FIRST NODE BY SUBTREE ROOTED AT SECOND **/
+    static void transplant(node_type*& /* root */, node_type* /* node */, node_type* /* with */) noexcept(true);
+
+    static void rotate_left(node_type*& /* root */, node_type* /* node */) noexcept(true);
+    static void rotate_right(node_type*& /* root */, node_type* /* node */) noexcept(true);
+
+    /** RESTORE RED-BLACK INVARIANTS AFTER INSERT / ERASE **/
+    static void insert_fixup(node_type*& /* root */, node_type* /* node */) noexcept(true);
+    static void erase_fixup(node_type*& /* root */, node_type* /* node */, node_type* /* parent */) noexcept(true);
+
+    [[nodiscard]] static constexpr auto is_red(node_type const* p_node) noexcept(true) -> bool
+    {
+        return (p_node != nullptr) && p_node->m_red;
+    }
+
+    [[nodiscard]] static constexpr auto subtree_size(node_type const* p_node) noexcept(true) -> size_type
+    {
+        return (p_node != nullptr) ? p_node->m_count : 0ul;
+    }
+
+    /** RECOMPUTE SUBTREE SIZE FROM THE CHILDREN **/
+    static constexpr void resize(node_type* p_node) noexcept(true)
+    {
+        p_node->m_count = subtree_size(p_node->m_left) + subtree_size(p_node->m_right) + 1ul;
+    }
+
+
+private: /** SPLIT & JOIN HELPERS **/
+
+    /**
+     * Every subtree handed between these helpers is standalone: null parent
+     * and a black root, so its black height can be read off the left spine.
+     * They only exist for red-black trees, where recursing once per level
+     * stays within O(log n) frames.
+     * **/
+
+    /** CUT A CHILD LOOSE AS A STANDALONE SUBTREE **/
+    static auto detach(node_type* /* node */) noexcept(true) -> node_type*;
+
+    /** BLACK NODES ON ANY ROOT-TO-LEAF PATH **/
+    [[nodiscard]] static auto black_height(node_type const* /* root */) noexcept(true) -> size_type;
+
+    /** LEFT, NODE, RIGHT ( in that order ) AS ONE BALANCED SUBTREE **/
+    [[nodiscard]] static auto concat(node_type* /* left */, node_type* /* node */,
+                                     node_type* /* right */) noexcept(true) -> node_type*
+        requires(std::same_as<Balance, red_black>);
+
+    /** LEFT, RIGHT ( in that order ) AS ONE BALANCED SUBTREE **/
+    [[nodiscard]] static auto concat(node_type* /* left */, node_type* /* right */) noexcept(true) -> node_type*
+        requires(std::same_as<Balance, red_black>);
+
+    /** SPLIT OFF THE GREATEST NODE: ( rest, node ) **/
+    [[nodiscard]] static auto split_last(node_type* /* root */) noexcept(true)
+        -> std::pair<node_type*, node_type*>
+        requires(std::same_as<Balance, red_black>);
+
+    /** KEYS SATISFYING THE PREDICATE ( a prefix of the order ) GO LEFT, THE OTHERS RIGHT **/
+    template <class P>
+    [[nodiscard]] static auto split_by(node_type* /* root */, P const& /* pred */) noexcept(true)
+        -> std::pair<node_type*, node_type*>
+        requires(std::same_as<Balance, red_black>);
+
+    /** KEYS LESS THAN, EQUAL TO AND GREATER THAN KEY **/
+    [[nodiscard]] static auto split3(node_type* /* root */, T const& /* key */) noexcept(true)
+        -> std::tuple<node_type*, node_type*, node_type*>
+        requires(std::same_as<Balance, red_black>);
+
+    static void destroy(node_allocator_type& /* alloc */, node_type* /* root */)
+        noexcept(std::is_nothrow_destructible<T>::value);
+
+    /** TAKE THE NODES OUT, LEAVING THE TREE EMPTY **/
+    [[nodiscard]] auto release() noexcept(true) -> node_type*;
+
+    /** TAKE THE NODES OF ANOTHER TREE, COPIED WHEN OUR ALLOCATOR CANNOT FREE THEM **/
+    [[nodiscard]] auto transfer(binary_search_tree& /* other */)
+        noexcept(std::is_nothrow_copy_constructible<T>::value) -> node_type*;
+
+    /** WRAP A STANDALONE SUBTREE MADE BY ALLOC **/
+    [[nodiscard]] static auto adopt(node_type* /* root */, node_allocator_type const& /* alloc */)
+        noexcept(true) -> binary_search_tree;
+
+
+private: /** SET ALGEBRA HELPERS ( consume both operands ) **/
+
+    /** below this many keys per half, a fork costs more than it saves **/
+    static constexpr size_type parallel_grain = 1ul << 14;
+
+    [[nodiscard]] static auto unite(node_allocator_type& /* alloc */, node_type* /* lhs */,
+                                    node_type* /* rhs */, size_type /* depth */)
+        noexcept(std::is_nothrow_destructible<T>::value) -> node_type*
+        requires(std::same_as<Balance, red_black>);
+
+    [[nodiscard]] static auto intersect(node_allocator_type& /* alloc */, node_type* /* lhs */,
+                                    node_type* /* rhs */, size_type /* depth */)
+        noexcept(std::is_nothrow_destructible<T>::value) -> node_type*
+        requires(std::same_as<Balance, red_black>);
+
+    [[nodiscard]] static auto subtract(node_allocator_type& /* alloc */, node_type* /* lhs */,
+                                    node_type* /* rhs */, size_type /* depth */)
+        noexcept(std::is_nothrow_destructible<T>::value) -> node_type*
+        requires(std::same_as<Balance, red_black>);
+
+    /**
+     * RUN BOTH HALVES, THE LEFT ONE AS A shared_scheduler() TASK WHEN BOTH ARE LARGE
+     * (Only allocators that are always equal are shared across threads;
+     *  a stateful one, e.g. a std::pmr resource, keeps the work serial)
+     * **/
+    template <class L, class R>
+    [[nodiscard]] static auto fork(size_type /* depth */, size_type /* left keys */, size_type /* right keys */,
+                                   L&& /* left */, R&& /* right */) noexcept(true)
+        -> std::pair<node_type*, node_type*>
+        requires(std::same_as<Balance, red_black>);
+
 
 private:
     node_type* m_root {};
     size_type  m_size {};
+
+    [[no_unique_address]] node_allocator_type m_alloc;
 };
 
 /** END TREE **/
 
 // //
 
-template <std::totally_ordered T>
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
 template <std::ranges::range R>
-binary_search_tree<T>::binary_search_tree(R&& p_range)
+binary_search_tree<T, Balance, Allocator>::binary_search_tree(R&& p_range, Allocator const& p_alloc)
         noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
-        requires(std::is_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(non_self<R, binary_search_tree> &&
+                 std::is_constructible<T, std::ranges::range_value_t<R>>::value)
     : binary_search_tree(std::ranges::begin(p_range),
-                         std::ranges::end(p_range))
+                         std::ranges::end(p_range), p_alloc)
 {
 }
 
-template <std::totally_ordered T>
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
 template <std::input_iterator I, std::sentinel_for<I> S>
-binary_search_tree<T>::binary_search_tree(I p_begin, S p_end)
+binary_search_tree<T, Balance, Allocator>::binary_search_tree(I p_begin, S p_end, Allocator const& p_alloc)
         noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
         requires(std::is_constructible<T, std::iter_value_t<I>>::value)
-    : binary_search_tree()
+    : binary_search_tree(p_alloc)
 {
+    // no sortedness probe here: sorted input takes the sorted_range ctors
     using std::placeholders::_1;
 
     auto lambda =
@@ -290,109 +825,220 @@ binary_search_tree<T>::binary_search_tree(I p_begin, S p_end)
     std::ranges::for_each(p_begin, p_end, std::bind(lambda, this, _1));
 }
 
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+template <std::ranges::range R>
+binary_search_tree<T, Balance, Allocator>::binary_search_tree(sorted_range_t, R&& p_range, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_reference_t<R>>::value)
+    : binary_search_tree(sorted_range, std::ranges::begin(p_range),
+                         std::ranges::end(p_range), p_alloc)
+{
+}
 
-template <std::totally_ordered T>
-template <class U>
-void binary_search_tree<T>::insert(U&& p_data)
-    noexcept(std::is_nothrow_constructible<T, U>::value)
-    requires(std::is_constructible<T, U>::value)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+template <std::input_iterator I, std::sentinel_for<I> S>
+binary_search_tree<T, Balance, Allocator>::binary_search_tree(sorted_range_t, I p_begin, S p_end, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value)
+        requires(std::is_constructible<T, std::iter_reference_t<I>>::value)
+    : binary_search_tree(p_alloc)
 {
-    if (auto v_node = new (std::nothrow) node_type(std::forward<U>(p_data)))
+    bulk_load(p_begin, p_end);
+}
+
+
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+template <class K>
+auto binary_search_tree<T, Balance, Allocator>::find(K const& p_key) const noexcept(true)
+    -> const_iterator
+    requires(std::totally_ordered_with<T, K>)
+{
+    node_type* v_current = m_root;
+    size_type  v_depth   = 0ul;
+
+    while (v_current != nullptr)
     {
-        if (not m_root)
+        v_depth = v_depth + 1ul;
+
+        if (p_key < v_current->m_data)
         {
-            m_root = v_node;
-            m_size = m_size + 1ul;
-            return;
+            v_current = v_current->m_left;
         }
+        else if (v_current->m_data < p_key) {
+            v_current = v_current->m_right;
+        }
+        else break;
+    }
+
+    stats_searched<node_allocator_type>(v_depth);
+
+    return const_iterator{v_current, &m_root};
+}
+
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+template <class K>
+auto binary_search_tree<T, Balance, Allocator>::contains(K const& p_key) const noexcept(true)
+    -> bool
+    requires(std::totally_ordered_with<T, K>)
+{
+    return (find(p_key) != end());
+}
+
+
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+template <std::input_iterator I, std::sentinel_for<I> S>
+void binary_search_tree<T, Balance, Allocator>::bulk_load(I p_begin, S p_end)
+    noexcept(std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value)
+{
+    // with a pooling allocator the whole batch is set aside up front
+    if constexpr (std::sized_sentinel_for<S, I>)
+    {
+        reserve_nodes(m_alloc, static_cast<size_type>(p_end - p_begin));
+    }
 
-        node_type *v_current = m_root, *v_parent = nullptr;
+    // one pass allocates every node and threads them in input order
+    // through m_right; a failed allocation keeps the prefix built so far
+    node_type *v_chain = nullptr, *v_tail = nullptr;
+    size_type  v_count = 0ul;
 
-        while (v_current != nullptr)
+    auto v_thread = [&]() -> void
+    {
+        for (; p_begin != p_end; ++p_begin)
         {
-            v_parent = v_current;
+            auto v_node = allocate_node<node_type>(m_alloc, std::in_place, *p_begin);
 
-            if (p_data <= v_current->m_data)
+            if (not v_node) break;
+
+            if (v_tail != nullptr)
             {
-                v_current = v_current->m_left;
+                v_tail->m_right = v_node;
             }
             else {
-                v_current = v_current->m_right;
+                v_chain = v_node;
             }
-        }
-
-        v_node->m_parent = v_parent;
 
-        if (not v_parent)
-        {
-            v_parent = v_node;
-            m_size = m_size + 1ul;
-            return;
+            v_tail  = v_node;
+            v_count = v_count + 1ul;
         }
+    };
 
-        if (p_data <= v_parent->m_data)
-        {
-            v_parent->m_left = v_node;
+    if constexpr (std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value)
+    {
+        v_thread();
+    }
+    else {
+        // a key that fails to copy takes the chain built so far with it
+        try {
+            v_thread();
         }
-        else {
-            v_parent->m_right = v_node;
+        catch (...) {
+            while (v_chain != nullptr)
+            {
+                deallocate_node(m_alloc, std::exchange(v_chain, v_chain->m_right));
+            }
+
+            throw;
         }
+    }
+
+    // nodes below the last complete level are red, which gives every
+    // root-to-leaf path the same number of black nodes
+    size_type v_red_depth = 0ul;
 
-        m_size = m_size + 1ul;
+    while ((2ul << v_red_depth) <= (v_count + 1ul))
+        v_red_depth = v_red_depth + 1ul;
+
+    m_root = assemble(v_chain, v_count, 0ul, v_red_depth);
+    m_size = v_count;
+}
+
+
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+template <class U>
+void binary_search_tree<T, Balance, Allocator>::insert(U&& p_data)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    if (auto v_node = allocate_node<node_type>(m_alloc, std::forward<U>(p_data)))
+    {
+        attach(v_node);
     }
 }
 
-template <std::totally_ordered T>
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
 template <class... Args>
-void binary_search_tree<T>::emplace(Args&&... p_args)
+void binary_search_tree<T, Balance, Allocator>::emplace(Args&&... p_args)
     noexcept( std::is_nothrow_constructible<T, Args...>::value)
 {
-    if (auto v_node = new (std::nothrow)
-            node_type(std::in_place, std::forward<Args>(p_args)...))
+    if (auto v_node = allocate_node<node_type>(m_alloc, std::in_place, std::forward<Args>(p_args)...))
     {
-        if (not m_root)
-        {
-            m_root = v_node;
-            m_size = m_size + 1ul;
-            return;
-        }
+        attach(v_node);
+    }
+}
 
-        node_type *v_current = m_root, *v_parent = nullptr;
 
-        while (v_current != nullptr)
-        {
-            v_parent = v_current;
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+template <class P>
+auto binary_search_tree<T, Balance, Allocator>::split_by(node_type* p_root, P const& p_pred) noexcept(true)
+    -> std::pair<node_type*, node_type*>
+    requires(std::same_as<Balance, red_black>)
+{
+    if (not p_root) return {nullptr, nullptr};
 
-            if (v_node->m_data <= v_current->m_data)
-            {
-                v_current = v_current->m_left;
-            }
-            else {
-                v_current = v_current->m_right;
-            }
-        }
+    node_type* v_left  = detach(p_root->m_left);
+    node_type* v_right = detach(p_root->m_right);
 
-        v_node->m_parent = v_parent;
+    if (p_pred(p_root->m_data))
+    {
+        auto [v_less, v_rest] = split_by(v_right, p_pred);
 
-        if (not v_parent)
-        {
-            v_parent = v_node;
-            m_size = m_size + 1ul;
-            return;
-        }
+        return {concat(v_left, p_root, v_less), v_rest};
+    }
 
-        if (v_node->m_data <= v_parent->m_data)
-        {
-            v_parent->m_left = v_node;
+    auto [v_less, v_rest] = split_by(v_left, p_pred);
+
+    return {v_less, concat(v_rest, p_root, v_right)};
+}
+
+
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+template <class L, class R>
+auto binary_search_tree<T, Balance, Allocator>::fork(size_type p_depth, size_type p_left_keys, size_type p_right_keys,
+                                                     L&& p_left, R&& p_right) noexcept(true)
+    -> std::pair<node_type*, node_type*>
+    requires(std::same_as<Balance, red_black>)
+{
+    // small halves never start the scheduler
+    if ((alloc_traits::is_always_equal::value) &&
+        (p_left_keys >= parallel_grain) && (p_right_keys >= parallel_grain))
+    {
+        task_scheduler& v_scheduler = shared_scheduler();
+
+        // every level doubles the tasks; stop a little past the worker count
+        size_type const v_max_depth = std::bit_width(v_scheduler.workers()) + 1ul;
+
+        std::future<node_type*> v_left;
+
+        try {
+            if (p_depth < v_max_depth) v_left = v_scheduler.submit([&p_left] { return p_left(); });
         }
-        else {
-            v_parent->m_right = v_node;
+        catch (std::bad_alloc const&) {
+            // the task could not be queued: the left half has not run, do it here
         }
 
-        m_size = m_size + 1ul;
+        if (v_left.valid())
+        {
+            node_type* v_right = p_right();
+
+            return {v_scheduler.join(v_left), v_right};
+        }
     }
+
+    node_type* v_left = p_left();
+
+    return {v_left, p_right()};
 }
 
+
 /** USER DEFINED TYPE DEDUCTION **/
 template <std::ranges::range R>
 binary_search_tree(R) -> binary_search_tree<std::ranges::range_value_t<R>>;
@@ -401,6 +1047,22 @@ template <std::input_iterator I, std::sentinel_for<I> S>
 binary_search_tree(I, S) -> binary_search_tree<std::iter_value_t<I>>;
 
 
+/** SELF-BALANCING VARIANT **/
+template <std::totally_ordered T, class Allocator = std::allocator<T>>
+using red_black_tree = binary_search_tree<T, red_black, Allocator>;
+
+
+/** POLYMORPHIC ALLOCATOR ALIASES **/
+namespace pmr
+{
+    template <std::totally_ordered T, balance_policy Balance = unbalanced>
+    using binary_search_tree = ::binary_search_tree<T, Balance, std::pmr::polymorphic_allocator<T>>;
+
+    template <std::totally_ordered T>
+    using red_black_tree = ::binary_search_tree<T, red_black, std::pmr::polymorphic_allocator<T>>;
+}
+
+
 extern template class binary_search_tree<int>;
 extern template class binary_search_tree<char>;
 extern template class binary_search_tree<long>;
@@ -413,4 +1075,16 @@ extern template class binary_search_tree<float>;
 extern template class binary_search_tree<double>;
 extern template class binary_search_tree<std::string>;
 
+extern template class binary_search_tree<int, red_black>;
+extern template class binary_search_tree<char, red_black>;
+extern template class binary_search_tree<long, red_black>;
+extern template class binary_search_tree<short, red_black>;
+extern template class binary_search_tree<unsigned int, red_black>;
+extern template class binary_search_tree<unsigned char, red_black>;
+extern template class binary_search_tree<unsigned long, red_black>;
+extern template class binary_search_tree<unsigned short, red_black>;
+extern template class binary_search_tree<float, red_black>;
+extern template class binary_search_tree<double, red_black>;
+extern template class binary_search_tree<std::string, red_black>;
+
 #endif
\ No newline at end of file
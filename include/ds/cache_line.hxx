@@ -0,0 +1,15 @@
+#ifndef CACHE_LINE_HXX
+#define CACHE_LINE_HXX
+
+#include <cstddef>
+
+
+/**
+ * Alignment that keeps atomics written by different threads off each
+ * other's cache line. A fixed value on purpose: the standard's
+ * hardware_destructive_interference_size may differ between compilers
+ * and flags, which would change the layout of the concurrent containers.
+ * **/
+inline constexpr std::size_t cache_line_size = 64ul;
+
+#endif
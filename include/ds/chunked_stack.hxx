@@ -0,0 +1,378 @@
+#ifndef CHUNKED_STACK_HXX
+#define CHUNKED_STACK_HXX
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <utility>
+
+#include <ds/node_allocator.hxx>
+
+
+template <class T, class = std::allocator<T>> class chunked_stack;
+
+
+/** START BLOCK **/
+
+/**
+ * Fixed size run of raw slots, linked towards the bottom of the stack.
+ * Slots are constructed and destroyed by the owning chunked_stack.
+ * **/
+template <class T> class chunked_block final
+{
+
+public:
+    template <class, class> friend class chunked_stack;
+
+public:
+    /** roughly one page per block, never fewer than 8 slots **/
+    static constexpr std::size_t capacity = std::max<std::size_t>(8ul, (4096ul - sizeof(void*)) / sizeof(T));
+
+
+public: /** CONSTRUCTORS **/
+    /** DEFAULT CTOR ( slots stay raw ) **/
+    chunked_block() noexcept(true) {}
+
+    chunked_block(chunked_block const&) = delete;
+
+    auto operator=(chunked_block const&) -> chunked_block& = delete;
+
+
+private:
+    auto slot(std::size_t p_index) noexcept(true) -> T*
+    {
+        return reinterpret_cast<T*>(m_storage + p_index * sizeof(T));
+    }
+
+    auto at(std::size_t p_index) const noexcept(true) -> T const*
+    {
+        return std::launder(reinterpret_cast<T const*>(m_storage + p_index * sizeof(T)));
+    }
+
+    auto at(std::size_t p_index) noexcept(true) -> T*
+    {
+        return std::launder(slot(p_index));
+    }
+
+private:
+    chunked_block* m_prev {};
+
+    alignas(T) std::byte m_storage[capacity * sizeof(T)];
+};
+
+/** END BLOCK **/
+
+
+
+/** START CHUNKED STACK **/
+
+/**
+ * LIFO stack over linked blocks of contiguous slots ( an unrolled stack ).
+ *
+ * Same interface as stack, but elements sit next to each other and only
+ * one link is paid per block. The last block emptied is kept as a spare,
+ * so pushing and popping across a block boundary does not allocate.
+ * **/
+template <class T, class Allocator> class chunked_stack final
+{
+
+public: /** TYPE ALIAS **/
+    using block_type = chunked_block<T>;
+
+private: /** TYPE ALIAS **/
+    using block_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<block_type>;
+    using alloc_traits         = std::allocator_traits<Allocator>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using size_type       = std::size_t;
+    using allocator_type  = Allocator;
+
+    static constexpr size_type block_capacity = block_type::capacity;
+
+
+public: /** CONSTRUCTORS **/
+
+
+    /** DEFAULT CTOR **/
+    chunked_stack() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** ALLOCATOR CTOR **/
+    explicit chunked_stack(Allocator const &) noexcept(true);
+
+    /** COPY CTOR **/
+    chunked_stack(chunked_stack const &) noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                                                  std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** COPY CTOR ( allocator-extended ) **/
+    chunked_stack(chunked_stack const &, Allocator const &) noexcept(std::is_nothrow_copy_constructible<T>::value);
+
+    /** MOVE CTOR **/
+    chunked_stack(chunked_stack &&) noexcept(true);
+
+    /**
+    * RANGE CTOR
+    * (Construct with the contents of the range [ begin, end ])
+    * **/
+    template <std::input_iterator I, std::sentinel_for<I> S>
+    chunked_stack(I, S, Allocator const & = Allocator()) noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+        requires(std::is_constructible<T, std::iter_value_t<I>>::value);
+
+    /**
+    * RANGE CTOR
+    * (Construct with the contents of the range)
+    * **/
+    template <std::ranges::range R>
+    chunked_stack(R &&, Allocator const & = Allocator()) noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_value_t<R>>::value);
+
+
+    /**
+    * ASSIGNMENT OP
+    * ( copy-swap idiom )
+    * **/
+    auto operator=(chunked_stack) noexcept(std::is_nothrow_copy_constructible<T>::value) -> chunked_stack &;
+
+
+public:
+    template <class U>
+    void push_front(U &&) noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    template <class U>
+    void push(U &&) noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+
+    template <class... ARGS>
+    void emplace_front(ARGS &&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+    template <class... ARGS>
+    void emplace(ARGS &&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+
+public:
+    void pop_front() noexcept(std::is_nothrow_destructible<T>::value);
+    void pop() noexcept(std::is_nothrow_destructible<T>::value);
+
+    /** MOVE THE TOP ELEMENT OUT AND POP IT, std::nullopt WHEN EMPTY **/
+    [[nodiscard]] auto try_pop() noexcept(std::is_nothrow_move_constructible<T>::value) -> std::optional<value_type>;
+
+
+public:
+    [[nodiscard]] auto peep() const noexcept(true) -> std::optional<value_type>;
+    [[nodiscard]] auto peep()       noexcept(true) -> std::optional<value_type>;
+
+    /** THE TOP ELEMENT IN PLACE, nullptr WHEN EMPTY ( valid until it is popped ) **/
+    [[nodiscard]] auto peep_ptr() const noexcept(true) -> const_pointer;
+    [[nodiscard]] auto peep_ptr()       noexcept(true) -> pointer;
+
+
+public:
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+
+public:
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+    /** GIVE THE SPARE BLOCK BACK **/
+    void shrink_to_fit() noexcept(true);
+
+
+public:
+    ~chunked_stack() noexcept(std::is_nothrow_destructible<T>::value);
+
+
+public:
+
+
+    friend void swap(chunked_stack &p_lhs, chunked_stack &p_rhs) noexcept(true)
+    {
+        std::swap(p_lhs.m_top,   p_rhs.m_top);
+        std::swap(p_lhs.m_used,  p_rhs.m_used);
+        std::swap(p_lhs.m_spare, p_rhs.m_spare);
+        std::swap(p_lhs.m_size,  p_rhs.m_size);
+        swap_allocators(p_lhs.m_alloc, p_rhs.m_alloc);
+    }
+
+
+    void debug() const noexcept(true)
+    {
+        block_type const* v_block = m_top;
+        size_type         v_used  = m_used;
+
+        while (v_block)
+        {
+            while (v_used) std::cout << *v_block->at(--v_used) << ' ';
+
+            v_block = v_block->m_prev;
+            v_used  = block_capacity;
+        }
+
+        std::cout << std::endl;
+    }
+
+
+private:
+    /** SLOT FOR THE NEXT ELEMENT, LINKING A FRESH BLOCK WHEN THE TOP ONE IS FULL **/
+    [[nodiscard]] auto make_room() noexcept(true) -> T*;
+
+    /** UNLINK THE ( EMPTY ) TOP BLOCK AND KEEP IT AS THE SPARE **/
+    void drop_top() noexcept(true);
+
+    template <class... ARGS>
+    void construct_top(ARGS &&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+
+private:
+    block_type* m_top   {};
+    size_type   m_used  {};     /** live slots in m_top **/
+    block_type* m_spare {};
+    size_type   m_size  {};
+
+    [[no_unique_address]] block_allocator_type m_alloc;
+};
+
+/** END CHUNKED STACK **/
+
+
+
+/****/
+//  //
+/****/
+
+
+template <class T, class Allocator>
+template <std::input_iterator I, std::sentinel_for<I> S>
+chunked_stack<T, Allocator>::chunked_stack(I p_begin, S p_end, Allocator const &p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+        requires(std::is_constructible<T, std::iter_value_t<I>>::value)
+    : chunked_stack(p_alloc)
+{
+    using std::placeholders::_1;
+
+    auto lambda = &chunked_stack::template push_front<std::iter_reference_t<I>>;
+
+    std::ranges::for_each(p_begin, p_end, std::bind(lambda, this, _1));
+}
+
+
+template <class T, class Allocator>
+template <std::ranges::range R>
+chunked_stack<T, Allocator>::chunked_stack(R &&p_container, Allocator const &p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_value_t<R>>::value)
+    : chunked_stack(std::ranges::begin(p_container), std::ranges::end(p_container), p_alloc)
+{}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void chunked_stack<T, Allocator>::construct_top(ARGS &&...p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    T* v_slot = make_room();
+
+    if (v_slot == nullptr) return;
+
+    Allocator v_alloc(m_alloc);
+
+    if constexpr (std::is_nothrow_constructible<T, ARGS...>::value)
+    {
+        alloc_traits::construct(v_alloc, v_slot, std::forward<ARGS>(p_args)...);
+    }
+    else {
+        try {
+            alloc_traits::construct(v_alloc, v_slot, std::forward<ARGS>(p_args)...);
+        }
+        catch (...) {
+            if (m_used == 0ul) drop_top();
+            throw;
+        }
+    }
+
+    m_used = m_used + 1ul;
+    m_size = m_size + 1ul;
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void chunked_stack<T, Allocator>::push_front(U &&p_value) noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    construct_top(std::forward<U>(p_value));
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void chunked_stack<T, Allocator>::push(U &&p_value) noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    push_front(std::forward<U>(p_value));
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void chunked_stack<T, Allocator>::emplace_front(ARGS &&...p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    construct_top(std::forward<ARGS>(p_args)...);
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void chunked_stack<T, Allocator>::emplace(ARGS &&...p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    emplace_front(std::forward<ARGS>(p_args)...);
+}
+
+
+
+/** USER DEFINED TYPE DEDUCTION **/
+template <std::ranges::range R>
+chunked_stack( R ) -> chunked_stack<std::ranges::range_value_t<R>>;
+
+template <std::input_iterator I, std::sentinel_for<I> S>
+chunked_stack( I, S ) -> chunked_stack<std::iter_value_t<I>>;
+
+
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <class T>
+    using chunked_stack = ::chunked_stack<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+extern template class chunked_stack<int>;
+extern template class chunked_stack<char>;
+extern template class chunked_stack<long>;
+extern template class chunked_stack<short>;
+extern template class chunked_stack<unsigned int>;
+extern template class chunked_stack<unsigned char>;
+extern template class chunked_stack<unsigned long>;
+extern template class chunked_stack<unsigned short>;
+extern template class chunked_stack<float>;
+extern template class chunked_stack<double>;
+extern template class chunked_stack<std::string>;
+
+#endif
@@ -0,0 +1,329 @@
+#ifndef CONCURRENT_STACK_HXX
+#define CONCURRENT_STACK_HXX
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <ds/cache_line.hxx>
+#include <ds/node_allocator.hxx>
+#include <ds/output_sink.hxx>
+
+
+/** START CONSTRAINTS **/
+
+/** a popped node is already unlinked when its element moves out, a throwing move would lose it **/
+template <class T>
+concept concurrent_stack_value = std::is_nothrow_move_constructible<T>::value && std::is_nothrow_destructible<T>::value;
+
+/** END CONSTRAINTS **/
+
+
+template <concurrent_stack_value T, class = std::allocator<T>> class concurrent_stack;
+
+
+/** START NODE **/
+
+template <class T> class concurrent_node final
+{
+
+public:
+    template <concurrent_stack_value, class> friend class concurrent_stack;
+
+public: /** CONSTRUCTORS **/
+    /** DEFAULT CTOR ( no element, the storage is filled once the node is linked in ) **/
+    concurrent_node() noexcept(true) = default;
+
+    concurrent_node(concurrent_node const&) = delete;
+
+    auto operator=(concurrent_node const&) -> concurrent_node& = delete;
+
+
+private:
+    auto data() noexcept(true) -> T*
+    {
+        return std::launder(reinterpret_cast<T*>(m_storage));
+    }
+
+private:
+    /**
+     * atomic because a losing pop may still read it after the node
+     * went back to the free list and got relinked by somebody else
+     * **/
+    std::atomic<concurrent_node*> m_next {};
+
+    alignas(T) std::byte m_storage[sizeof(T)];
+};
+
+/** END NODE **/
+
+
+
+/** START CONCURRENT STACK **/
+
+/**
+ * Lock-free LIFO for any number of threads ( Treiber stack ).
+ *
+ * The top is a ( pointer, tag ) pair swapped with a double-width CAS; the
+ * tag moves on every change, so a pop that read a top which has since
+ * been popped and pushed back ( ABA ) fails its CAS instead of linking in
+ * a stale next pointer.
+ *
+ * Popped nodes are not freed but kept on a second tagged stack and reused
+ * by later pushes: a pop that lost a race may still read the next pointer
+ * of a node somebody else just took, so node memory lives as long as the
+ * stack does ( or until shrink_to_fit ). In steady state push and pop do
+ * not touch the allocator at all.
+ *
+ * The allocator is shared by all threads and must be safe to call
+ * concurrently ( std::allocator, std::pmr::synchronized_pool_resource ).
+ * **/
+template <concurrent_stack_value T, class Allocator> class concurrent_stack final
+{
+
+public: /** TYPE ALIAS **/
+    using node_type = concurrent_node<T>;
+
+private: /** TYPE ALIAS **/
+    using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+    using node_traits         = std::allocator_traits<node_allocator_type>;
+    using alloc_traits        = std::allocator_traits<Allocator>;
+
+    /** TOP OF A CHAIN, PAIRED WITH ITS CHANGE COUNT **/
+    struct alignas(2ul * sizeof(void*)) tagged_ptr
+    {
+        node_type*     m_ptr {};
+        std::uintptr_t m_tag {};
+    };
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using size_type       = std::size_t;
+    using allocator_type  = Allocator;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    concurrent_stack() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** ALLOCATOR CTOR **/
+    explicit concurrent_stack(Allocator const&) noexcept(true);
+
+    concurrent_stack(concurrent_stack const&) = delete;
+
+    auto operator=(concurrent_stack const&) -> concurrent_stack& = delete;
+
+
+public:
+    /** ( dropped when no node could be allocated ) **/
+    template <class U>
+    void push(U&&) noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    template <class... ARGS>
+    void emplace(ARGS&&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+
+public:
+    [[nodiscard]] auto try_pop() noexcept(true) -> std::optional<value_type>;
+
+    /**
+    * DETACH THE WHOLE STACK WITH ONE CAS
+    * ( elements are moved into `out` top first, returns how many; when
+    * the sink throws, what was not moved out yet goes back on the stack )
+    * **/
+    template <std::weakly_incrementable O>
+    auto pop_all(O /* out */) noexcept(nothrow_sink<O, T>) -> size_type
+        requires(std::indirectly_writable<O, T&&>);
+
+
+public: /** SNAPSHOT **/
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+
+public:
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+
+public: /** FREE NODES **/
+    /** put `count` more free nodes aside, so as many pushes need no allocation **/
+    void reserve(size_type /* count */) noexcept(true);
+
+    /** hand the free nodes back to the allocator ( only while no other thread uses the stack ) **/
+    void shrink_to_fit() noexcept(true);
+
+
+public:
+    ~concurrent_stack() noexcept(true);
+
+
+private:
+    /** A FREE NODE, RECYCLED OR FRESH; nullptr WHEN OUT OF MEMORY **/
+    [[nodiscard]] auto acquire_node() noexcept(true) -> node_type*;
+
+    /** LINK THE CHAIN [ first, last ] ON TOP OF `top` **/
+    static void link(std::atomic<tagged_ptr>& /* top */, node_type* /* first */, node_type* /* last */) noexcept(true);
+
+    /** TAKE THE TOP NODE OFF `top`, nullptr WHEN EMPTY **/
+    [[nodiscard]] static auto unlink(std::atomic<tagged_ptr>& /* top */) noexcept(true) -> node_type*;
+
+    /** TAKE THE WHOLE CHAIN OFF `top` **/
+    [[nodiscard]] static auto unlink_all(std::atomic<tagged_ptr>& /* top */) noexcept(true) -> node_type*;
+
+
+private:
+    alignas(cache_line_size) std::atomic<tagged_ptr> m_head {};
+
+    alignas(cache_line_size) std::atomic<tagged_ptr> m_free {};
+
+    [[no_unique_address]] node_allocator_type m_alloc;
+};
+
+/** END CONCURRENT STACK **/
+
+
+/** **/
+//  //
+/** **/
+
+
+template <concurrent_stack_value T, class Allocator>
+template <class... ARGS>
+void concurrent_stack<T, Allocator>::emplace(ARGS&&... p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    node_type* v_node = acquire_node();
+
+    if (v_node == nullptr) return;
+
+    Allocator v_alloc(m_alloc);
+
+    if constexpr (std::is_nothrow_constructible<T, ARGS...>::value)
+    {
+        alloc_traits::construct(v_alloc, v_node->data(), std::forward<ARGS>(p_args)...);
+    }
+    else {
+        try {
+            alloc_traits::construct(v_alloc, v_node->data(), std::forward<ARGS>(p_args)...);
+        }
+        catch (...) {
+            link(m_free, v_node, v_node);
+            throw;
+        }
+    }
+
+    link(m_head, v_node, v_node);
+}
+
+
+template <concurrent_stack_value T, class Allocator>
+template <class U>
+void concurrent_stack<T, Allocator>::push(U&& p_value)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    emplace(std::forward<U>(p_value));
+}
+
+
+template <concurrent_stack_value T, class Allocator>
+template <std::weakly_incrementable O>
+auto concurrent_stack<T, Allocator>::pop_all(O p_out) noexcept(nothrow_sink<O, T>) -> size_type
+    requires(std::indirectly_writable<O, T&&>)
+{
+    node_type* v_first = unlink_all(m_head);
+
+    if (v_first == nullptr) return 0ul;
+
+    Allocator v_alloc(m_alloc);
+
+    node_type* v_node  = v_first;
+    node_type* v_last  = nullptr;
+    size_type  v_count = 0ul;
+
+    // the chain is ours now: plain walk, then back to the free list in one go
+    auto v_drain = [&]() -> void
+    {
+        for (;;)
+        {
+            T* v_elem = v_node->data();
+
+            *p_out = std::move(*v_elem);
+
+            alloc_traits::destroy(v_alloc, v_elem);
+
+            v_last  = v_node;
+            v_node  = v_node->m_next.load(std::memory_order_relaxed);
+            v_count = v_count + 1ul;
+
+            if (v_node == nullptr) break;
+
+            ++p_out;
+        }
+    };
+
+    if constexpr (nothrow_sink<O, T>)
+    {
+        v_drain();
+    }
+    else {
+        try {
+            v_drain();
+        }
+        catch (...) {
+            // the rest ( from the element whose write threw ) goes back on top, in order
+            node_type* v_tail = v_node;
+
+            while (node_type* v_next = v_tail->m_next.load(std::memory_order_relaxed))
+            {
+                v_tail = v_next;
+            }
+
+            link(m_head, v_node, v_tail);
+
+            if (v_last != nullptr) link(m_free, v_first, v_last);
+
+            throw;
+        }
+    }
+
+    link(m_free, v_first, v_last);
+
+    return v_count;
+}
+
+
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <concurrent_stack_value T>
+    using concurrent_stack = ::concurrent_stack<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+extern template class concurrent_stack<int>;
+extern template class concurrent_stack<char>;
+extern template class concurrent_stack<long>;
+extern template class concurrent_stack<short>;
+extern template class concurrent_stack<unsigned int>;
+extern template class concurrent_stack<unsigned char>;
+extern template class concurrent_stack<unsigned long>;
+extern template class concurrent_stack<unsigned short>;
+extern template class concurrent_stack<float>;
+extern template class concurrent_stack<double>;
+extern template class concurrent_stack<std::string>;
+
+#endif
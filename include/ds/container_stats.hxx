@@ -0,0 +1,167 @@
+#ifndef CONTAINER_STATS_HXX
+#define CONTAINER_STATS_HXX
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include <ds/cache_line.hxx>
+
+
+/**
+ * Runtime statistics of the containers, compiled in with DATA_L_STATS
+ * ( the CMake option of the same name defines it for the library and
+ * everything that links it ).
+ *
+ * Counters are kept per container type, keyed by the allocator a
+ * container draws its nodes or buffers from, so list<int> and
+ * pooled::list<int> are told apart. They are relaxed atomics on a cache
+ * line of their own; without DATA_L_STATS every hook is an empty inline
+ * function and no counter exists.
+ *
+ * Being per type, every count is summed over all the instances of that
+ * type: live and peak are the blocks held by all of them together, not
+ * by any one container.
+ * **/
+#ifdef DATA_L_STATS
+inline constexpr bool stats_enabled = true;
+#else
+inline constexpr bool stats_enabled = false;
+#endif
+
+
+/** SEARCH DEPTHS ARE BUCKETED BY LOG2: bucket b holds depths in [2^(b-1), 2^b), the last one everything deeper **/
+inline constexpr std::size_t stats_depth_buckets = 16ul;
+
+[[nodiscard]] constexpr auto stats_depth_bucket(std::size_t p_depth) noexcept(true) -> std::size_t
+{
+    return std::min(static_cast<std::size_t>(std::bit_width(p_depth)), stats_depth_buckets - 1ul);
+}
+
+
+/** LIVE COUNTERS OF ONE CONTAINER TYPE **/
+struct alignas(cache_line_size) stats_counters
+{
+    std::atomic<std::uint64_t> m_allocations {};
+    std::atomic<std::uint64_t> m_frees       {};
+    std::atomic<std::uint64_t> m_failed      {};
+    std::atomic<std::uint64_t> m_peak        {};
+    std::atomic<std::uint64_t> m_searches    {};
+    std::atomic<std::uint64_t> m_depth       {};
+
+    std::array<std::atomic<std::uint64_t>, stats_depth_buckets> m_depths {};
+};
+
+
+/** A SNAPSHOT OF ONE CONTAINER TYPE ( plain values, safe to keep ) **/
+struct container_stats
+{
+    std::string   m_name;
+    std::uint64_t m_allocations {};
+    std::uint64_t m_frees       {};
+    std::uint64_t m_failed      {};    // allocations that failed, the element was dropped
+    std::uint64_t m_live        {};    // blocks held right now, across every instance
+    std::uint64_t m_peak        {};    // most blocks held at once
+    std::uint64_t m_searches    {};    // key lookups ( search trees )
+    std::uint64_t m_depth       {};    // nodes visited by those lookups
+
+    std::array<std::uint64_t, stats_depth_buckets> m_depths {};    // lookups per log2 depth bucket
+
+    [[nodiscard]] auto average_search_depth() const noexcept(true) -> double
+    {
+        return (m_searches == 0ul) ? 0.0 : static_cast<double>(m_depth) / static_cast<double>(m_searches);
+    }
+};
+
+
+/** SNAPSHOT OF EVERY CONTAINER TYPE THAT HAS ALLOCATED, SORTED BY NAME ( empty without DATA_L_STATS ) **/
+[[nodiscard]] auto snapshot_stats() -> std::vector<container_stats>;
+
+/** START A NEW PERIOD: blocks held now stay counted as allocations, the peak restarts from them, the rest is zeroed **/
+void reset_stats() noexcept(true);
+
+/** THE SNAPSHOT AS ONE JSON ARRAY, ONE OBJECT PER CONTAINER TYPE **/
+void write_stats(std::ostream& /* out */, std::vector<container_stats> const& /* stats */);
+
+/** ADDS A CONTAINER TYPE TO THE SNAPSHOT; DONE ONCE PER TYPE BY stats_slot **/
+auto register_stats(std::type_info const& /* type */, stats_counters& /* counters */) -> bool;
+
+
+/** THE COUNTERS OF ONE KEY TYPE, LISTED BEFORE main() RUNS **/
+template <class Key>
+struct stats_slot final
+{
+    static inline constinit stats_counters s_counters {};
+
+    static inline bool const s_listed = register_stats(typeid(Key), s_counters);
+
+    [[nodiscard]] static auto counters() noexcept(true) -> stats_counters&
+    {
+        static_cast<void>(&s_listed);    // odr-use: instantiates the registration
+
+        return s_counters;
+    }
+};
+
+
+
+/** HOOKS ( no-ops without DATA_L_STATS ) **/
+
+template <class Key>
+inline void stats_allocated([[maybe_unused]] std::size_t p_count = 1ul) noexcept(true)
+{
+#ifdef DATA_L_STATS
+    stats_counters& v_counters = stats_slot<Key>::counters();
+
+    std::uint64_t v_allocated = v_counters.m_allocations.fetch_add(p_count, std::memory_order_relaxed) + p_count;
+    std::uint64_t v_freed     = v_counters.m_frees.load(std::memory_order_relaxed);
+
+    // another thread may have allocated and freed since the add; that read says nothing about the peak
+    if (v_freed >= v_allocated) return;
+
+    std::uint64_t v_held = v_allocated - v_freed;
+    std::uint64_t v_peak = v_counters.m_peak.load(std::memory_order_relaxed);
+
+    while (v_peak < v_held &&
+           not v_counters.m_peak.compare_exchange_weak(v_peak, v_held, std::memory_order_relaxed))
+    {
+    }
+#endif
+}
+
+template <class Key>
+inline void stats_freed([[maybe_unused]] std::size_t p_count = 1ul) noexcept(true)
+{
+#ifdef DATA_L_STATS
+    stats_slot<Key>::counters().m_frees.fetch_add(p_count, std::memory_order_relaxed);
+#endif
+}
+
+template <class Key>
+inline void stats_failed() noexcept(true)
+{
+#ifdef DATA_L_STATS
+    stats_slot<Key>::counters().m_failed.fetch_add(1ul, std::memory_order_relaxed);
+#endif
+}
+
+template <class Key>
+inline void stats_searched([[maybe_unused]] std::size_t p_depth) noexcept(true)
+{
+#ifdef DATA_L_STATS
+    stats_counters& v_counters = stats_slot<Key>::counters();
+
+    v_counters.m_searches.fetch_add(1ul, std::memory_order_relaxed);
+    v_counters.m_depth.fetch_add(p_depth, std::memory_order_relaxed);
+    v_counters.m_depths[stats_depth_bucket(p_depth)].fetch_add(1ul, std::memory_order_relaxed);
+#endif
+}
+
+#endif
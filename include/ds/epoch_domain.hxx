@@ -0,0 +1,117 @@
+#ifndef EPOCH_DOMAIN_HXX
+#define EPOCH_DOMAIN_HXX
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <ds/cache_line.hxx>
+
+
+/** START EPOCH DOMAIN **/
+
+/**
+ * Epoch based reclamation, for structures whose readers must not write
+ * to memory they share.
+ *
+ * A reader pins: it copies the global epoch into a slot that belongs to
+ * its thread ( a cache line nobody else writes ) and then reads the
+ * structure; unpinning clears the slot. A writer that unlinks memory
+ * retires it, stamped with the epoch of that moment. The epoch moves on
+ * only once every pinned slot shows its current value, so memory retired
+ * at epoch e is freed once the epoch reaches e + 2: by then no reader
+ * that could have reached it is still pinned.
+ *
+ * Pinning and unpinning are wait-free ( the first pin of a thread also
+ * lists its slot, under the mutex ). Retiring and freeing run under the
+ * mutex and are meant for writers. A pin belongs to the thread that took
+ * it and must be released there, before the thread ends.
+ *
+ * One domain serves the whole process: a pin held for long keeps back
+ * everything retired meanwhile, whichever structure retired it.
+ * **/
+class epoch_domain final
+{
+
+public: /** TYPE ALIAS **/
+    using epoch_type   = std::uint64_t;
+    using deleter_type = void (*)(void*) noexcept;
+
+
+public:
+    /** THE DOMAIN OF THE PROCESS ( never destroyed, so it outlives every static and thread ) **/
+    [[nodiscard]] static auto instance() noexcept(true) -> epoch_domain&;
+
+    epoch_domain(epoch_domain const&) = delete;
+
+    auto operator=(epoch_domain const&) -> epoch_domain& = delete;
+
+
+public:
+    /** PIN THE CALLING THREAD ( nested pins only count ) **/
+    void pin() noexcept(true);
+
+    /** DROP ONE PIN OF THE CALLING THREAD **/
+    void unpin() noexcept(true);
+
+    /**
+     * HAND OVER MEMORY NO LONGER REACHABLE FROM THE SHARED STRUCTURE
+     * (`deleter` frees it once no pinned reader can still hold it;
+     *  with no room to queue it, waits for the readers and frees it now)
+     * **/
+    void retire(void* /* pointer */, deleter_type /* deleter */) noexcept(true);
+
+    /** FREE WHATEVER IS SAFE TO FREE NOW **/
+    void collect() noexcept(true);
+
+
+private:
+    /** ONE PER THREAD THAT EVER PINNED, LISTED WHILE THE THREAD LIVES **/
+    struct alignas(cache_line_size) slot final
+    {
+        std::atomic<epoch_type> m_epoch {};    // 0: not pinned
+        std::uint32_t           m_pins  {};    // written by the owner thread only
+        slot*                   m_next  {};
+    };
+
+    struct retired final
+    {
+        void*        m_pointer;
+        deleter_type m_deleter;
+        epoch_type   m_epoch;
+    };
+
+    /** THREAD LOCAL OWNER OF A SLOT: LISTS IT, AND DELISTS IT WHEN THE THREAD ENDS **/
+    struct slot_holder;
+
+
+private:
+    epoch_domain() noexcept(true) = default;
+
+    /** THE SLOT OF THE CALLING THREAD, LISTED ON FIRST USE **/
+    [[nodiscard]] auto this_slot() noexcept(true) -> slot&;
+
+    void enlist(slot* /* slot */) noexcept(true);
+    void delist(slot* /* slot */) noexcept(true);
+
+    /** MOVE THE EPOCH ON IF EVERY PINNED SLOT HAS SEEN IT; CALLED UNDER THE MUTEX **/
+    auto advance() noexcept(true) -> bool;
+
+    /** FREE WHAT WAS RETIRED TWO EPOCHS AGO; CALLED UNDER THE MUTEX **/
+    void reclaim() noexcept(true);
+
+
+private:
+    /** starts at 1, a slot holding 0 is not pinned **/
+    alignas(cache_line_size) std::atomic<epoch_type> m_epoch {1ul};
+
+    std::mutex            m_mutex;
+    slot*                 m_slots {};
+    std::vector<retired>  m_retired;
+};
+
+/** END EPOCH DOMAIN **/
+
+#endif
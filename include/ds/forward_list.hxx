@@ -7,37 +7,29 @@
 #include <cassert>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <ranges>
 #include <type_traits>
 #include <utility>
 
+#include <ds/node_allocator.hxx>
+#include <ds/node_pool.hxx>
 
 
-template <typename> class forward_list;
-template <typename> class Iterator;
+template <typename T, typename = std::allocator<T>> class forward_list;
+template <typename> class forward_list_iterator;
 template <typename> class Sentinel;
 
 
-/** START CONCEPTS **/
-
-template <class T, class U>
-concept non_self = 
-        not std::is_same<std::decay_t<T>, U>::value &&
-        not std::is_base_of<U, std::decay_t<T>>::value;
-
-
-/* END CONSTRAINTS */
-
-
-
 //
-template <class T> class node final
+template <class T> class forward_list_node final
 {
 
 public:
-    friend class forward_list<T>;
-    friend class Iterator<T>;
+    template <class, class> friend class forward_list;
+    friend class forward_list_iterator<T>;
 
 
 public: /** TYPE ALIAS **/
@@ -53,14 +45,14 @@ public: /** CONSTRUCTORS **/
 
 
     /** DEFAULT CTOR **/
-    node() 
+    forward_list_node() 
             noexcept(std::is_nothrow_default_constructible<T>::value)
             requires(std::is_default_constructible<T>::value)
         : m_data{T{}}
     {}
 
     /** PARAM CTOR **/
-    explicit node(T const &p_data, node* p_next = nullptr)
+    explicit forward_list_node(T const &p_data, forward_list_node* p_next = nullptr)
             noexcept(std::is_nothrow_copy_constructible<T>::value)
             requires(std::is_copy_constructible<T>::value)
         : m_data{p_data}
@@ -68,7 +60,7 @@ public: /** CONSTRUCTORS **/
     {}
 
     /** PARAM CTOR (rvalue ref) **/
-    explicit node(T &&p_data, node* p_next = nullptr)
+    explicit forward_list_node(T &&p_data, forward_list_node* p_next = nullptr)
             noexcept(std::is_nothrow_move_constructible<T>::value)
             requires(std::is_move_constructible<T>::value)
         : m_data{std::move(p_data)}
@@ -77,7 +69,7 @@ public: /** CONSTRUCTORS **/
 
     /** **/
     template <class... ARGS>
-    node(std::in_place_t, ARGS &&...p_args)
+    forward_list_node(std::in_place_t, ARGS &&...p_args)
             noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
             requires(std::is_constructible<T, ARGS...>::value)
         : m_data{T{std::forward<ARGS>(p_args)...}}
@@ -93,8 +85,8 @@ public: /** GETTERS **/
 
 
 private:
-    value_type m_data;
-    node*      m_next {};
+    value_type         m_data;
+    forward_list_node* m_next {};
 };
 
 //  //
@@ -102,14 +94,14 @@ private:
 //* END NODE *//
 
 // //
-template <class T> class Iterator
+template <class T> class forward_list_iterator
 {
 
 public:
     friend class Sentinel<T>;
 
 public: /** TYPE ALIAS **/
-    using node_type = node<T>;
+    using node_type = forward_list_node<T>;
 
 public: /** TYPE ALIAS **/
     using value_type      = typename node_type::value_type;
@@ -125,28 +117,28 @@ public: /** CONSTRUCTORS **/
 
 
     /** DEFAULT CTOR **/
-    Iterator() noexcept(true) = default;
+    forward_list_iterator() noexcept(true) = default;
 
     /** DEFAULT COPY CTOR **/
-    Iterator(Iterator const& ) noexcept(true) = default;
+    forward_list_iterator(forward_list_iterator const& ) noexcept(true) = default;
 
     /** DEFAULT MOVE CTOR **/
-    Iterator(Iterator&&) noexcept(true) = default;
+    forward_list_iterator(forward_list_iterator&&) noexcept(true) = default;
 
     /** PARAM CTOR **/
-    Iterator(node_type* p_node) noexcept(true) : m_node(p_node) {}
+    forward_list_iterator(node_type* p_node) noexcept(true) : m_node(p_node) {}
 
 
     /** DEFAULT COPY ASSIGN **/
-    Iterator& operator=(Iterator const&) noexcept(true) = default;
+    forward_list_iterator& operator=(forward_list_iterator const&) noexcept(true) = default;
 
     /** DEFAULT MOVE ASSIGN **/
-    Iterator& operator=(Iterator&&) noexcept(true) = default;
+    forward_list_iterator& operator=(forward_list_iterator&&) noexcept(true) = default;
 
 
 public:
     /** DEREFERENCE OP **/
-    auto operator*() noexcept(true) -> reference
+    auto operator*() const noexcept(true) -> reference
     {
         return m_node->m_data;
     }
@@ -161,20 +153,20 @@ public:
     {
         return std::addressof( m_node->m_data );
     }
-    auto operator->() noexcept(true) -> const_pointer
+    auto operator->() const noexcept(true) -> const_pointer
     {
         return std::addressof( m_node->m_data );
     }
 
 
     /** (POST & PRE ) INCREMENT OP **/
-    auto operator++() noexcept(true) -> Iterator &
+    auto operator++() noexcept(true) -> forward_list_iterator &
     {
         m_node = m_node->m_next;
         return *this;
     }
 
-    auto operator++(int) noexcept(true) -> Iterator
+    auto operator++(int) noexcept(true) -> forward_list_iterator
     {
         auto copy = auto{ *this };
         m_node    = m_node->m_next;
@@ -184,13 +176,20 @@ public:
 
 
     /** COMPAR OP **/
-    [[nodiscard]] friend auto operator==(Iterator const &p_lhs,
-                                         Iterator const &p_rhs) noexcept(true)
+    [[nodiscard]] friend auto operator==(forward_list_iterator const &p_lhs,
+                                         forward_list_iterator const &p_rhs) noexcept(true)
         -> bool
     {
         return (p_lhs.m_node == p_rhs.m_node);
     }
 
+    [[nodiscard]] friend auto operator==(forward_list_iterator const &p_lhs,
+                                         Sentinel<T> const&) noexcept(true)
+        -> bool
+    {
+        return ( p_lhs.m_node == nullptr );
+    }
+
     /* As of C++20, operator!= is auto generated as !(operator==) */
 
 
@@ -207,14 +206,7 @@ protected:
 
 template <class T> struct Sentinel
 {
-
-public:
-    [[nodiscard]] friend auto operator==(Iterator<T> const& lhs,
-                                         Sentinel<T> const&) noexcept(true)
-        -> bool
-    {
-        return ( lhs.m_node == nullptr );
-    }
+    /* compared against Iterator<T> by Iterator's own operator== */
 };
 
 //** END SENTINEL **//
@@ -223,11 +215,13 @@ public:
 //*****//
 
 // FORWARD_LIST //
-template <class T> class forward_list final
+template <class T, class Allocator> class forward_list final
 {
    
 private: /** TYPE ALIAS **/
-    using node_type = node<T>;
+    using node_type           = forward_list_node<T>;
+    using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+    using alloc_traits        = std::allocator_traits<Allocator>;
 
 
 public:/** TYPE ALIAS **/
@@ -238,9 +232,10 @@ public:/** TYPE ALIAS **/
     using const_pointer   = typename node_type::const_pointer;
     using size_type       = std::size_t;
     using difference_type = std::ptrdiff_t;
+    using allocator_type  = Allocator;
 
-    using iterator          = Iterator<T>;
-    using const_iterator    = Iterator<typename std::add_const<T>::type>;
+    using iterator          = forward_list_iterator<T>;
+    using const_iterator    = forward_list_iterator<typename std::add_const<T>::type>;
     using sentinel          = Sentinel<T>;
     using iterator_category = std::forward_iterator_tag;
    
@@ -249,10 +244,17 @@ public: /** CONSTRUCTORS **/
 
 
     /** DEFAULT CTOR **/
-    forward_list() noexcept(true);
+    forward_list() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** ALLOCATOR CTOR **/
+    explicit forward_list(Allocator const&) noexcept(true);
 
     /** COPY CTOR **/
-    forward_list(forward_list const&) noexcept(std::is_nothrow_copy_constructible<T>::value);
+    forward_list(forward_list const&) noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                                               std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** COPY CTOR ( allocator-extended ) **/
+    forward_list(forward_list const&, Allocator const&) noexcept(std::is_nothrow_copy_constructible<T>::value);
 
     /** MOVE CTOR **/
     forward_list(forward_list&&) noexcept(true);
@@ -261,14 +263,14 @@ public: /** CONSTRUCTORS **/
     * INITIALIZER_LIST CTOR 
     * (Construct with the contents of the initializer forward_list)
     * **/
-    forward_list(std::initializer_list<T>) noexcept(std::is_nothrow_copy_constructible<T>::value);
+    forward_list(std::initializer_list<T>, Allocator const& = Allocator()) noexcept(std::is_nothrow_copy_constructible<T>::value);
 
     /**
     * RANGE CTOR
     * (Construct with the contents of the range)
     * **/
     template <std::ranges::range R>
-    forward_list(R&&) noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+    forward_list(R&&, Allocator const& = Allocator()) noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
         requires(non_self<R, forward_list> && 
                  std::is_constructible<T, std::ranges::range_value_t<R>>::value);
 
@@ -277,7 +279,7 @@ public: /** CONSTRUCTORS **/
     * (Construct with the contents of the range [ begin, end ])
     * **/
     template <std::input_iterator I, std::sentinel_for<I> S>
-    forward_list(I, S) noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+    forward_list(I, S, Allocator const& = Allocator()) noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
         requires(std::is_constructible<T, std::iter_value_t<I>>::value);
 
 
@@ -297,22 +299,22 @@ public:
     template <class U>
     void push_front(U&&) 
         noexcept(std::is_nothrow_constructible<T, U>::value)
-        requires(std::is_constructible<T, U>);
+        requires(std::is_constructible<T, U>::value);
 
     template <class U>
     void push_before(U&&, std::integral auto)
         noexcept(std::is_nothrow_constructible<T, U>::value)
-        requires(std::is_constructible<T, U>);
+        requires(std::is_constructible<T, U>::value);
 
     template <class U>
     void push_after(U&&, std::integral auto) 
         noexcept(std::is_nothrow_constructible<T, U>::value)
-        requires(std::is_constructible<T, U>);
+        requires(std::is_constructible<T, U>::value);
 
     template <class U>
     void push_at(U&&, std::integral auto)
         noexcept(std::is_nothrow_constructible<T, U>::value)
-        requires(std::is_constructible<T, U>);
+        requires(std::is_constructible<T, U>::value);
 
 
 
@@ -342,6 +344,45 @@ public:
 
 
 
+public: /** REORDERING ( nodes are relinked, never allocated or copied ) **/
+
+    /** STABLE BOTTOM-UP MERGE SORT, O(n log n) COMPARES AND O(1) EXTRA MEMORY **/
+    void sort() noexcept(std::is_nothrow_invocable<std::less<>&, const_reference, const_reference>::value);
+
+    template <class Compare>
+    void sort(Compare) noexcept(std::is_nothrow_invocable<Compare&, const_reference, const_reference>::value);
+
+    /** MOVE EVERY NODE OF `other` IN; BOTH SORTED, EQUAL ELEMENTS OF *this GO FIRST **/
+    void merge(forward_list& /* other */) noexcept(std::is_nothrow_invocable<std::less<>&, const_reference, const_reference>::value);
+
+    template <class Compare>
+    void merge(forward_list& /* other */, Compare)
+        noexcept(std::is_nothrow_invocable<Compare&, const_reference, const_reference>::value);
+
+    /**
+    * SPLICE
+    * ( moves nodes of `other` in front of element `pos`, pos == size() appends;
+    *   the allocators must compare equal )
+    * **/
+    void splice(std::integral auto /* pos */, forward_list& /* other */) noexcept(true);
+
+    /** ( the single element `index` of `other` ) **/
+    void splice(std::integral auto /* pos */, forward_list& /* other */, std::integral auto /* index */) noexcept(true);
+
+    /** ( the elements [ first, last ) of `other`, which may be *this if pos is outside of them ) **/
+    void splice(std::integral auto /* pos */, forward_list& /* other */,
+                std::integral auto /* first */, std::integral auto /* last */) noexcept(true);
+
+    /** DROP EVERY ELEMENT EQUAL TO THE ONE KEPT BEFORE IT; RETURNS HOW MANY **/
+    auto unique() noexcept(std::is_nothrow_destructible<T>::value) -> size_type;
+
+    template <class BinaryPredicate>
+    auto unique(BinaryPredicate)
+        noexcept(std::is_nothrow_invocable<BinaryPredicate&, const_reference, const_reference>::value &&
+                 std::is_nothrow_destructible<T>::value) -> size_type;
+
+
+
 public:
     [[nodiscard]] auto front() const noexcept(true) -> std::optional<value_type>;
     [[nodiscard]] auto front()       noexcept(true) -> std::optional<value_type>;
@@ -355,6 +396,18 @@ public:
 
 
 
+public:
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+
+public: /** NODE POOL ( only with a pooling allocator, see node_pool.hxx ) **/
+    /** keep enough free nodes around for `count` elements in total **/
+    void reserve(size_type /* count */) requires(node_pooling<node_allocator_type>);
+
+    void shrink_to_fit() noexcept(true) requires(node_pooling<node_allocator_type>);
+
+
+
 public:
     auto begin() const noexcept(true) -> iterator;
     auto begin()       noexcept(true) -> iterator;
@@ -370,6 +423,8 @@ public:
 
         swap(p_lhs.m_head, p_rhs.m_head);
         swap(p_lhs.m_size, p_rhs.m_size);
+
+        swap_allocators(p_lhs.m_alloc, p_rhs.m_alloc);
     }
 
 
@@ -414,10 +469,43 @@ private:
         return v_curr;
     }
 
+
+    /** THE LINK THAT POINTS AT ELEMENT `pos`, THE LAST m_next WHEN pos == size() **/
+    auto link_at(std::integral auto p_pos) noexcept(true) -> node_type**
+    {
+        assert(static_cast<size_type>(p_pos) <= m_size);
+
+        return (p_pos == 0) ? &m_head : &(find_at(p_pos - 1ul)->m_next);
+    }
+
+
+    /** CUT THE CHAIN AFTER `count` NODES, RETURNS WHAT WAS BEHIND THEM **/
+    static auto cut(node_type* p_head, size_type p_count) noexcept(true) -> node_type*
+    {
+        for (; p_head && p_count > 1ul; p_count = p_count - 1ul) p_head = p_head->m_next;
+
+        if (p_head == nullptr) return nullptr;
+
+        node_type* v_rest = p_head->m_next;
+        p_head->m_next    = nullptr;
+
+        return v_rest;
+    }
+
+    /** MERGE TWO SORTED CHAINS ONTO `tail`; lhs AND rhs ALWAYS HOLD WHAT IS NOT MERGED YET **/
+    template <class Compare>
+    static void merge_chains(node_type*& /* lhs */, node_type*& /* rhs */, node_type**& /* tail */, Compare&);
+
+    /** BOTTOM-UP MERGE SORT OF A NULL TERMINATED CHAIN OF `size` NODES **/
+    template <class Compare>
+    static void sort_chain(node_type*& /* head */, size_type /* size */, Compare&);
+
 private:
     node_type* m_head {};
     size_type  m_size {};
 
+    [[no_unique_address]] node_allocator_type m_alloc;
+
 };
 
 //  //
@@ -425,12 +513,12 @@ private:
 //*****//
 
 
-template <class T>
+template <class T, class Allocator>
 template <std::input_iterator I, std::sentinel_for<I> S>
-forward_list<T>::forward_list(I p_first, S p_last)
+forward_list<T, Allocator>::forward_list(I p_first, S p_last, Allocator const& p_alloc)
         noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
         requires(std::is_constructible<T, std::iter_value_t<I>>::value)
-    : forward_list{}
+    : forward_list(p_alloc)
 {
     using std::placeholders::_1;
 
@@ -441,25 +529,25 @@ forward_list<T>::forward_list(I p_first, S p_last)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <std::ranges::range R>
-forward_list<T>::forward_list(R&& p_list)
+forward_list<T, Allocator>::forward_list(R&& p_list, Allocator const& p_alloc)
         noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
         requires(non_self<R, forward_list> &&
          std::is_constructible<T, std::ranges::range_value_t<R>>::value)
-    : forward_list(std::ranges::rbegin(p_list), std::ranges::rend(p_list))
+    : forward_list(std::ranges::rbegin(p_list), std::ranges::rend(p_list), p_alloc)
 {
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void forward_list<T>::push_front(U&& p_data)
+void forward_list<T, Allocator>::push_front(U&& p_data)
     noexcept(std::is_nothrow_constructible<T, U>::value)
-    requires(std::is_constructible<T, U>)
+    requires(std::is_constructible<T, U>::value)
 {
 
-    if ( auto v_node = new(std::nothrow) node_type(std::forward<U>(p_data), m_head) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::forward<U>(p_data), m_head) )
     {
         m_head = v_node;
         m_size = m_size + 1ul;
@@ -467,11 +555,11 @@ void forward_list<T>::push_front(U&& p_data)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void forward_list<T>::push_before(U&& p_data, std::integral auto p_pos)
+void forward_list<T, Allocator>::push_before(U&& p_data, std::integral auto p_pos)
     noexcept(std::is_nothrow_constructible<T, U>::value)
-    requires(std::is_constructible<T, U>)
+    requires(std::is_constructible<T, U>::value)
 {
     
     node_type* v_targ = find_at(p_pos - 1ul);
@@ -479,7 +567,7 @@ void forward_list<T>::push_before(U&& p_data, std::integral auto p_pos)
     if ( not v_targ ) return;
 
 
-    if ( auto v_node = new(std::nothrow) node_type(std::forward<U>(p_data), v_targ->m_next) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::forward<U>(p_data), v_targ->m_next) )
     {
         v_targ->m_next = v_node;
         m_size = m_size + 1ul;
@@ -487,17 +575,17 @@ void forward_list<T>::push_before(U&& p_data, std::integral auto p_pos)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void forward_list<T>::push_after(U&& p_data, std::integral auto p_pos)
+void forward_list<T, Allocator>::push_after(U&& p_data, std::integral auto p_pos)
     noexcept(std::is_nothrow_constructible<T, U>::value)
-    requires(std::is_constructible<T, U>)
+    requires(std::is_constructible<T, U>::value)
 {
     node_type* v_targ = find_at(p_pos);
 
     if ( not v_targ ) return;
 
-    if ( auto v_node = new(std::nothrow) node_type(std::forward<U>(p_data), v_targ->m_next) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::forward<U>(p_data), v_targ->m_next) )
     {
         v_targ->m_next = v_node;
         m_size = m_size + 1ul;
@@ -505,11 +593,11 @@ void forward_list<T>::push_after(U&& p_data, std::integral auto p_pos)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void forward_list<T>::push_at(U&& p_data, std::integral auto p_pos)
+void forward_list<T, Allocator>::push_at(U&& p_data, std::integral auto p_pos)
     noexcept(std::is_nothrow_constructible<T, U>::value)
-    requires(std::is_constructible<T, U>)
+    requires(std::is_constructible<T, U>::value)
 {
     node_type* v_targ = find_at(p_pos);
 
@@ -519,12 +607,12 @@ void forward_list<T>::push_at(U&& p_data, std::integral auto p_pos)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void forward_list<T>::emplace_front(ARGS&& ...p_args)
+void forward_list<T, Allocator>::emplace_front(ARGS&& ...p_args)
     noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
-    if ( auto v_node = new(std::nothrow) node_type(std::in_place, std::forward<ARGS>(p_args)...) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::in_place, std::forward<ARGS>(p_args)...) )
     {
         v_node->m_next = m_head;
         m_head         = v_node;
@@ -535,16 +623,16 @@ void forward_list<T>::emplace_front(ARGS&& ...p_args)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void forward_list<T>::emplace_before(std::integral auto p_pos, ARGS&& ...p_args)
+void forward_list<T, Allocator>::emplace_before(std::integral auto p_pos, ARGS&& ...p_args)
     noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
     node_type* v_targ = find_at(p_pos - 1ul);
 
     if ( not v_targ ) return;
 
-    if ( auto v_node = new(std::nothrow) node_type(std::in_place, std::forward<ARGS>(p_args)...) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::in_place, std::forward<ARGS>(p_args)...) )
     {
         v_node->m_next = v_targ->m_next;
         v_targ->m_next = v_node;
@@ -554,16 +642,16 @@ void forward_list<T>::emplace_before(std::integral auto p_pos, ARGS&& ...p_args)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void forward_list<T>::emplace_after(std::integral auto p_pos, ARGS&& ...p_args)
+void forward_list<T, Allocator>::emplace_after(std::integral auto p_pos, ARGS&& ...p_args)
     noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
     node_type* v_targ = find_at(p_pos);
 
     if ( not v_targ) return;
 
-    if ( auto v_node = new(std::nothrow) node_type(std::in_place, std::forward<ARGS>(p_args)...) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::in_place, std::forward<ARGS>(p_args)...) )
     {
         v_node->m_next = v_targ->m_next;
         v_targ->m_next = v_node;
@@ -572,9 +660,9 @@ void forward_list<T>::emplace_after(std::integral auto p_pos, ARGS&& ...p_args)
     }
 }
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void forward_list<T>::emplace_at(std::integral auto p_pos, ARGS&& ...p_args)
+void forward_list<T, Allocator>::emplace_at(std::integral auto p_pos, ARGS&& ...p_args)
     noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
     node_type* v_targ = find_at(p_pos);
@@ -590,8 +678,8 @@ void forward_list<T>::emplace_at(std::integral auto p_pos, ARGS&& ...p_args)
 
 
 
-template <class T>
-void forward_list<T>::pop_at(std::integral auto p_pos)
+template <class T, class Allocator>
+void forward_list<T, Allocator>::pop_at(std::integral auto p_pos)
     noexcept(std::is_nothrow_destructible<T>::value)
 {
     assert( not empty() );
@@ -605,13 +693,210 @@ void forward_list<T>::pop_at(std::integral auto p_pos)
 
     v_tmp->m_next = v_targ->m_next;
 
-    v_targ = ( delete v_targ, nullptr );
+    v_targ = ( deallocate_node(m_alloc, v_targ), nullptr );
 
     m_size = m_size - 1ul;
 }
 
 
 
+template <class T, class Allocator>
+template <class Compare>
+void forward_list<T, Allocator>::merge_chains(node_type*& p_lhs, node_type*& p_rhs, node_type**& p_tail, Compare& p_comp)
+{
+    while (p_lhs && p_rhs)
+    {
+        // ties go left, which keeps the sort stable
+        node_type*& v_take = p_comp(p_rhs->m_data, p_lhs->m_data) ? p_rhs : p_lhs;
+        node_type*  v_node = v_take;
+
+        v_take  = v_node->m_next;
+        *p_tail = v_node;
+        p_tail  = &v_node->m_next;
+    }
+
+    *p_tail = p_lhs ? p_lhs : p_rhs;
+
+    p_lhs = nullptr;
+    p_rhs = nullptr;
+
+    while (*p_tail) p_tail = &(*p_tail)->m_next;
+}
+
+
+template <class T, class Allocator>
+template <class Compare>
+void forward_list<T, Allocator>::sort_chain(node_type*& p_head, size_type p_size, Compare& p_comp)
+{
+    for (size_type v_width = 1ul; v_width < p_size; v_width = v_width << 1ul)
+    {
+        node_type*  v_done = nullptr;
+        node_type** v_tail = &v_done;
+        node_type*  v_rest = p_head;
+        node_type*  v_lhs  = nullptr;
+        node_type*  v_rhs  = nullptr;
+
+        try {
+            while (v_rest)
+            {
+                v_lhs  = v_rest;
+                v_rhs  = cut(v_lhs, v_width);
+                v_rest = cut(v_rhs, v_width);
+
+                merge_chains(v_lhs, v_rhs, v_tail, p_comp);
+            }
+        }
+        catch (...) {
+            // the comparison threw: chain everything back up, in whatever order it is
+            for (node_type* v_part : {v_lhs, v_rhs, v_rest})
+            {
+                *v_tail = v_part;
+
+                while (*v_tail) v_tail = &(*v_tail)->m_next;
+            }
+
+            p_head = v_done;
+            throw;
+        }
+
+        p_head = v_done;
+    }
+}
+
+
+template <class T, class Allocator>
+template <class Compare>
+void forward_list<T, Allocator>::sort(Compare p_comp)
+    noexcept(std::is_nothrow_invocable<Compare&, const_reference, const_reference>::value)
+{
+    sort_chain(m_head, m_size, p_comp);
+}
+
+
+template <class T, class Allocator>
+template <class Compare>
+void forward_list<T, Allocator>::merge(forward_list& p_other, Compare p_comp)
+    noexcept(std::is_nothrow_invocable<Compare&, const_reference, const_reference>::value)
+{
+    if (&p_other == this) return;
+
+    assert(get_allocator() == p_other.get_allocator());
+
+    node_type** v_link = &m_head;
+
+    // one node at a time, so both lists are whole if the comparison throws
+    while (p_other.m_head)
+    {
+        if (*v_link == nullptr)
+        {
+            *v_link = std::exchange(p_other.m_head, nullptr);
+
+            m_size         = m_size + p_other.m_size;
+            p_other.m_size = 0ul;
+            break;
+        }
+
+        if (p_comp(p_other.m_head->m_data, (*v_link)->m_data))
+        {
+            node_type* v_node = p_other.m_head;
+
+            p_other.m_head = v_node->m_next;
+            v_node->m_next = *v_link;
+            *v_link        = v_node;
+
+            m_size         = m_size + 1ul;
+            p_other.m_size = p_other.m_size - 1ul;
+        }
+
+        v_link = &(*v_link)->m_next;
+    }
+}
+
+
+template <class T, class Allocator>
+void forward_list<T, Allocator>::splice(std::integral auto p_pos, forward_list& p_other) noexcept(true)
+{
+    splice(p_pos, p_other, 0ul, p_other.m_size);
+}
+
+
+template <class T, class Allocator>
+void forward_list<T, Allocator>::splice(std::integral auto p_pos, forward_list& p_other, std::integral auto p_index) noexcept(true)
+{
+    splice(p_pos, p_other, p_index, p_index + 1ul);
+}
+
+
+template <class T, class Allocator>
+void forward_list<T, Allocator>::splice(std::integral auto p_pos, forward_list& p_other,
+                                        std::integral auto p_first, std::integral auto p_last) noexcept(true)
+{
+    const size_type v_pos   = static_cast<size_type>(p_pos);
+    const size_type v_first = static_cast<size_type>(p_first);
+    const size_type v_last  = static_cast<size_type>(p_last);
+
+    if (v_first >= v_last) return;
+
+    assert(v_last <= p_other.m_size);
+    assert(get_allocator() == p_other.get_allocator());
+
+    if (&p_other == this)
+    {
+        assert(v_pos <= v_first || v_pos >= v_last);
+
+        // already in front of element `pos`
+        if (v_pos == v_first || v_pos == v_last) return;
+    }
+
+    // find every link first: with &p_other == this, unlinking moves the indices
+    node_type** v_link = link_at(v_pos);
+    node_type** v_from = p_other.link_at(v_first);
+    node_type*  v_tail = p_other.find_at(v_last - 1ul);
+    node_type*  v_head = *v_from;
+
+    *v_from        = v_tail->m_next;
+    v_tail->m_next = *v_link;
+    *v_link        = v_head;
+
+    if (&p_other != this)
+    {
+        m_size         = m_size + (v_last - v_first);
+        p_other.m_size = p_other.m_size - (v_last - v_first);
+    }
+}
+
+
+template <class T, class Allocator>
+template <class BinaryPredicate>
+auto forward_list<T, Allocator>::unique(BinaryPredicate p_pred)
+    noexcept(std::is_nothrow_invocable<BinaryPredicate&, const_reference, const_reference>::value &&
+             std::is_nothrow_destructible<T>::value) -> size_type
+{
+    if (m_head == nullptr) return 0ul;
+
+    size_type  v_count = 0ul;
+    node_type* v_keep  = m_head;
+
+    while (node_type* v_next = v_keep->m_next)
+    {
+        if (p_pred(v_keep->m_data, v_next->m_data))
+        {
+            v_keep->m_next = v_next->m_next;
+            v_next         = ( deallocate_node(m_alloc, v_next), nullptr );
+
+            m_size  = m_size - 1ul;
+            v_count = v_count + 1ul;
+        }
+        else {
+            v_keep = v_next;
+        }
+    }
+
+    return v_count;
+}
+
+
+
 
 /** USER DEFINED TYPE DEDUCTION **/
 template <std::ranges::range R>
@@ -621,13 +906,29 @@ template <std::input_iterator I, std::sentinel_for<I> S>
 forward_list( I, S ) -> forward_list<std::iter_value_t<I>>;
 
 
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <class T>
+    using forward_list = ::forward_list<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+/** NODE POOL ALIAS **/
+namespace pooled
+{
+    template <class T>
+    using forward_list = ::forward_list<T, pool_allocator<T>>;
+}
+
+
 
 /**
 * This specialization of std::ranges::enable_borrowed_range 
 * makes list satisfy borrowed_range 
 * **/
-template <class T>
-inline constexpr bool std::ranges::enable_borrowed_range<forward_list<T>> = true;
+template <class T, class Allocator>
+inline constexpr bool std::ranges::enable_borrowed_range<forward_list<T, Allocator>> = true;
 
 
 
@@ -0,0 +1,710 @@
+#ifndef INDEXED_LIST_HXX
+#define INDEXED_LIST_HXX
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <ds/node_allocator.hxx>
+#include <ds/node_pool.hxx>
+
+
+template <class T, class = std::allocator<T>> class indexed_list;
+template <class> class indexed_node;
+template <class> class indexed_iterator;
+
+
+/** START LINK **/
+
+/**
+ * One level of a node's tower: the next node on that level and how many
+ * elements forward it is. The last link of a level counts up to one past
+ * the last element, so a search never has to test for the end.
+ * **/
+template <class T> struct indexed_link final
+{
+    indexed_node<T>* m_next  {};
+    std::size_t      m_width {1ul};
+};
+
+/** END LINK **/
+
+
+/** START NODE **/
+
+/**
+ * Level 0 sits inside the node; the levels above, one node in four on
+ * average, are a separate array of links.
+ * **/
+template <class T> class indexed_node final
+{
+
+public:
+    template <class, class> friend class indexed_list;
+    friend class indexed_iterator<T>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using link_type       = indexed_link<T>;
+
+
+public: /** CONSTRUCTORS **/
+    template <class... ARGS>
+    explicit indexed_node(std::in_place_t, ARGS&&... p_args) noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+            requires(std::is_constructible<T, ARGS...>::value)
+        : m_data(std::forward<ARGS>(p_args)...)
+    {}
+
+
+private:
+    auto link_at(std::size_t p_level) noexcept(true) -> link_type&
+    {
+        return (p_level == 0ul) ? m_base : m_tower[p_level - 1ul];
+    }
+
+    auto link_at(std::size_t p_level) const noexcept(true) -> link_type const&
+    {
+        return (p_level == 0ul) ? m_base : m_tower[p_level - 1ul];
+    }
+
+private:
+    value_type   m_data;
+    link_type    m_base   {};
+    link_type*   m_tower  {};
+    std::uint8_t m_height {1u};
+};
+
+/** END NODE **/
+
+
+/** START ITERATOR **/
+
+template <class T> class indexed_iterator final
+{
+
+public: /** TYPE ALIAS **/
+    using node_type = indexed_node<T>;
+
+public: /** TYPE ALIAS **/
+    using value_type        = typename node_type::value_type;
+    using reference         = typename node_type::reference;
+    using const_reference   = typename node_type::const_reference;
+    using pointer           = typename node_type::pointer;
+    using const_pointer     = typename node_type::const_pointer;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+
+public: /** CONSTRUCTORS **/
+    indexed_iterator() noexcept(true) = default;
+
+    /** PARAM CTOR **/
+    indexed_iterator(node_type* p_node) noexcept(true) : m_node(p_node) {}
+
+
+public:
+    /** DEREFERENCE OP **/
+    auto operator*() const noexcept(true) -> reference { return m_node->m_data; }
+
+    /** ARROW OP **/
+    auto operator->() const noexcept(true) -> pointer { return std::addressof( m_node->m_data ); }
+
+
+    /** (POST & PRE ) INCREMENT OP **/
+    auto operator++() noexcept(true) -> indexed_iterator &
+    {
+        m_node = m_node->m_base.m_next;
+        return *this;
+    }
+
+    auto operator++(int) noexcept(true) -> indexed_iterator
+    {
+        auto copy = auto{ *this };
+        m_node    = m_node->m_base.m_next;
+
+        return copy;
+    }
+
+
+    /** COMPAR OP **/
+    [[nodiscard]] friend auto operator==(indexed_iterator const &p_lhs,
+                                         indexed_iterator const &p_rhs) noexcept(true)
+        -> bool
+    {
+        return (p_lhs.m_node == p_rhs.m_node);
+    }
+
+
+private:
+    node_type* m_node {};
+};
+
+/** END ITERATOR **/
+
+
+
+/** START INDEXED LIST **/
+
+/**
+ * Sequence with the positional interface of list, where finding position
+ * `pos` costs O(log n) instead of a walk ( an indexable skip list ).
+ *
+ * Every element sits on level 0; each level above holds about a quarter
+ * of the level below it and every link records how many elements it
+ * jumps over, so a search drops down the levels summing widths until it
+ * reaches the position. Inserting or erasing at a position is that same
+ * search, plus one width update per level.
+ *
+ * Iteration follows level 0 and is as cheap as for forward_list.
+ * **/
+template <class T, class Allocator> class indexed_list final
+{
+
+public: /** TYPE ALIAS **/
+    using node_type = indexed_node<T>;
+    using link_type = indexed_link<T>;
+
+private: /** TYPE ALIAS **/
+    using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+    using link_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<link_type>;
+    using alloc_traits        = std::allocator_traits<Allocator>;
+    using link_traits         = std::allocator_traits<link_allocator_type>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = typename node_type::value_type;
+    using reference       = typename node_type::reference;
+    using const_reference = typename node_type::const_reference;
+    using pointer         = typename node_type::pointer;
+    using const_pointer   = typename node_type::const_pointer;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using allocator_type  = Allocator;
+
+    using iterator          = indexed_iterator<T>;
+    using iterator_category = std::forward_iterator_tag;
+
+    /** a level is added with probability 1/4, 32 levels cover 2^64 elements **/
+    static constexpr size_type max_height = 32ul;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    indexed_list() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** ALLOCATOR CTOR **/
+    explicit indexed_list(Allocator const&) noexcept(true);
+
+    /** COPY CTOR **/
+    indexed_list(indexed_list const&) noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                                               std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** COPY CTOR ( allocator-extended ) **/
+    indexed_list(indexed_list const&, Allocator const&) noexcept(std::is_nothrow_copy_constructible<T>::value);
+
+    /** MOVE CTOR **/
+    indexed_list(indexed_list&&) noexcept(true);
+
+    /**
+    * INITIALIZER_LIST CTOR
+    * (Construct with the contents of the initializer list)
+    * **/
+    indexed_list(std::initializer_list<T>, Allocator const& = Allocator()) noexcept(std::is_nothrow_copy_constructible<T>::value);
+
+    /**
+    * RANGE CTOR
+    * (Construct with the contents of the range)
+    * **/
+    template <std::ranges::range R>
+    indexed_list(R&&, Allocator const& = Allocator()) noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(not std::is_same<std::remove_cvref_t<R>, indexed_list>::value &&
+                 std::is_constructible<T, std::ranges::range_value_t<R>>::value);
+
+    /**
+    * RANGE CTOR
+    * (Construct with the contents of the range [ begin, end ])
+    * **/
+    template <std::input_iterator I, std::sentinel_for<I> S>
+    indexed_list(I, S, Allocator const& = Allocator()) noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+        requires(std::is_constructible<T, std::iter_value_t<I>>::value);
+
+
+    /**
+    * ASSIGNMENT OP
+    * ( copy-swap idiom )
+    * **/
+    auto operator=(indexed_list) noexcept(std::is_nothrow_copy_constructible<T>::value) -> indexed_list &;
+
+
+
+public: /** INSERT ( every position is O(log n) ) **/
+    template <class U>
+    void push_front(U&&)
+        noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    template <class U>
+    void push_back(U&&)
+        noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    /** ( the new element becomes element `pos` ) **/
+    template <class U>
+    void push_before(U&&, std::integral auto)
+        noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    /** ( the new element becomes element `pos + 1` ) **/
+    template <class U>
+    void push_after(U&&, std::integral auto)
+        noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    /** ( like push_before, but pos == size() appends ) **/
+    template <class U>
+    void push_at(U&&, std::integral auto)
+        noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+
+    template <class... ARGS>
+    void emplace_back(ARGS&& ...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+    template <class... ARGS>
+    void emplace_front(ARGS&& ...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+    template <class... ARGS>
+    void emplace_before(std::integral auto, ARGS&& ...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+    template <class... ARGS>
+    void emplace_after(std::integral auto, ARGS&& ...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+    template <class... ARGS>
+    void emplace_at(std::integral auto, ARGS&& ...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+
+
+public:
+    void pop_front() noexcept(std::is_nothrow_destructible<T>::value);
+    void pop_back() noexcept(std::is_nothrow_destructible<T>::value);
+    void pop_at(std::integral auto) noexcept(std::is_nothrow_destructible<T>::value);
+
+
+
+public:
+    [[nodiscard]] auto front() const noexcept(true) -> std::optional<value_type>;
+    [[nodiscard]] auto front()       noexcept(true) -> std::optional<value_type>;
+
+    [[nodiscard]] auto back() const noexcept(true) -> std::optional<value_type>;
+    [[nodiscard]] auto back()       noexcept(true) -> std::optional<value_type>;
+
+    /** COPY OF ELEMENT `pos`, EMPTY WHEN OUT OF RANGE **/
+    [[nodiscard]] auto at(std::integral auto) const noexcept(true) -> std::optional<value_type>;
+
+    /** ELEMENT `pos`, WHICH MUST EXIST **/
+    [[nodiscard]] auto operator[](std::integral auto) const noexcept(true) -> const_reference;
+    [[nodiscard]] auto operator[](std::integral auto)       noexcept(true) -> reference;
+
+
+public:
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+
+public:
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+
+public: /** NODE POOL ( only with a pooling allocator, see node_pool.hxx ) **/
+    /** keep enough free nodes around for `count` elements in total **/
+    void reserve(size_type /* count */) requires(node_pooling<node_allocator_type>);
+
+    void shrink_to_fit() noexcept(true) requires(node_pooling<node_allocator_type>);
+
+
+public:
+    auto begin() const noexcept(true) -> iterator;
+    auto begin()       noexcept(true) -> iterator;
+
+    auto end() const noexcept(true) -> iterator;
+    auto end()       noexcept(true) -> iterator;
+
+
+public:
+    ~indexed_list() noexcept(std::is_nothrow_destructible<T>::value);
+
+
+public:
+    friend void swap(indexed_list &p_lhs, indexed_list &p_rhs) noexcept(true)
+    {
+        using std::swap;
+
+        swap(p_lhs.m_head,  p_rhs.m_head);
+        swap(p_lhs.m_level, p_rhs.m_level);
+        swap(p_lhs.m_size,  p_rhs.m_size);
+        swap(p_lhs.m_seed,  p_rhs.m_seed);
+
+        swap_allocators(p_lhs.m_alloc, p_rhs.m_alloc);
+    }
+
+
+private:
+    /** last node on each level in front of the searched rank, nullptr is the head **/
+    struct path final
+    {
+        std::array<node_type*, max_height> m_node;
+        std::array<size_type, max_height>  m_rank;
+    };
+
+private:
+    /** THE LINK OF `node` ON `level`, nullptr BEING THE HEAD **/
+    auto link_of(node_type* p_node, size_type p_level) noexcept(true) -> link_type&
+    {
+        return p_node ? p_node->link_at(p_level) : m_head[p_level];
+    }
+
+    auto link_of(node_type const* p_node, size_type p_level) const noexcept(true) -> link_type const&
+    {
+        return p_node ? p_node->link_at(p_level) : m_head[p_level];
+    }
+
+    /** ELEMENT `pos`, nullptr WHEN OUT OF RANGE **/
+    [[nodiscard]] auto find_at(size_type /* pos */) const noexcept(true) -> node_type*;
+
+    /** PREDECESSORS ON EVERY LEVEL OF THE ELEMENT WITH 1-BASED RANK `rank` **/
+    void find_path(size_type /* rank */, path&) const noexcept(true);
+
+    /** HANG A NEW NODE IN SO IT BECOMES ELEMENT `pos` **/
+    void link(node_type* /* node */, size_type /* pos */) noexcept(true);
+
+    /** TAKE ELEMENT `pos` OUT AND HAND ITS NODE BACK **/
+    [[nodiscard]] auto unlink(size_type /* pos */) noexcept(true) -> node_type*;
+
+    /** 1 + ONE MORE LEVEL WITH PROBABILITY 1/4 EACH, AT MOST max_height **/
+    [[nodiscard]] auto random_height() noexcept(true) -> size_type;
+
+    /** NODE AND TOWER, nullptr WHEN OUT OF MEMORY **/
+    template <class... ARGS>
+    [[nodiscard]] auto make_node(ARGS&&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value) -> node_type*;
+
+    void free_node(node_type* /* node */) noexcept(std::is_nothrow_destructible<T>::value);
+
+    /** BUILD A NODE FROM `args` AND LINK IT AT `pos`, A NO-OP PAST THE END **/
+    template <class... ARGS>
+    void insert_at(size_type /* pos */, ARGS&&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+private:
+    [[no_unique_address]] node_allocator_type m_alloc;
+
+    std::array<link_type, max_height> m_head {};
+
+    size_type m_level {1ul};
+    size_type m_size  {0ul};
+
+    std::uint64_t m_seed {0x9E3779B97F4A7C15ull};
+};
+
+/** END INDEXED LIST **/
+
+
+/** **/
+//  //
+/** **/
+
+
+template <class T, class Allocator>
+template <std::input_iterator I, std::sentinel_for<I> S>
+indexed_list<T, Allocator>::indexed_list(I p_first, S p_last, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+        requires(std::is_constructible<T, std::iter_value_t<I>>::value)
+    : indexed_list(p_alloc)
+{
+    for (; p_first != p_last; ++p_first) insert_at(m_size, *p_first);
+}
+
+
+template <class T, class Allocator>
+template <std::ranges::range R>
+indexed_list<T, Allocator>::indexed_list(R&& p_range, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(not std::is_same<std::remove_cvref_t<R>, indexed_list>::value &&
+                 std::is_constructible<T, std::ranges::range_value_t<R>>::value)
+    : indexed_list(std::ranges::begin(p_range), std::ranges::end(p_range), p_alloc)
+{}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+auto indexed_list<T, Allocator>::make_node(ARGS&&... p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value) -> node_type*
+{
+    const size_type v_height = random_height();
+
+    link_allocator_type v_link_alloc(m_alloc);
+
+    link_type* v_tower = nullptr;
+
+    if (v_height > 1ul)
+    {
+        try {
+            v_tower = std::to_address(link_traits::allocate(v_link_alloc, v_height - 1ul));
+        }
+        catch (std::bad_alloc const&) {
+            stats_failed<node_allocator_type>();
+
+            return nullptr;
+        }
+
+        std::uninitialized_default_construct_n(v_tower, v_height - 1ul);
+    }
+
+    node_type* v_node = nullptr;
+
+    auto v_build = [&]() -> void
+    {
+        v_node = allocate_node<node_type>(m_alloc, std::in_place, std::forward<ARGS>(p_args)...);
+    };
+
+    if constexpr (std::is_nothrow_constructible<T, ARGS...>::value)
+    {
+        v_build();
+    }
+    else {
+        try {
+            v_build();
+        }
+        catch (...) {
+            if (v_tower) link_traits::deallocate(v_link_alloc, v_tower, v_height - 1ul);
+            throw;
+        }
+    }
+
+    if (v_node == nullptr)
+    {
+        if (v_tower) link_traits::deallocate(v_link_alloc, v_tower, v_height - 1ul);
+        return nullptr;
+    }
+
+    v_node->m_tower  = v_tower;
+    v_node->m_height = static_cast<std::uint8_t>(v_height);
+
+    return v_node;
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void indexed_list<T, Allocator>::insert_at(size_type p_pos, ARGS&&... p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    if (p_pos > m_size) return;
+
+    if (node_type* v_node = make_node(std::forward<ARGS>(p_args)...))
+    {
+        link(v_node, p_pos);
+    }
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void indexed_list<T, Allocator>::push_front(U&& p_data)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    insert_at(0ul, std::forward<U>(p_data));
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void indexed_list<T, Allocator>::push_back(U&& p_data)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    insert_at(m_size, std::forward<U>(p_data));
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void indexed_list<T, Allocator>::push_before(U&& p_data, std::integral auto p_pos)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    if ( std::cmp_less(p_pos, 0) || std::cmp_greater_equal(p_pos, m_size) ) return;
+
+    insert_at(static_cast<size_type>(p_pos), std::forward<U>(p_data));
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void indexed_list<T, Allocator>::push_after(U&& p_data, std::integral auto p_pos)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    if ( std::cmp_less(p_pos, 0) || std::cmp_greater_equal(p_pos, m_size) ) return;
+
+    insert_at(static_cast<size_type>(p_pos) + 1ul, std::forward<U>(p_data));
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void indexed_list<T, Allocator>::push_at(U&& p_data, std::integral auto p_pos)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    if ( std::cmp_less(p_pos, 0) ) return;
+
+    insert_at(static_cast<size_type>(p_pos), std::forward<U>(p_data));
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void indexed_list<T, Allocator>::emplace_front(ARGS&& ...p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    insert_at(0ul, std::forward<ARGS>(p_args)...);
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void indexed_list<T, Allocator>::emplace_back(ARGS&& ...p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    insert_at(m_size, std::forward<ARGS>(p_args)...);
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void indexed_list<T, Allocator>::emplace_before(std::integral auto p_pos, ARGS&& ...p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    if ( std::cmp_less(p_pos, 0) || std::cmp_greater_equal(p_pos, m_size) ) return;
+
+    insert_at(static_cast<size_type>(p_pos), std::forward<ARGS>(p_args)...);
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void indexed_list<T, Allocator>::emplace_after(std::integral auto p_pos, ARGS&& ...p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    if ( std::cmp_less(p_pos, 0) || std::cmp_greater_equal(p_pos, m_size) ) return;
+
+    insert_at(static_cast<size_type>(p_pos) + 1ul, std::forward<ARGS>(p_args)...);
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void indexed_list<T, Allocator>::emplace_at(std::integral auto p_pos, ARGS&& ...p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    if ( std::cmp_less(p_pos, 0) ) return;
+
+    insert_at(static_cast<size_type>(p_pos), std::forward<ARGS>(p_args)...);
+}
+
+
+template <class T, class Allocator>
+void indexed_list<T, Allocator>::pop_at(std::integral auto p_pos)
+    noexcept(std::is_nothrow_destructible<T>::value)
+{
+    if ( std::cmp_less(p_pos, 0) || std::cmp_greater_equal(p_pos, m_size) ) return;
+
+    free_node(unlink(static_cast<size_type>(p_pos)));
+}
+
+
+template <class T, class Allocator>
+[[nodiscard]] auto indexed_list<T, Allocator>::at(std::integral auto p_pos) const noexcept(true)
+    -> std::optional<value_type>
+{
+    if ( std::cmp_less(p_pos, 0) || std::cmp_greater_equal(p_pos, m_size) ) return std::nullopt;
+
+    return std::optional{ find_at(static_cast<size_type>(p_pos))->m_data };
+}
+
+
+template <class T, class Allocator>
+[[nodiscard]] auto indexed_list<T, Allocator>::operator[](std::integral auto p_pos) const noexcept(true)
+    -> const_reference
+{
+    assert( std::cmp_greater_equal(p_pos, 0) && std::cmp_less(p_pos, m_size) );
+
+    return find_at(static_cast<size_type>(p_pos))->m_data;
+}
+
+
+template <class T, class Allocator>
+[[nodiscard]] auto indexed_list<T, Allocator>::operator[](std::integral auto p_pos) noexcept(true)
+    -> reference
+{
+    assert( std::cmp_greater_equal(p_pos, 0) && std::cmp_less(p_pos, m_size) );
+
+    return find_at(static_cast<size_type>(p_pos))->m_data;
+}
+
+
+
+/** USER DEFINED TYPE DEDUCTION **/
+template <std::ranges::range R>  indexed_list( R ) -> indexed_list<std::ranges::range_value_t<R>>;
+template <std::input_iterator I, std::sentinel_for<I> S> indexed_list( I, S ) -> indexed_list<std::iter_value_t<I>>;
+
+
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <class T>
+    using indexed_list = ::indexed_list<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+/** NODE POOL ALIAS **/
+namespace pooled
+{
+    template <class T>
+    using indexed_list = ::indexed_list<T, pool_allocator<T>>;
+}
+
+
+
+extern template class indexed_list<int>;
+extern template class indexed_list<char>;
+extern template class indexed_list<long>;
+extern template class indexed_list<short>;
+extern template class indexed_list<unsigned int>;
+extern template class indexed_list<unsigned char>;
+extern template class indexed_list<unsigned long>;
+extern template class indexed_list<unsigned short>;
+extern template class indexed_list<float>;
+extern template class indexed_list<double>;
+extern template class indexed_list<std::string>;
+
+#endif
@@ -0,0 +1,574 @@
+#ifndef INTRUSIVE_FORWARD_LIST_HXX
+#define INTRUSIVE_FORWARD_LIST_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+
+/**
+ * Singly linked counterpart of intrusive_list.hxx: the links live inside
+ * the objects, nothing is allocated or copied, header only.
+ * **/
+
+template <class T, class Tag = void> class intrusive_forward_list;
+template <class T, class Tag = void> class intrusive_forward_iterator;
+
+
+/** START HOOK **/
+
+/**
+ * Base class that makes T linkable into an intrusive_forward_list<T, Tag>,
+ * one hook per list an object has to be in at the same time.
+ * **/
+template <class Tag = void> class forward_list_hook
+{
+
+public:
+    template <class, class> friend class intrusive_forward_list;
+    template <class, class> friend class intrusive_forward_iterator;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR ( unlinked ) **/
+    forward_list_hook() noexcept(true) = default;
+
+    /** COPY CTOR ( the copy is a new object, it starts out unlinked ) **/
+    forward_list_hook(forward_list_hook const&) noexcept(true) {}
+
+    /** COPY ASSIGN ( links belong to the object, not to its value ) **/
+    auto operator=(forward_list_hook const&) noexcept(true) -> forward_list_hook& { return *this; }
+
+    /** a linked object must be erased before it dies **/
+    ~forward_list_hook() noexcept(true) { assert(not is_linked()); }
+
+
+public:
+    /** the last element links back to the list, so nullptr only ever means unlinked **/
+    [[nodiscard]] auto is_linked() const noexcept(true) -> bool { return m_next != nullptr; }
+
+
+private:
+    forward_list_hook* m_next {};
+};
+
+/** END HOOK **/
+
+
+/** START ITERATOR **/
+
+template <class T, class Tag> class intrusive_forward_iterator final
+{
+
+private: /** TYPE ALIAS **/
+    using hook_type = typename std::conditional<std::is_const<T>::value, forward_list_hook<Tag> const, forward_list_hook<Tag>>::type;
+
+public: /** TYPE ALIAS **/
+    using value_type        = typename std::remove_const<T>::type;
+    using reference         = typename std::add_lvalue_reference<T>::type;
+    using pointer           = typename std::add_pointer<T>::type;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+
+public:
+    template <class, class> friend class intrusive_forward_list;
+    template <class, class> friend class intrusive_forward_iterator;
+
+
+public: /** CONSTRUCTORS **/
+    intrusive_forward_iterator() noexcept(true) = default;
+
+    /** PARAM CTOR **/
+    explicit intrusive_forward_iterator(hook_type* p_hook) noexcept(true) : m_hook(p_hook) {}
+
+    /** CONST CONVERSION **/
+    template <class U>
+    intrusive_forward_iterator(intrusive_forward_iterator<U, Tag> const& p_other) noexcept(true)
+            requires(std::is_const<T>::value && std::is_same<U, value_type>::value)
+        : m_hook(p_other.m_hook)
+    {}
+
+
+public:
+    /** DEREFERENCE OP **/
+    auto operator*() const noexcept(true) -> reference { return static_cast<reference>(*m_hook); }
+
+    /** ARROW OP **/
+    auto operator->() const noexcept(true) -> pointer { return std::addressof(**this); }
+
+
+    /** (POST & PRE ) INCREMENT OP **/
+    auto operator++() noexcept(true) -> intrusive_forward_iterator &
+    {
+        m_hook = m_hook->m_next;
+        return *this;
+    }
+
+    auto operator++(int) noexcept(true) -> intrusive_forward_iterator
+    {
+        auto copy = auto{ *this };
+        m_hook    = m_hook->m_next;
+
+        return copy;
+    }
+
+
+    /** COMPAR OP **/
+    [[nodiscard]] friend auto operator==(intrusive_forward_iterator const &p_lhs,
+                                         intrusive_forward_iterator const &p_rhs) noexcept(true)
+        -> bool
+    {
+        return (p_lhs.m_hook == p_rhs.m_hook);
+    }
+
+
+private:
+    hook_type* m_hook {};
+};
+
+/** END ITERATOR **/
+
+
+
+/** START INTRUSIVE FORWARD LIST **/
+
+/**
+ * Singly linked list over objects that derive from forward_list_hook<Tag>,
+ * with a tail, so it doubles as an intrusive FIFO.
+ *
+ * As with intrusive_list the objects are only linked, never owned. Without
+ * a back link, O(1) removal goes through the predecessor: erase_after(pos),
+ * or erase_after(obj) for the element behind `obj`; erase(obj) has to walk
+ * to find it.
+ * **/
+template <class T, class Tag> class intrusive_forward_list final
+{
+    static_assert(std::is_base_of<forward_list_hook<Tag>, T>::value, "T must derive from forward_list_hook<Tag>");
+
+private: /** TYPE ALIAS **/
+    using hook_type = forward_list_hook<Tag>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using iterator       = intrusive_forward_iterator<T, Tag>;
+    using const_iterator = intrusive_forward_iterator<typename std::add_const<T>::type, Tag>;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    intrusive_forward_list() noexcept(true)
+    {
+        m_head.m_next = &m_head;
+    }
+
+    /** RANGE CTOR ( links every object of the range, in order ) **/
+    template <std::input_iterator I, std::sentinel_for<I> S>
+    intrusive_forward_list(I p_first, S p_last) noexcept(true)
+            requires(std::is_same<std::iter_reference_t<I>, reference>::value)
+        : intrusive_forward_list()
+    {
+        for (; p_first != p_last; ++p_first) push_back(*p_first);
+    }
+
+    /** elements can not be in two lists of the same Tag **/
+    intrusive_forward_list(intrusive_forward_list const&) = delete;
+
+    /** MOVE CTOR **/
+    intrusive_forward_list(intrusive_forward_list&& p_other) noexcept(true) : intrusive_forward_list()
+    {
+        swap(*this, p_other);
+    }
+
+    auto operator=(intrusive_forward_list const&) -> intrusive_forward_list& = delete;
+
+    /** MOVE ASSIGN ( what *this held is unlinked ) **/
+    auto operator=(intrusive_forward_list&& p_other) noexcept(true) -> intrusive_forward_list&
+    {
+        clear();
+        swap(*this, p_other);
+
+        return *this;
+    }
+
+
+public:
+    void push_front(reference) noexcept(true);
+    void push_back(reference) noexcept(true);
+
+    /** LINK `obj` RIGHT BEHIND `pos` ( which may be before_begin() ), RETURNS AN ITERATOR TO IT **/
+    auto insert_after(const_iterator /* pos */, reference /* obj */) noexcept(true) -> iterator;
+
+
+public:
+    void pop_front() noexcept(true);
+
+    /** UNLINK THE ELEMENT BEHIND `pos`, RETURNS THE ONE THAT FOLLOWED IT **/
+    auto erase_after(const_iterator /* pos */) noexcept(true) -> iterator;
+
+    /** UNLINK THE ELEMENT BEHIND `obj`, O(1) **/
+    auto erase_after(reference /* obj */) noexcept(true) -> iterator;
+
+    /** UNLINK `obj`, O(n): the predecessor has to be found first; false when it is not in *this **/
+    auto erase(reference /* obj */) noexcept(true) -> bool;
+
+    /** UNLINK EVERY ELEMENT **/
+    void clear() noexcept(true);
+
+
+public:
+    [[nodiscard]] auto front() const noexcept(true) -> const_reference;
+    [[nodiscard]] auto front()       noexcept(true) -> reference;
+
+    [[nodiscard]] auto back() const noexcept(true) -> const_reference;
+    [[nodiscard]] auto back()       noexcept(true) -> reference;
+
+
+public:
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+
+public: /** ITERATOR FROM OBJECT, O(1) ( `obj` must be in *this ) **/
+    [[nodiscard]] auto iterator_to(reference)       const noexcept(true) -> iterator;
+    [[nodiscard]] auto iterator_to(const_reference) const noexcept(true) -> const_iterator;
+
+
+public:
+    /** THE POSITION IN FRONT OF THE FIRST ELEMENT, FOR insert_after / erase_after **/
+    auto before_begin() const noexcept(true) -> const_iterator;
+    auto before_begin()       noexcept(true) -> iterator;
+
+    auto begin() const noexcept(true) -> const_iterator;
+    auto begin()       noexcept(true) -> iterator;
+
+    auto end() const noexcept(true) -> const_iterator;
+    auto end()       noexcept(true) -> iterator;
+
+
+public:
+    friend void swap(intrusive_forward_list& p_lhs, intrusive_forward_list& p_rhs) noexcept(true)
+    {
+        if (&p_lhs == &p_rhs) return;
+
+        p_lhs.exchange(p_rhs);
+    }
+
+
+public:
+    /** UNLINKS WHATEVER IS STILL IN THE LIST **/
+    ~intrusive_forward_list() noexcept(true);
+
+
+private:
+    static auto hook_of(reference p_obj) noexcept(true) -> hook_type& { return static_cast<hook_type&>(p_obj); }
+
+    /** SWAP THE CONTENTS, THE SENTINELS STAY WHERE THEY ARE **/
+    void exchange(intrusive_forward_list& /* other */) noexcept(true);
+
+    /** TAKE OVER THE TAIL FROM THE SENTINEL AT `old` **/
+    void rehome(hook_type* /* old */) noexcept(true);
+
+    /** LINK `hook` BEHIND `prev` **/
+    void link_after(hook_type* /* prev */, hook_type* /* hook */) noexcept(true);
+
+    /** UNLINK THE HOOK BEHIND `prev`, RETURNS THE ONE THAT FOLLOWED IT **/
+    auto unlink_after(hook_type* /* prev */) noexcept(true) -> hook_type*;
+
+private:
+    hook_type  m_head;
+    hook_type* m_tail {&m_head};
+    size_type  m_size {};
+};
+
+/** END INTRUSIVE FORWARD LIST **/
+
+
+/** **/
+//  //
+/** **/
+
+
+template <class T, class Tag>
+void intrusive_forward_list<T, Tag>::push_front(reference p_obj) noexcept(true)
+{
+    link_after(&m_head, &hook_of(p_obj));
+}
+
+
+template <class T, class Tag>
+void intrusive_forward_list<T, Tag>::push_back(reference p_obj) noexcept(true)
+{
+    link_after(m_tail, &hook_of(p_obj));
+}
+
+
+template <class T, class Tag>
+auto intrusive_forward_list<T, Tag>::insert_after(const_iterator p_pos, reference p_obj) noexcept(true) -> iterator
+{
+    hook_type& v_hook = hook_of(p_obj);
+
+    link_after(const_cast<hook_type*>(p_pos.m_hook), &v_hook);
+
+    return iterator{&v_hook};
+}
+
+
+template <class T, class Tag>
+void intrusive_forward_list<T, Tag>::pop_front() noexcept(true)
+{
+    assert(not empty());
+
+    unlink_after(&m_head);
+}
+
+
+template <class T, class Tag>
+auto intrusive_forward_list<T, Tag>::erase_after(const_iterator p_pos) noexcept(true) -> iterator
+{
+    return iterator{unlink_after(const_cast<hook_type*>(p_pos.m_hook))};
+}
+
+
+template <class T, class Tag>
+auto intrusive_forward_list<T, Tag>::erase_after(reference p_obj) noexcept(true) -> iterator
+{
+    assert(hook_of(p_obj).is_linked());
+
+    return iterator{unlink_after(&hook_of(p_obj))};
+}
+
+
+template <class T, class Tag>
+auto intrusive_forward_list<T, Tag>::erase(reference p_obj) noexcept(true) -> bool
+{
+    hook_type* const v_hook = &hook_of(p_obj);
+
+    if (not v_hook->is_linked()) return false;
+
+    for (hook_type* v_prev = &m_head; v_prev->m_next != &m_head; v_prev = v_prev->m_next)
+    {
+        if (v_prev->m_next == v_hook)
+        {
+            unlink_after(v_prev);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+template <class T, class Tag>
+void intrusive_forward_list<T, Tag>::clear() noexcept(true)
+{
+    hook_type* v_hook = m_head.m_next;
+
+    while (v_hook != &m_head)
+    {
+        hook_type* v_next = v_hook->m_next;
+
+        v_hook->m_next = nullptr;
+        v_hook         = v_next;
+    }
+
+    m_head.m_next = &m_head;
+    m_tail        = &m_head;
+
+    m_size = 0ul;
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_forward_list<T, Tag>::front() const noexcept(true) -> const_reference
+{
+    assert(not empty());
+
+    return *begin();
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_forward_list<T, Tag>::front() noexcept(true) -> reference
+{
+    assert(not empty());
+
+    return *begin();
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_forward_list<T, Tag>::back() const noexcept(true) -> const_reference
+{
+    assert(not empty());
+
+    return *const_iterator{m_tail};
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_forward_list<T, Tag>::back() noexcept(true) -> reference
+{
+    assert(not empty());
+
+    return *iterator{m_tail};
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_forward_list<T, Tag>::empty() const noexcept(true) -> bool
+{
+    return (m_size == 0ul);
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_forward_list<T, Tag>::size() const noexcept(true) -> size_type
+{
+    return m_size;
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_forward_list<T, Tag>::iterator_to(reference p_obj) const noexcept(true) -> iterator
+{
+    assert(hook_of(p_obj).is_linked());
+
+    return iterator{&hook_of(p_obj)};
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_forward_list<T, Tag>::iterator_to(const_reference p_obj) const noexcept(true) -> const_iterator
+{
+    assert(static_cast<hook_type const&>(p_obj).is_linked());
+
+    return const_iterator{&static_cast<hook_type const&>(p_obj)};
+}
+
+
+template <class T, class Tag>
+auto intrusive_forward_list<T, Tag>::before_begin() const noexcept(true) -> const_iterator
+{
+    return const_iterator{&m_head};
+}
+
+
+template <class T, class Tag>
+auto intrusive_forward_list<T, Tag>::before_begin() noexcept(true) -> iterator
+{
+    return iterator{&m_head};
+}
+
+
+template <class T, class Tag>
+auto intrusive_forward_list<T, Tag>::begin() const noexcept(true) -> const_iterator
+{
+    return const_iterator{m_head.m_next};
+}
+
+
+template <class T, class Tag>
+auto intrusive_forward_list<T, Tag>::begin() noexcept(true) -> iterator
+{
+    return iterator{m_head.m_next};
+}
+
+
+template <class T, class Tag>
+auto intrusive_forward_list<T, Tag>::end() const noexcept(true) -> const_iterator
+{
+    return const_iterator{&m_head};
+}
+
+
+template <class T, class Tag>
+auto intrusive_forward_list<T, Tag>::end() noexcept(true) -> iterator
+{
+    return iterator{&m_head};
+}
+
+
+template <class T, class Tag>
+void intrusive_forward_list<T, Tag>::exchange(intrusive_forward_list& p_other) noexcept(true)
+{
+    std::swap(m_head.m_next, p_other.m_head.m_next);
+    std::swap(m_tail,        p_other.m_tail);
+    std::swap(m_size,        p_other.m_size);
+
+    // the tails still point at the other sentinel
+    rehome(&p_other.m_head);
+    p_other.rehome(&m_head);
+}
+
+
+template <class T, class Tag>
+void intrusive_forward_list<T, Tag>::rehome(hook_type* p_old) noexcept(true)
+{
+    if (m_head.m_next == p_old)
+    {
+        m_head.m_next = &m_head;
+        m_tail        = &m_head;
+    }
+    else {
+        m_tail->m_next = &m_head;
+    }
+}
+
+
+template <class T, class Tag>
+void intrusive_forward_list<T, Tag>::link_after(hook_type* p_prev, hook_type* p_hook) noexcept(true)
+{
+    assert(not p_hook->is_linked());
+
+    p_hook->m_next = p_prev->m_next;
+    p_prev->m_next = p_hook;
+
+    if (p_prev == m_tail) m_tail = p_hook;
+
+    m_size = m_size + 1ul;
+}
+
+
+template <class T, class Tag>
+auto intrusive_forward_list<T, Tag>::unlink_after(hook_type* p_prev) noexcept(true) -> hook_type*
+{
+    hook_type* v_hook = p_prev->m_next;
+
+    assert(v_hook != &m_head);
+
+    p_prev->m_next = v_hook->m_next;
+    v_hook->m_next = nullptr;
+
+    if (v_hook == m_tail) m_tail = p_prev;
+
+    m_size = m_size - 1ul;
+
+    return p_prev->m_next;
+}
+
+
+template <class T, class Tag>
+intrusive_forward_list<T, Tag>::~intrusive_forward_list() noexcept(true)
+{
+    clear();
+
+    // the sentinel is a hook too, and hooks die unlinked
+    m_head.m_next = nullptr;
+}
+
+
+#endif
@@ -0,0 +1,590 @@
+#ifndef INTRUSIVE_LIST_HXX
+#define INTRUSIVE_LIST_HXX
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+
+/**
+ * Intrusive containers only link objects that already exist; the links
+ * live inside the objects, so nothing is allocated or copied. Everything
+ * depends on the user type, hence header only.
+ * **/
+
+template <class T, class Tag = void> class intrusive_list;
+template <class T, class Tag = void> class intrusive_iterator;
+
+
+/** START HOOK **/
+
+/**
+ * Base class that makes T linkable into an intrusive_list<T, Tag>.
+ * An object that has to sit in several lists at once derives from one
+ * hook per list, each with its own Tag.
+ * **/
+template <class Tag = void> class list_hook
+{
+
+public:
+    template <class, class> friend class intrusive_list;
+    template <class, class> friend class intrusive_iterator;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR ( unlinked ) **/
+    list_hook() noexcept(true) = default;
+
+    /** COPY CTOR ( the copy is a new object, it starts out unlinked ) **/
+    list_hook(list_hook const&) noexcept(true) {}
+
+    /** COPY ASSIGN ( links belong to the object, not to its value ) **/
+    auto operator=(list_hook const&) noexcept(true) -> list_hook& { return *this; }
+
+    /** a linked object must be erased before it dies **/
+    ~list_hook() noexcept(true) { assert(not is_linked()); }
+
+
+public:
+    [[nodiscard]] auto is_linked() const noexcept(true) -> bool { return m_next != nullptr; }
+
+
+private:
+    list_hook* m_prev {};
+    list_hook* m_next {};
+};
+
+/** END HOOK **/
+
+
+/** START ITERATOR **/
+
+template <class T, class Tag> class intrusive_iterator final
+{
+
+private: /** TYPE ALIAS **/
+    using hook_type = typename std::conditional<std::is_const<T>::value, list_hook<Tag> const, list_hook<Tag>>::type;
+
+public: /** TYPE ALIAS **/
+    using value_type        = typename std::remove_const<T>::type;
+    using reference         = typename std::add_lvalue_reference<T>::type;
+    using pointer           = typename std::add_pointer<T>::type;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+
+public:
+    template <class, class> friend class intrusive_list;
+    template <class, class> friend class intrusive_iterator;
+
+
+public: /** CONSTRUCTORS **/
+    intrusive_iterator() noexcept(true) = default;
+
+    /** PARAM CTOR **/
+    explicit intrusive_iterator(hook_type* p_hook) noexcept(true) : m_hook(p_hook) {}
+
+    /** CONST CONVERSION **/
+    template <class U>
+    intrusive_iterator(intrusive_iterator<U, Tag> const& p_other) noexcept(true)
+            requires(std::is_const<T>::value && std::is_same<U, value_type>::value)
+        : m_hook(p_other.m_hook)
+    {}
+
+
+public:
+    /** DEREFERENCE OP **/
+    auto operator*() const noexcept(true) -> reference { return static_cast<reference>(*m_hook); }
+
+    /** ARROW OP **/
+    auto operator->() const noexcept(true) -> pointer { return std::addressof(**this); }
+
+
+    /** (POST & PRE ) INCREMENT OP **/
+    auto operator++() noexcept(true) -> intrusive_iterator &
+    {
+        m_hook = m_hook->m_next;
+        return *this;
+    }
+
+    auto operator++(int) noexcept(true) -> intrusive_iterator
+    {
+        auto copy = auto{ *this };
+        m_hook    = m_hook->m_next;
+
+        return copy;
+    }
+
+    /** (POST & PRE ) DECREMENT OP **/
+    auto operator--() noexcept(true) -> intrusive_iterator &
+    {
+        m_hook = m_hook->m_prev;
+        return *this;
+    }
+
+    auto operator--(int) noexcept(true) -> intrusive_iterator
+    {
+        auto copy = auto{ *this };
+        m_hook    = m_hook->m_prev;
+
+        return copy;
+    }
+
+
+    /** COMPAR OP **/
+    [[nodiscard]] friend auto operator==(intrusive_iterator const &p_lhs,
+                                         intrusive_iterator const &p_rhs) noexcept(true)
+        -> bool
+    {
+        return (p_lhs.m_hook == p_rhs.m_hook);
+    }
+
+
+private:
+    hook_type* m_hook {};
+};
+
+/** END ITERATOR **/
+
+
+
+/** START INTRUSIVE LIST **/
+
+/**
+ * Circular doubly linked list over objects that derive from list_hook<Tag>.
+ *
+ * The list never owns its elements: they are linked in and unlinked, never
+ * created, copied or destroyed. Given an object, erase(obj) and
+ * iterator_to(obj) are O(1). An object may be in one list per Tag at a
+ * time, and has to be erased ( or the list cleared ) before it dies.
+ * **/
+template <class T, class Tag> class intrusive_list final
+{
+    static_assert(std::is_base_of<list_hook<Tag>, T>::value, "T must derive from list_hook<Tag>");
+
+private: /** TYPE ALIAS **/
+    using hook_type = list_hook<Tag>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using iterator               = intrusive_iterator<T, Tag>;
+    using const_iterator         = intrusive_iterator<typename std::add_const<T>::type, Tag>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    intrusive_list() noexcept(true)
+    {
+        m_head.m_prev = &m_head;
+        m_head.m_next = &m_head;
+    }
+
+    /** RANGE CTOR ( links every object of the range, in order ) **/
+    template <std::input_iterator I, std::sentinel_for<I> S>
+    intrusive_list(I p_first, S p_last) noexcept(true)
+            requires(std::is_same<std::iter_reference_t<I>, reference>::value)
+        : intrusive_list()
+    {
+        for (; p_first != p_last; ++p_first) push_back(*p_first);
+    }
+
+    /** elements can not be in two lists of the same Tag **/
+    intrusive_list(intrusive_list const&) = delete;
+
+    /** MOVE CTOR **/
+    intrusive_list(intrusive_list&& p_other) noexcept(true) : intrusive_list()
+    {
+        swap(*this, p_other);
+    }
+
+    auto operator=(intrusive_list const&) -> intrusive_list& = delete;
+
+    /** MOVE ASSIGN ( what *this held is unlinked ) **/
+    auto operator=(intrusive_list&& p_other) noexcept(true) -> intrusive_list&
+    {
+        clear();
+        swap(*this, p_other);
+
+        return *this;
+    }
+
+
+public:
+    void push_front(reference) noexcept(true);
+    void push_back(reference) noexcept(true);
+
+    /** LINK `obj` IN FRONT OF `pos`, RETURNS AN ITERATOR TO IT **/
+    auto insert(const_iterator /* pos */, reference /* obj */) noexcept(true) -> iterator;
+
+
+public:
+    void pop_front() noexcept(true);
+    void pop_back() noexcept(true);
+
+    /** UNLINK `obj`, WHICH MUST BE IN *this; RETURNS THE ELEMENT THAT FOLLOWED IT **/
+    auto erase(reference /* obj */) noexcept(true) -> iterator;
+    auto erase(const_iterator /* pos */) noexcept(true) -> iterator;
+
+    /** UNLINK EVERY ELEMENT **/
+    void clear() noexcept(true);
+
+
+public:
+    [[nodiscard]] auto front() const noexcept(true) -> const_reference;
+    [[nodiscard]] auto front()       noexcept(true) -> reference;
+
+    [[nodiscard]] auto back() const noexcept(true) -> const_reference;
+    [[nodiscard]] auto back()       noexcept(true) -> reference;
+
+
+public:
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+
+public: /** ITERATOR FROM OBJECT, O(1) ( `obj` must be in *this ) **/
+    [[nodiscard]] auto iterator_to(reference)       const noexcept(true) -> iterator;
+    [[nodiscard]] auto iterator_to(const_reference) const noexcept(true) -> const_iterator;
+
+
+public:
+    auto begin() const noexcept(true) -> const_iterator;
+    auto begin()       noexcept(true) -> iterator;
+
+    auto end() const noexcept(true) -> const_iterator;
+    auto end()       noexcept(true) -> iterator;
+
+    auto rbegin() const noexcept(true) -> const_reverse_iterator;
+    auto rbegin()       noexcept(true) -> reverse_iterator;
+
+    auto rend() const noexcept(true) -> const_reverse_iterator;
+    auto rend()       noexcept(true) -> reverse_iterator;
+
+
+public:
+    friend void swap(intrusive_list& p_lhs, intrusive_list& p_rhs) noexcept(true)
+    {
+        if (&p_lhs == &p_rhs) return;
+
+        p_lhs.exchange(p_rhs);
+    }
+
+
+public:
+    /** UNLINKS WHATEVER IS STILL IN THE LIST **/
+    ~intrusive_list() noexcept(true);
+
+
+private:
+    static auto hook_of(reference p_obj) noexcept(true) -> hook_type& { return static_cast<hook_type&>(p_obj); }
+
+    /** SWAP THE CONTENTS, THE SENTINELS STAY WHERE THEY ARE **/
+    void exchange(intrusive_list& /* other */) noexcept(true);
+
+    /** TAKE OVER THE ENDS FROM THE SENTINEL AT `old` **/
+    void rehome(hook_type* /* old */) noexcept(true);
+
+    void unlink(hook_type* /* hook */) noexcept(true);
+
+private:
+    hook_type m_head;
+    size_type m_size {};
+};
+
+/** END INTRUSIVE LIST **/
+
+
+/** **/
+//  //
+/** **/
+
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::push_front(reference p_obj) noexcept(true)
+{
+    insert(begin(), p_obj);
+}
+
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::push_back(reference p_obj) noexcept(true)
+{
+    insert(end(), p_obj);
+}
+
+
+template <class T, class Tag>
+auto intrusive_list<T, Tag>::insert(const_iterator p_pos, reference p_obj) noexcept(true) -> iterator
+{
+    hook_type& v_hook = hook_of(p_obj);
+    hook_type* v_next = const_cast<hook_type*>(p_pos.m_hook);
+
+    assert(not v_hook.is_linked());
+
+    v_hook.m_prev          = v_next->m_prev;
+    v_hook.m_next          = v_next;
+    v_next->m_prev->m_next = &v_hook;
+    v_next->m_prev         = &v_hook;
+
+    m_size = m_size + 1ul;
+
+    return iterator{&v_hook};
+}
+
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::pop_front() noexcept(true)
+{
+    assert(not empty());
+
+    unlink(m_head.m_next);
+}
+
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::pop_back() noexcept(true)
+{
+    assert(not empty());
+
+    unlink(m_head.m_prev);
+}
+
+
+template <class T, class Tag>
+auto intrusive_list<T, Tag>::erase(reference p_obj) noexcept(true) -> iterator
+{
+    hook_type& v_hook = hook_of(p_obj);
+
+    assert(v_hook.is_linked());
+
+    hook_type* v_next = v_hook.m_next;
+
+    unlink(&v_hook);
+
+    return iterator{v_next};
+}
+
+
+template <class T, class Tag>
+auto intrusive_list<T, Tag>::erase(const_iterator p_pos) noexcept(true) -> iterator
+{
+    assert(p_pos != end());
+
+    return erase(const_cast<reference>(*p_pos));
+}
+
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::clear() noexcept(true)
+{
+    hook_type* v_hook = m_head.m_next;
+
+    while (v_hook != &m_head)
+    {
+        hook_type* v_next = v_hook->m_next;
+
+        v_hook->m_prev = nullptr;
+        v_hook->m_next = nullptr;
+
+        v_hook = v_next;
+    }
+
+    m_head.m_prev = &m_head;
+    m_head.m_next = &m_head;
+
+    m_size = 0ul;
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_list<T, Tag>::front() const noexcept(true) -> const_reference
+{
+    assert(not empty());
+
+    return *begin();
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_list<T, Tag>::front() noexcept(true) -> reference
+{
+    assert(not empty());
+
+    return *begin();
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_list<T, Tag>::back() const noexcept(true) -> const_reference
+{
+    assert(not empty());
+
+    return *std::prev(end());
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_list<T, Tag>::back() noexcept(true) -> reference
+{
+    assert(not empty());
+
+    return *std::prev(end());
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_list<T, Tag>::empty() const noexcept(true) -> bool
+{
+    return (m_size == 0ul);
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_list<T, Tag>::size() const noexcept(true) -> size_type
+{
+    return m_size;
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_list<T, Tag>::iterator_to(reference p_obj) const noexcept(true) -> iterator
+{
+    assert(hook_of(p_obj).is_linked());
+
+    return iterator{&hook_of(p_obj)};
+}
+
+
+template <class T, class Tag>
+[[nodiscard]] auto intrusive_list<T, Tag>::iterator_to(const_reference p_obj) const noexcept(true) -> const_iterator
+{
+    assert(static_cast<hook_type const&>(p_obj).is_linked());
+
+    return const_iterator{&static_cast<hook_type const&>(p_obj)};
+}
+
+
+template <class T, class Tag>
+auto intrusive_list<T, Tag>::begin() const noexcept(true) -> const_iterator
+{
+    return const_iterator{m_head.m_next};
+}
+
+
+template <class T, class Tag>
+auto intrusive_list<T, Tag>::begin() noexcept(true) -> iterator
+{
+    return iterator{m_head.m_next};
+}
+
+
+template <class T, class Tag>
+auto intrusive_list<T, Tag>::end() const noexcept(true) -> const_iterator
+{
+    return const_iterator{&m_head};
+}
+
+
+template <class T, class Tag>
+auto intrusive_list<T, Tag>::end() noexcept(true) -> iterator
+{
+    return iterator{&m_head};
+}
+
+
+template <class T, class Tag>
+auto intrusive_list<T, Tag>::rbegin() const noexcept(true) -> const_reverse_iterator
+{
+    return const_reverse_iterator{end()};
+}
+
+
+template <class T, class Tag>
+auto intrusive_list<T, Tag>::rbegin() noexcept(true) -> reverse_iterator
+{
+    return reverse_iterator{end()};
+}
+
+
+template <class T, class Tag>
+auto intrusive_list<T, Tag>::rend() const noexcept(true) -> const_reverse_iterator
+{
+    return const_reverse_iterator{begin()};
+}
+
+
+template <class T, class Tag>
+auto intrusive_list<T, Tag>::rend() noexcept(true) -> reverse_iterator
+{
+    return reverse_iterator{begin()};
+}
+
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::exchange(intrusive_list& p_other) noexcept(true)
+{
+    std::swap(m_head.m_prev, p_other.m_head.m_prev);
+    std::swap(m_head.m_next, p_other.m_head.m_next);
+    std::swap(m_size,        p_other.m_size);
+
+    // the end nodes still point at the other sentinel
+    rehome(&p_other.m_head);
+    p_other.rehome(&m_head);
+}
+
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::rehome(hook_type* p_old) noexcept(true)
+{
+    if (m_head.m_next == p_old)
+    {
+        m_head.m_prev = &m_head;
+        m_head.m_next = &m_head;
+    }
+    else {
+        m_head.m_next->m_prev = &m_head;
+        m_head.m_prev->m_next = &m_head;
+    }
+}
+
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::unlink(hook_type* p_hook) noexcept(true)
+{
+    p_hook->m_prev->m_next = p_hook->m_next;
+    p_hook->m_next->m_prev = p_hook->m_prev;
+
+    p_hook->m_prev = nullptr;
+    p_hook->m_next = nullptr;
+
+    m_size = m_size - 1ul;
+}
+
+
+template <class T, class Tag>
+intrusive_list<T, Tag>::~intrusive_list() noexcept(true)
+{
+    clear();
+
+    // the sentinel is a hook too, and hooks die unlinked
+    m_head.m_prev = nullptr;
+    m_head.m_next = nullptr;
+}
+
+
+#endif
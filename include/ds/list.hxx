@@ -7,36 +7,32 @@
 #include <cassert>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <ranges>
 #include <type_traits>
 #include <utility>
 
+#include <ds/node_allocator.hxx>
+#include <ds/node_pool.hxx>
+#include <ds/output_sink.hxx>
 
 
 
-template <class> class list;
-template <class> class Iterator;
+template <class T, class = std::allocator<T>> class list;
+template <class> class list_iterator;
 template <class> class Forward;
 template <class> class Backward;
 
 
-/* START CONSTRAINTS */
-
-template <class T, class U>
-concept non_self =
-        not std::is_same<std::decay_t<T>, U>::value &&
-        not std::is_base_of<U, std::decay_t<T>>::value;
-
-/* END CONSTRAINTS */
-
 //
-template <class T> class node final
+template <class T> class list_node final
 {
 
 public:
-    friend class list<T>;
-    friend class Iterator<T>;
+    template <class, class> friend class list;
+    friend class list_iterator<T>;
     friend class Forward<T>;
     friend class Backward<T>;
 
@@ -52,7 +48,7 @@ public: /** TYPE ALIAS **/
 
 public: /** CONSTRUCTORS **/
     /** DEFAULT CTOR **/
-    node() noexcept(std::is_nothrow_default_constructible<T>::value)
+    list_node() noexcept(std::is_nothrow_default_constructible<T>::value)
             requires(std::is_default_constructible<T>::value)
         : m_data{T{}}
         , m_prev{this}
@@ -60,7 +56,7 @@ public: /** CONSTRUCTORS **/
     {}
 
     /** PARAM CTOR **/
-    explicit node(T const &p_data) noexcept(std::is_nothrow_copy_constructible<T>::value)
+    explicit list_node(T const &p_data) noexcept(std::is_nothrow_copy_constructible<T>::value)
             requires(std::is_copy_constructible<T>::value)
         : m_data{p_data}
         , m_prev{this}
@@ -68,7 +64,7 @@ public: /** CONSTRUCTORS **/
     {}
 
     /** PARAM CTOR (rvalue ref) **/
-    explicit node(T &&p_data) noexcept(std::is_nothrow_move_constructible<T>::value)
+    explicit list_node(T &&p_data) noexcept(std::is_nothrow_move_constructible<T>::value)
             requires(std::is_move_constructible<T>::value)
         : m_data{std::move(p_data)}
         , m_prev{this}
@@ -77,7 +73,7 @@ public: /** CONSTRUCTORS **/
 
     /** **/
     template <class... ARGS>
-    node(std::in_place_t, ARGS &&...p_args) noexcept(std::is_nothrow_constructible<T,ARGS...>::value)
+    list_node(std::in_place_t, ARGS &&...p_args) noexcept(std::is_nothrow_constructible<T,ARGS...>::value)
             requires(std::is_constructible<T, ARGS...>::value)
         : m_data{T{std::forward<ARGS>(p_args)...}}
         , m_prev{this}
@@ -93,7 +89,7 @@ public: /** GETTERS **/
 
 
 private: /** HELPERS **/
-    void push_front(node* p_node) noexcept
+    void push_front(list_node* p_node) noexcept
     {
         p_node->m_next = m_next;
         p_node->m_prev = this;
@@ -101,7 +97,7 @@ private: /** HELPERS **/
         m_next = p_node;
     }
 
-    void push_back(node* p_node) noexcept
+    void push_back(list_node* p_node) noexcept
     {
         p_node->m_prev = m_prev;
         p_node->m_next = this;
@@ -113,8 +109,8 @@ private: /** HELPERS **/
 
 private:
     value_type m_data;
-    node*      m_prev;
-    node*      m_next;
+    list_node* m_prev;
+    list_node* m_next;
 };
 
 //  //
@@ -122,11 +118,11 @@ private:
 //* END NODE *//
 
 // //
-template <class T> class Iterator
+template <class T> class list_iterator
 {
 
 public: /** TYPE ALIAS **/
-    using node_type = node<T>;
+    using node_type = list_node<T>;
 
 public: /** TYPE ALIAS **/
     using value_type      = typename node_type::value_type;
@@ -142,23 +138,23 @@ public: /** CONSTRUCTORS **/
 
 
     /** DEFAULT CTOR **/
-    Iterator() noexcept = default;
+    list_iterator() noexcept = default;
 
     /** DEFAULT COPY CTOR **/
-    Iterator(Iterator const& ) noexcept = default;
+    list_iterator(list_iterator const& ) noexcept = default;
 
     /** DEFAULT MOVE CTOR **/
-    Iterator(Iterator&&) noexcept = default;
+    list_iterator(list_iterator&&) noexcept = default;
 
     /** PARAM CTOR **/
-    Iterator(node_type* p_node) noexcept : m_node(p_node) {}
+    list_iterator(node_type* p_node) noexcept : m_node(p_node) {}
 
 
     /** DEFAULT COPY ASSIGN **/
-    Iterator& operator=(Iterator const&) noexcept = default;
+    list_iterator& operator=(list_iterator const&) noexcept = default;
 
     /** DEFAULT MOVE ASSIGN **/
-    Iterator& operator=(Iterator&&) noexcept = default;
+    list_iterator& operator=(list_iterator&&) noexcept = default;
 
 
 
@@ -176,8 +172,8 @@ public:
 
 public:
     /** COMPAR OP **/
-    [[nodiscard]] friend auto operator==(Iterator const &p_lhs,
-                                         Iterator const &p_rhs) noexcept(true)
+    [[nodiscard]] friend auto operator==(list_iterator const &p_lhs,
+                                         list_iterator const &p_rhs) noexcept(true)
         -> bool
     {
         return (p_lhs.m_node == p_rhs.m_node);
@@ -197,14 +193,14 @@ protected:
 
 // //
 template <class T>
-class Forward final : public Iterator<T>
+class Forward final : public list_iterator<T>
 {
 
 protected:
-    using Iterator<T>::m_node;
+    using list_iterator<T>::m_node;
 
 public:
-    using Iterator<T>::Iterator;
+    using list_iterator<T>::list_iterator;
 
 
 public:
@@ -249,14 +245,14 @@ public:
 
 // //
 template <class T>
-class Backward final : public Iterator<T>
+class Backward final : public list_iterator<T>
 {
 
 protected:
-    using Iterator<T>::m_node;
+    using list_iterator<T>::m_node;
 
 public:
-    using Iterator<T>::Iterator;
+    using list_iterator<T>::list_iterator;
 
 
 public:
@@ -299,11 +295,13 @@ public:
 //*****//
 
 // //
-template <class T> class list final
+template <class T, class Allocator> class list final
 {
    
 private: /** TYPE ALIAS **/
-    using node_type = node<T>;
+    using node_type           = list_node<T>;
+    using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+    using alloc_traits        = std::allocator_traits<Allocator>;
 
 
 public:/** TYPE ALIAS **/
@@ -314,6 +312,7 @@ public:/** TYPE ALIAS **/
     using const_pointer   = typename node_type::const_pointer;
     using size_type       = std::size_t;
     using difference_type = std::ptrdiff_t;
+    using allocator_type  = Allocator;
 
     using iterator               = Forward<T>;
     using const_iterator         = Forward<typename std::add_const<T>::type>;
@@ -326,10 +325,18 @@ public: /** CONSTRUCTORS **/
 
 
     /** DEFAULT CTOR **/
-    list() noexcept(std::is_nothrow_default_constructible<T>::value);
+    list() noexcept(std::is_nothrow_default_constructible<T>::value &&
+                    std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** ALLOCATOR CTOR **/
+    explicit list(Allocator const&) noexcept(std::is_nothrow_default_constructible<T>::value);
 
     /** COPY CTOR **/
-    list(list const&) noexcept(std::is_nothrow_copy_constructible<T>::value);
+    list(list const&) noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                               std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** COPY CTOR ( allocator-extended ) **/
+    list(list const&, Allocator const&) noexcept(std::is_nothrow_copy_constructible<T>::value);
 
     /** MOVE CTOR **/
     list(list&&) noexcept(true);
@@ -338,14 +345,14 @@ public: /** CONSTRUCTORS **/
     * INITIALIZER_LIST CTOR 
     * (Construct with the contents of the initializer list)
     * **/
-    list(std::initializer_list<T>) noexcept(std::is_nothrow_copy_constructible<T>::value);
+    list(std::initializer_list<T>, Allocator const& = Allocator()) noexcept(std::is_nothrow_copy_constructible<T>::value);
 
     /**
     * RANGE CTOR
     * (Construct with the contents of the range)
     * **/
     template <std::ranges::range R>
-    list(R&&) noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+    list(R&&, Allocator const& = Allocator()) noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
         requires(non_self<R, list> &&
                  std::is_constructible<T, std::ranges::range_value_t<R>>::value);
 
@@ -354,7 +361,7 @@ public: /** CONSTRUCTORS **/
     * (Construct with the contents of the range [ begin, end ])
     * **/
     template <std::input_iterator I, std::sentinel_for<I> S>
-    list(I, S) noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+    list(I, S, Allocator const& = Allocator()) noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
         requires(std::is_constructible<T, std::iter_value_t<I>>::value);
 
 
@@ -410,10 +417,68 @@ public:
     void emplace_at(std::integral auto, ARGS&& ...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
 
 
+public: /** BULK ( the nodes are chained off to the side and linked in with one splice ) **/
+    template <std::ranges::range R>
+    void append_range(R&&) noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_reference_t<R>>::value);
+
+    /** ( the range keeps its order in front of the current elements ) **/
+    template <std::ranges::range R>
+    void prepend_range(R&&) noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_reference_t<R>>::value);
+
+
 public:
     void pop_front() noexcept(std::is_nothrow_destructible<T>::value);
     void pop_back() noexcept(std::is_nothrow_destructible<T>::value);
 
+    /** MOVE UP TO `count` ELEMENTS INTO `out`, FRONT FIRST; RETURNS HOW MANY **/
+    template <std::weakly_incrementable O>
+    auto pop_n(size_type, O) noexcept(nothrow_sink<O, T>) -> size_type
+        requires(std::indirectly_writable<O, T&&>);
+
+    /** MOVE EVERY ELEMENT INTO `out`, FRONT FIRST; RETURNS HOW MANY **/
+    template <std::weakly_incrementable O>
+    auto drain(O) noexcept(nothrow_sink<O, T>) -> size_type
+        requires(std::indirectly_writable<O, T&&>);
+
+
+public: /** REORDERING ( nodes are relinked, never allocated or copied ) **/
+
+    /** STABLE BOTTOM-UP MERGE SORT, O(n log n) COMPARES AND O(1) EXTRA MEMORY **/
+    void sort() noexcept(std::is_nothrow_invocable<std::less<>&, const_reference, const_reference>::value);
+
+    template <class Compare>
+    void sort(Compare) noexcept(std::is_nothrow_invocable<Compare&, const_reference, const_reference>::value);
+
+    /** MOVE EVERY NODE OF `other` IN; BOTH SORTED, EQUAL ELEMENTS OF *this GO FIRST **/
+    void merge(list& /* other */) noexcept(std::is_nothrow_invocable<std::less<>&, const_reference, const_reference>::value);
+
+    template <class Compare>
+    void merge(list& /* other */, Compare) noexcept(std::is_nothrow_invocable<Compare&, const_reference, const_reference>::value);
+
+    /**
+    * SPLICE
+    * ( moves nodes of `other` in front of element `pos`, pos == size() appends;
+    *   the allocators must compare equal )
+    * **/
+    void splice(std::integral auto /* pos */, list& /* other */) noexcept(true);
+
+    /** ( the single element `index` of `other` ) **/
+    void splice(std::integral auto /* pos */, list& /* other */, std::integral auto /* index */) noexcept(true);
+
+    /** ( the elements [ first, last ) of `other`, which may be *this if pos is outside of them ) **/
+    void splice(std::integral auto /* pos */, list& /* other */,
+                std::integral auto /* first */, std::integral auto /* last */) noexcept(true);
+
+    /** DROP EVERY ELEMENT EQUAL TO THE ONE KEPT BEFORE IT; RETURNS HOW MANY **/
+    auto unique() noexcept(std::is_nothrow_destructible<T>::value) -> size_type;
+
+    template <class BinaryPredicate>
+    auto unique(BinaryPredicate)
+        noexcept(std::is_nothrow_invocable<BinaryPredicate&, const_reference, const_reference>::value &&
+                 std::is_nothrow_destructible<T>::value) -> size_type;
+
 
 
 
@@ -431,6 +496,17 @@ public:
     [[nodiscard]] auto size() const noexcept(true) -> size_type;
 
 
+public:
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+
+public: /** NODE POOL ( only with a pooling allocator, see node_pool.hxx ) **/
+    /** keep enough free nodes around for `count` elements in total **/
+    void reserve(size_type /* count */) requires(node_pooling<node_allocator_type>);
+
+    void shrink_to_fit() noexcept(true) requires(node_pooling<node_allocator_type>);
+
+
 public:    
     auto begin() const noexcept(true) -> iterator;
     auto begin()       noexcept(true) -> iterator;
@@ -456,6 +532,8 @@ public:
     {
         std::swap(p_lhs.m_head, p_rhs.m_head);
         std::swap(p_lhs.m_size, p_rhs.m_size);
+
+        swap_allocators(p_lhs.m_alloc, p_rhs.m_alloc);
     }
 
 
@@ -494,7 +572,45 @@ private:
         return v_temp;
     }
 
+    /** ELEMENT `pos`, THE SENTINEL WHEN pos == size() **/
+    auto node_at(std::integral auto p_pos) const noexcept(true) -> node_type*
+    {
+        assert(static_cast<size_type>(p_pos) <= m_size);
+
+        return (static_cast<size_type>(p_pos) == m_size) ? m_head : find_at(p_pos);
+    }
+
+private:
+    /** CUT THE CHAIN AFTER `count` NODES, RETURNS WHAT WAS BEHIND THEM ( m_prev IS LEFT ALONE ) **/
+    static auto cut(node_type* p_head, size_type p_count) noexcept(true) -> node_type*
+    {
+        for (; p_head && p_count > 1ul; p_count = p_count - 1ul) p_head = p_head->m_next;
+
+        if (p_head == nullptr) return nullptr;
+
+        node_type* v_rest = p_head->m_next;
+        p_head->m_next    = nullptr;
+
+        return v_rest;
+    }
+
+    /** MERGE TWO SORTED CHAINS ONTO `tail`; lhs AND rhs ALWAYS HOLD WHAT IS NOT MERGED YET **/
+    template <class Compare>
+    static void merge_chains(node_type*& /* lhs */, node_type*& /* rhs */, node_type**& /* tail */, Compare&);
+
+    /** BOTTOM-UP MERGE SORT OF A NULL TERMINATED CHAIN, FOLLOWING m_next ONLY **/
+    template <class Compare>
+    static void sort_chain(node_type*& /* head */, size_type /* size */, Compare&);
+
 private:
+    /** BUILD A CHAIN FROM THE RANGE AND SPLICE IT IN RIGHT AFTER `pos` **/
+    template <class R>
+    void link_range(node_type* /* pos */, R&&)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value);
+
+private:
+    [[no_unique_address]] node_allocator_type m_alloc;
+
     node_type* m_head;
     size_type  m_size;
 
@@ -504,12 +620,12 @@ private:
 
 //*****//
 
-template <class T>
+template <class T, class Allocator>
 template <std::input_iterator I, std::sentinel_for<I> S>
-list<T>::list(I p_first, S p_last)
+list<T, Allocator>::list(I p_first, S p_last, Allocator const& p_alloc)
         noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
         requires(std::is_constructible<T, std::iter_value_t<I>>::value)
-    : list{}
+    : list(p_alloc)
 {
     using std::placeholders::_1;
 
@@ -519,24 +635,24 @@ list<T>::list(I p_first, S p_last)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <std::ranges::range R>
-list<T>::list(R&& p_list)
+list<T, Allocator>::list(R&& p_list, Allocator const& p_alloc)
         noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
         requires(non_self<R, list> &&
                  std::is_constructible<T, std::ranges::range_value_t<R>>::value)
-    : list(std::ranges::begin(p_list), std::ranges::end(p_list))
+    : list(std::ranges::begin(p_list), std::ranges::end(p_list), p_alloc)
 {}
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void list<T>::push_front(U&& p_data) noexcept(std::is_nothrow_constructible<T, U>::value)
+void list<T, Allocator>::push_front(U&& p_data) noexcept(std::is_nothrow_constructible<T, U>::value)
     requires(std::is_constructible<T, U>::value)
 {
     if( not m_head ) return;
 
-    if ( auto v_node = new(std::nothrow) node_type(std::forward<U>(p_data)) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::forward<U>(p_data)) )
     {
         m_head->push_front(v_node);
         
@@ -545,14 +661,14 @@ void list<T>::push_front(U&& p_data) noexcept(std::is_nothrow_constructible<T, U
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void list<T>::push_back(U&& p_data) noexcept(std::is_nothrow_constructible<T, U>::value)
+void list<T, Allocator>::push_back(U&& p_data) noexcept(std::is_nothrow_constructible<T, U>::value)
     requires(std::is_constructible<T, U>::value)
 {
     if ( not m_head ) return;
 
-    if ( auto v_node = new(std::nothrow) node_type(std::forward<U>(p_data)) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::forward<U>(p_data)) )
     {
         m_head->push_back(v_node);
         
@@ -561,15 +677,15 @@ void list<T>::push_back(U&& p_data) noexcept(std::is_nothrow_constructible<T, U>
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void list<T>::push_before(U&& p_data, std::integral auto p_pos)
+void list<T, Allocator>::push_before(U&& p_data, std::integral auto p_pos)
     noexcept(std::is_nothrow_constructible<T, U>::value)
     requires(std::is_constructible<T, U>::value)
 {
     if ( not m_head ) return;
 
-    if ( auto v_node = new(std::nothrow) node_type(std::forward<U>(p_data)) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::forward<U>(p_data)) )
     {
         find_at(p_pos)->push_back(v_node);
         
@@ -578,15 +694,15 @@ void list<T>::push_before(U&& p_data, std::integral auto p_pos)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void list<T>::push_after(U&& p_data, std::integral auto p_pos)
+void list<T, Allocator>::push_after(U&& p_data, std::integral auto p_pos)
     noexcept(std::is_nothrow_constructible<T, U>::value)
     requires(std::is_constructible<T, U>::value)
 {
     if ( not m_head ) return;
 
-    if ( auto v_node = new(std::nothrow) node_type(std::forward<U>(p_data)) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::forward<U>(p_data)) )
     {
         find_at(p_pos)->push_front(v_node);
         
@@ -595,9 +711,9 @@ void list<T>::push_after(U&& p_data, std::integral auto p_pos)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void list<T>::push_at(U&& p_data, std::integral auto p_pos)
+void list<T, Allocator>::push_at(U&& p_data, std::integral auto p_pos)
     noexcept(std::is_nothrow_constructible<T, U>::value)
     requires(std::is_constructible<T, U>::value)
 {
@@ -606,14 +722,14 @@ void list<T>::push_at(U&& p_data, std::integral auto p_pos)
 
 
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void list<T>::emplace_front(ARGS&& ...p_args)
+void list<T, Allocator>::emplace_front(ARGS&& ...p_args)
     noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
     if ( not m_head ) return;
 
-    if ( auto v_node = new node_type(std::in_place,std::forward<ARGS>(p_args)...) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::in_place, std::forward<ARGS>(p_args)...) )
     {
         m_head->push_front(v_node);
         
@@ -621,14 +737,14 @@ void list<T>::emplace_front(ARGS&& ...p_args)
     }
 }
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void list<T>::emplace_back(ARGS&& ...p_args)
+void list<T, Allocator>::emplace_back(ARGS&& ...p_args)
     noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
     if ( not m_head ) return;
 
-    if ( auto v_node = new node_type(std::in_place, std::forward<ARGS>(p_args)...) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::in_place, std::forward<ARGS>(p_args)...) )
     {
         m_head->push_back(v_node);
         
@@ -636,14 +752,14 @@ void list<T>::emplace_back(ARGS&& ...p_args)
     }
 }
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void list<T>::emplace_before(std::integral auto p_pos, ARGS&& ...p_args)    
+void list<T, Allocator>::emplace_before(std::integral auto p_pos, ARGS&& ...p_args)    
     noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
     if ( not m_head ) return;
 
-    if ( auto v_node = new node_type(std::in_place, std::forward<ARGS>(p_args)...) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::in_place, std::forward<ARGS>(p_args)...) )
     {
         find_at(p_pos)->push_back(v_node);
         
@@ -651,14 +767,14 @@ void list<T>::emplace_before(std::integral auto p_pos, ARGS&& ...p_args)
     }
 }
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void list<T>::emplace_after(std::integral auto p_pos, ARGS&& ...p_args)
+void list<T, Allocator>::emplace_after(std::integral auto p_pos, ARGS&& ...p_args)
     noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
     if ( not m_head ) return;
 
-    if ( auto v_node = new node_type(std::in_place, std::forward<ARGS>(p_args)...) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::in_place, std::forward<ARGS>(p_args)...) )
     {
         find_at(p_pos)->push_front(v_node);
         
@@ -667,9 +783,9 @@ void list<T>::emplace_after(std::integral auto p_pos, ARGS&& ...p_args)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void list<T>::emplace_at(std::integral auto p_pos, ARGS&& ...p_args)
+void list<T, Allocator>::emplace_at(std::integral auto p_pos, ARGS&& ...p_args)
     noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
     if ( not m_head ) return;
@@ -678,19 +794,423 @@ void list<T>::emplace_at(std::integral auto p_pos, ARGS&& ...p_args)
 
 
 
+template <class T, class Allocator>
+template <class R>
+void list<T, Allocator>::link_range(node_type* p_pos, R&& p_range)
+    noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+{
+    reserve_nodes(m_alloc, p_range);
+
+    node_type* v_first = nullptr;
+    node_type* v_last  = nullptr;
+    size_type  v_count = 0ul;
+
+    auto v_build = [&]() -> void
+    {
+        for (auto&& v_elem : p_range)
+        {
+            node_type* v_node = allocate_node<node_type>(m_alloc, std::forward<decltype(v_elem)>(v_elem));
+
+            if (v_node == nullptr) break;
+
+            if (v_last) { v_last->m_next = v_node; v_node->m_prev = v_last; }
+            else        { v_first = v_node; }
+
+            v_last  = v_node;
+            v_count = v_count + 1ul;
+        }
+    };
+
+    if constexpr (std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+    {
+        v_build();
+    }
+    else {
+        // all or nothing: the list is untouched until the chain is complete
+        try {
+            v_build();
+        }
+        catch (...) {
+            while (v_count)
+            {
+                node_type* v_next = v_first->m_next;
+
+                deallocate_node(m_alloc, v_first);
+
+                v_first = v_next;
+                v_count = v_count - 1ul;
+            }
+
+            throw;
+        }
+    }
+
+    if (v_first == nullptr) return;
+
+    v_last->m_next          = p_pos->m_next;
+    p_pos->m_next->m_prev   = v_last;
+    v_first->m_prev         = p_pos;
+    p_pos->m_next           = v_first;
+
+    m_size = m_size + v_count;
+}
+
+
+template <class T, class Allocator>
+template <std::ranges::range R>
+void list<T, Allocator>::append_range(R&& p_range)
+    noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+    requires(std::is_constructible<T, std::ranges::range_reference_t<R>>::value)
+{
+    if ( not m_head ) return;
+
+    link_range(m_head->m_prev, std::forward<R>(p_range));
+}
+
+
+template <class T, class Allocator>
+template <std::ranges::range R>
+void list<T, Allocator>::prepend_range(R&& p_range)
+    noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+    requires(std::is_constructible<T, std::ranges::range_reference_t<R>>::value)
+{
+    if ( not m_head ) return;
+
+    link_range(m_head, std::forward<R>(p_range));
+}
+
+
+template <class T, class Allocator>
+template <std::weakly_incrementable O>
+auto list<T, Allocator>::pop_n(size_type p_count, O p_out)
+    noexcept(nothrow_sink<O, T>) -> size_type
+    requires(std::indirectly_writable<O, T&&>)
+{
+    if ( not m_head ) return 0ul;
+
+    node_type* v_node = m_head->m_next;
+    size_type  v_done = 0ul;
+
+    auto v_drain = [&]() -> void
+    {
+        for (; (v_done < p_count) && (v_node != m_head); ++v_done, ++p_out)
+        {
+            *p_out = std::move(v_node->m_data);
+
+            node_type* v_next = v_node->m_next;
+
+            deallocate_node(m_alloc, v_node);
+
+            v_node = v_next;
+        }
+    };
+
+    // relink once, behind whatever was moved out
+    auto v_relink = [&]() -> void
+    {
+        m_head->m_next = v_node;
+        v_node->m_prev = m_head;
+
+        m_size = m_size - v_done;
+    };
+
+    if constexpr (nothrow_sink<O, T>)
+    {
+        v_drain();
+    }
+    else {
+        // the element whose move ( or write ) threw stays in front
+        try {
+            v_drain();
+        }
+        catch (...) {
+            v_relink();
+            throw;
+        }
+    }
+
+    v_relink();
+
+    return v_done;
+}
+
+
+template <class T, class Allocator>
+template <std::weakly_incrementable O>
+auto list<T, Allocator>::drain(O p_out)
+    noexcept(nothrow_sink<O, T>) -> size_type
+    requires(std::indirectly_writable<O, T&&>)
+{
+    return pop_n(m_size, std::move(p_out));
+}
+
+
+template <class T, class Allocator>
+template <class Compare>
+void list<T, Allocator>::merge_chains(node_type*& p_lhs, node_type*& p_rhs, node_type**& p_tail, Compare& p_comp)
+{
+    while (p_lhs && p_rhs)
+    {
+        // ties go left, which keeps the sort stable
+        node_type*& v_take = p_comp(p_rhs->m_data, p_lhs->m_data) ? p_rhs : p_lhs;
+        node_type*  v_node = v_take;
+
+        v_take  = v_node->m_next;
+        *p_tail = v_node;
+        p_tail  = &v_node->m_next;
+    }
+
+    *p_tail = p_lhs ? p_lhs : p_rhs;
+
+    p_lhs = nullptr;
+    p_rhs = nullptr;
+
+    while (*p_tail) p_tail = &(*p_tail)->m_next;
+}
+
+
+template <class T, class Allocator>
+template <class Compare>
+void list<T, Allocator>::sort_chain(node_type*& p_head, size_type p_size, Compare& p_comp)
+{
+    for (size_type v_width = 1ul; v_width < p_size; v_width = v_width << 1ul)
+    {
+        node_type*  v_done = nullptr;
+        node_type** v_tail = &v_done;
+        node_type*  v_rest = p_head;
+        node_type*  v_lhs  = nullptr;
+        node_type*  v_rhs  = nullptr;
+
+        try {
+            while (v_rest)
+            {
+                v_lhs  = v_rest;
+                v_rhs  = cut(v_lhs, v_width);
+                v_rest = cut(v_rhs, v_width);
+
+                merge_chains(v_lhs, v_rhs, v_tail, p_comp);
+            }
+        }
+        catch (...) {
+            // the comparison threw: chain everything back up, in whatever order it is
+            for (node_type* v_part : {v_lhs, v_rhs, v_rest})
+            {
+                *v_tail = v_part;
+
+                while (*v_tail) v_tail = &(*v_tail)->m_next;
+            }
+
+            p_head = v_done;
+            throw;
+        }
+
+        p_head = v_done;
+    }
+}
+
+
+template <class T, class Allocator>
+template <class Compare>
+void list<T, Allocator>::sort(Compare p_comp)
+    noexcept(std::is_nothrow_invocable<Compare&, const_reference, const_reference>::value)
+{
+    if ( not m_head || m_size < 2ul ) return;
+
+    // sort as a singly linked chain, then lay the m_prev links and the ring again
+    node_type* v_first = m_head->m_next;
+
+    m_head->m_prev->m_next = nullptr;
+
+    auto v_relink = [&]() -> void
+    {
+        node_type* v_prev = m_head;
+
+        for (node_type* v_node = v_first; v_node; v_node = v_node->m_next)
+        {
+            v_node->m_prev = v_prev;
+            v_prev         = v_node;
+        }
+
+        v_prev->m_next = m_head;
+        m_head->m_prev = v_prev;
+        m_head->m_next = v_first;
+    };
+
+    if constexpr (std::is_nothrow_invocable<Compare&, const_reference, const_reference>::value)
+    {
+        sort_chain(v_first, m_size, p_comp);
+    }
+    else {
+        try {
+            sort_chain(v_first, m_size, p_comp);
+        }
+        catch (...) {
+            v_relink();
+            throw;
+        }
+    }
+
+    v_relink();
+}
+
+
+template <class T, class Allocator>
+template <class Compare>
+void list<T, Allocator>::merge(list& p_other, Compare p_comp)
+    noexcept(std::is_nothrow_invocable<Compare&, const_reference, const_reference>::value)
+{
+    if ( not m_head || not p_other.m_head || &p_other == this ) return;
+
+    assert(get_allocator() == p_other.get_allocator());
+
+    node_type* v_curr = m_head->m_next;
+
+    // one node at a time, so both lists are whole if the comparison throws
+    while ( (p_other.m_size != 0ul) && (v_curr != m_head) )
+    {
+        node_type* v_node = p_other.m_head->m_next;
+
+        if (p_comp(v_node->m_data, v_curr->m_data))
+        {
+            v_node->m_prev->m_next = v_node->m_next;
+            v_node->m_next->m_prev = v_node->m_prev;
+
+            v_curr->push_back(v_node);
+
+            m_size         = m_size + 1ul;
+            p_other.m_size = p_other.m_size - 1ul;
+        }
+        else {
+            v_curr = v_curr->m_next;
+        }
+    }
+
+    splice(m_size, p_other);
+}
+
+
+template <class T, class Allocator>
+void list<T, Allocator>::splice(std::integral auto p_pos, list& p_other) noexcept(true)
+{
+    if ( not p_other.m_head ) return;
+
+    splice(p_pos, p_other, 0ul, p_other.m_size);
+}
+
+
+template <class T, class Allocator>
+void list<T, Allocator>::splice(std::integral auto p_pos, list& p_other, std::integral auto p_index) noexcept(true)
+{
+    splice(p_pos, p_other, p_index, p_index + 1ul);
+}
+
+
+template <class T, class Allocator>
+void list<T, Allocator>::splice(std::integral auto p_pos, list& p_other,
+                                std::integral auto p_first, std::integral auto p_last) noexcept(true)
+{
+    const size_type v_pos   = static_cast<size_type>(p_pos);
+    const size_type v_first = static_cast<size_type>(p_first);
+    const size_type v_last  = static_cast<size_type>(p_last);
+
+    if ( not m_head || v_first >= v_last ) return;
+
+    assert(v_last <= p_other.m_size);
+    assert(get_allocator() == p_other.get_allocator());
+
+    if (&p_other == this)
+    {
+        assert(v_pos <= v_first || v_pos >= v_last);
+
+        // already in front of element `pos`
+        if (v_pos == v_first || v_pos == v_last) return;
+    }
+
+    // find every node first: with &p_other == this, unlinking moves the indices
+    node_type* v_where = node_at(v_pos);
+    node_type* v_head  = p_other.node_at(v_first);
+    node_type* v_end   = p_other.node_at(v_last);
+    node_type* v_tail  = v_end->m_prev;
+
+    v_head->m_prev->m_next = v_end;
+    v_end->m_prev          = v_head->m_prev;
+
+    v_head->m_prev          = v_where->m_prev;
+    v_tail->m_next          = v_where;
+    v_where->m_prev->m_next = v_head;
+    v_where->m_prev         = v_tail;
+
+    if (&p_other != this)
+    {
+        m_size         = m_size + (v_last - v_first);
+        p_other.m_size = p_other.m_size - (v_last - v_first);
+    }
+}
+
+
+template <class T, class Allocator>
+template <class BinaryPredicate>
+auto list<T, Allocator>::unique(BinaryPredicate p_pred)
+    noexcept(std::is_nothrow_invocable<BinaryPredicate&, const_reference, const_reference>::value &&
+             std::is_nothrow_destructible<T>::value) -> size_type
+{
+    if ( not m_head || m_size < 2ul ) return 0ul;
+
+    size_type  v_count = 0ul;
+    node_type* v_keep  = m_head->m_next;
+
+    while (v_keep->m_next != m_head)
+    {
+        node_type* v_next = v_keep->m_next;
+
+        if (p_pred(v_keep->m_data, v_next->m_data))
+        {
+            v_keep->m_next         = v_next->m_next;
+            v_next->m_next->m_prev = v_keep;
+            v_next                 = (deallocate_node(m_alloc, v_next), nullptr);
+
+            m_size  = m_size - 1ul;
+            v_count = v_count + 1ul;
+        }
+        else {
+            v_keep = v_next;
+        }
+    }
+
+    return v_count;
+}
+
+
+
 /** USER DEFINED TYPE DEDUCTION **/
 template <std::ranges::range R>  list( R ) -> list<std::ranges::range_value_t<R>>;
 template <std::input_iterator I, std::sentinel_for<I> S> list( I, S ) -> list<std::iter_value_t<I>>;
 
 
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <class T>
+    using list = ::list<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+/** NODE POOL ALIAS **/
+namespace pooled
+{
+    template <class T>
+    using list = ::list<T, pool_allocator<T>>;
+}
+
+
 
 
 /**
 * This specialization of std::ranges::enable_borrowed_range 
 * makes list satisfy borrowed_range 
 * **/
-template <class T>
-inline constexpr bool std::ranges::enable_borrowed_range<list<T>> = true;
+template <class T, class Allocator>
+inline constexpr bool std::ranges::enable_borrowed_range<list<T, Allocator>> = true;
 
 
 
@@ -0,0 +1,345 @@
+#ifndef MPMC_QUEUE_HXX
+#define MPMC_QUEUE_HXX
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <semaphore>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <ds/cache_line.hxx>
+#include <ds/container_stats.hxx>
+
+
+/** START CONSTRAINTS **/
+
+/** elements leave their slot while it is claimed, a throwing move would wedge the ring **/
+template <class T>
+concept mpmc_value = std::is_nothrow_move_constructible<T>::value && std::is_nothrow_destructible<T>::value;
+
+/** END CONSTRAINTS **/
+
+
+template <mpmc_value T, class = std::allocator<T>> class mpmc_queue;
+
+
+/** START SLOT **/
+
+template <class T> class mpmc_slot final
+{
+
+public:
+    template <mpmc_value, class> friend class mpmc_queue;
+
+public: /** CONSTRUCTORS **/
+    explicit mpmc_slot(std::size_t p_turn) noexcept(true) : m_turn(p_turn) {}
+
+    mpmc_slot(mpmc_slot const&) = delete;
+
+    auto operator=(mpmc_slot const&) -> mpmc_slot& = delete;
+
+
+private:
+    auto data() noexcept(true) -> T*
+    {
+        return std::launder(reinterpret_cast<T*>(m_storage));
+    }
+
+private:
+    /**
+     * lap counter: equals the ticket of the producer allowed in,
+     * ticket + 1 once the element is there for that ticket's consumer
+     * **/
+    alignas(cache_line_size) std::atomic<std::size_t> m_turn;
+
+    alignas(T) std::byte m_storage[sizeof(T)];
+};
+
+/** END SLOT **/
+
+
+
+/** START MPMC QUEUE **/
+
+/**
+ * Bounded many-producer / many-consumer queue ( per-slot sequence ring,
+ * after D. Vyukov ).
+ *
+ * Producers and consumers each draw tickets from their own counter; a
+ * ticket maps to one slot, whose turn counter says when it is that
+ * ticket's go. Threads only ever contend on the counter of their own side
+ * and on the one slot they were handed, each on its own cache line.
+ *
+ * try_push / try_pop never block. push / pop take a ticket and sleep on
+ * the slot with atomic wait / notify until its turn comes. pop_for waits
+ * on a doorbell producers only ring while somebody is listening.
+ * **/
+template <mpmc_value T, class Allocator> class mpmc_queue final
+{
+
+public: /** TYPE ALIAS **/
+    using slot_type = mpmc_slot<T>;
+
+private: /** TYPE ALIAS **/
+    using slot_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<slot_type>;
+    using slot_traits         = std::allocator_traits<slot_allocator_type>;
+    using alloc_traits        = std::allocator_traits<Allocator>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using size_type       = std::size_t;
+    using allocator_type  = Allocator;
+
+
+public: /** CONSTRUCTORS **/
+
+    /**
+    * CAPACITY CTOR
+    * ( capacity rounded up to a power of two, at least 2; 0 when out of memory )
+    * **/
+    explicit mpmc_queue(size_type /* capacity */, Allocator const& = Allocator()) noexcept(true);
+
+    mpmc_queue(mpmc_queue const&) = delete;
+
+    auto operator=(mpmc_queue const&) -> mpmc_queue& = delete;
+
+
+public: /** NON BLOCKING **/
+    template <class U>
+    [[nodiscard]] auto try_push(U&&) noexcept(std::is_nothrow_constructible<T, U>::value) -> bool
+        requires(std::is_constructible<T, U>::value);
+
+    template <class... ARGS>
+    [[nodiscard]] auto try_emplace(ARGS&&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value) -> bool;
+
+    [[nodiscard]] auto try_pop() noexcept(true) -> std::optional<value_type>;
+
+
+public: /** BLOCKING **/
+    /** WAIT FOR A FREE SLOT ( dropped only when the ring could not be allocated ) **/
+    template <class U>
+    void push(U&&) noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    template <class... ARGS>
+    void emplace(ARGS&&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+    /** WAIT FOR AN ELEMENT ( std::nullopt only when the ring could not be allocated ) **/
+    [[nodiscard]] auto pop() noexcept(true) -> std::optional<value_type>;
+
+    /** WAIT AT MOST `timeout` FOR AN ELEMENT **/
+    template <class Rep, class Period>
+    [[nodiscard]] auto pop_for(std::chrono::duration<Rep, Period> const& /* timeout */) noexcept(true)
+        -> std::optional<value_type>;
+
+
+public: /** SNAPSHOTS ( exact only while the queue is quiet ) **/
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+    [[nodiscard]] auto capacity() const noexcept(true) -> size_type;
+
+
+public:
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+
+public:
+    ~mpmc_queue() noexcept(true);
+
+
+private:
+    [[nodiscard]] auto at(size_type p_ticket) const noexcept(true) -> slot_type&
+    {
+        return m_slots[p_ticket & (m_capacity - 1ul)];
+    }
+
+    /** CLAIM A PRODUCER TICKET WITHOUT WAITING, nullptr WHEN FULL **/
+    [[nodiscard]] auto claim_push(size_type& /* ticket */) noexcept(true) -> slot_type*;
+
+    /** CLAIM A CONSUMER TICKET WITHOUT WAITING, nullptr WHEN EMPTY **/
+    [[nodiscard]] auto claim_pop(size_type& /* ticket */) noexcept(true) -> slot_type*;
+
+    /** SLEEP UNTIL THE SLOT REACHES `turn` **/
+    static void wait_turn(slot_type& /* slot */, size_type /* turn */) noexcept(true);
+
+    /** HAND THE SLOT TO `turn`, WAKE WHOEVER WAITS ON IT **/
+    static void pass_turn(slot_type& /* slot */, size_type /* turn */) noexcept(true);
+
+    /** BUILD THE ELEMENT IN A CLAIMED SLOT AND PUBLISH IT **/
+    template <class... ARGS>
+    void fill(slot_type& /* slot */, size_type /* ticket */, ARGS&&...) noexcept(true);
+
+    /** MOVE THE ELEMENT OUT OF A CLAIMED SLOT AND FREE IT FOR THE NEXT LAP **/
+    [[nodiscard]] auto drain(slot_type& /* slot */, size_type /* ticket */) noexcept(true) -> value_type;
+
+    /** WAKE pop_for WAITERS AFTER A PUSH, IF THERE ARE ANY **/
+    void ring() noexcept(true);
+
+
+private:
+    alignas(cache_line_size) std::atomic<size_type> m_enqueue {};
+
+    alignas(cache_line_size) std::atomic<size_type> m_dequeue {};
+
+    alignas(cache_line_size) std::atomic<size_type> m_listeners {};
+    std::counting_semaphore<> m_doorbell {0};
+
+    /** read only after construction **/
+    alignas(cache_line_size) slot_type* m_slots {};
+    size_type m_capacity {};
+
+    [[no_unique_address]] slot_allocator_type m_alloc;
+};
+
+/** END MPMC QUEUE **/
+
+
+/** **/
+//  //
+/** **/
+
+
+template <mpmc_value T, class Allocator>
+template <class... ARGS>
+void mpmc_queue<T, Allocator>::fill(slot_type& p_slot, size_type p_ticket, ARGS&&... p_args) noexcept(true)
+{
+    Allocator v_alloc(m_alloc);
+
+    alloc_traits::construct(v_alloc, p_slot.data(), std::forward<ARGS>(p_args)...);
+
+    pass_turn(p_slot, p_ticket + 1ul);
+    ring();
+}
+
+
+template <mpmc_value T, class Allocator>
+template <class... ARGS>
+auto mpmc_queue<T, Allocator>::try_emplace(ARGS&&... p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value) -> bool
+{
+    if constexpr (not std::is_nothrow_constructible<T, ARGS...>::value)
+    {
+        // a claimed slot must be filled, so anything that may throw runs first
+        return try_emplace(T(std::forward<ARGS>(p_args)...));
+    }
+    else {
+        size_type v_ticket {};
+
+        slot_type* v_slot = claim_push(v_ticket);
+
+        if (v_slot == nullptr) return false;
+
+        fill(*v_slot, v_ticket, std::forward<ARGS>(p_args)...);
+
+        return true;
+    }
+}
+
+
+template <mpmc_value T, class Allocator>
+template <class U>
+auto mpmc_queue<T, Allocator>::try_push(U&& p_value)
+    noexcept(std::is_nothrow_constructible<T, U>::value) -> bool
+    requires(std::is_constructible<T, U>::value)
+{
+    return try_emplace(std::forward<U>(p_value));
+}
+
+
+template <mpmc_value T, class Allocator>
+template <class... ARGS>
+void mpmc_queue<T, Allocator>::emplace(ARGS&&... p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    if constexpr (not std::is_nothrow_constructible<T, ARGS...>::value)
+    {
+        // a ticket must be honoured, so anything that may throw runs first
+        emplace(T(std::forward<ARGS>(p_args)...));
+    }
+    else {
+        if (m_capacity == 0ul) return;
+
+        const size_type v_ticket = m_enqueue.fetch_add(1ul, std::memory_order_relaxed);
+
+        slot_type& v_slot = at(v_ticket);
+
+        wait_turn(v_slot, v_ticket);
+
+        fill(v_slot, v_ticket, std::forward<ARGS>(p_args)...);
+    }
+}
+
+
+template <mpmc_value T, class Allocator>
+template <class U>
+void mpmc_queue<T, Allocator>::push(U&& p_value)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    emplace(std::forward<U>(p_value));
+}
+
+
+template <mpmc_value T, class Allocator>
+template <class Rep, class Period>
+auto mpmc_queue<T, Allocator>::pop_for(std::chrono::duration<Rep, Period> const& p_timeout) noexcept(true)
+    -> std::optional<value_type>
+{
+    const auto v_deadline = std::chrono::steady_clock::now() + p_timeout;
+
+    while (true)
+    {
+        if (auto v_value = try_pop()) return v_value;
+
+        // listen first, look again: a push in between is either seen now or rings
+        m_listeners.fetch_add(1ul, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        auto v_value = try_pop();
+
+        const bool v_rang = v_value or m_doorbell.try_acquire_until(v_deadline);
+
+        m_listeners.fetch_sub(1ul, std::memory_order_relaxed);
+
+        if (v_value)     return v_value;
+        if (not v_rang)  return try_pop();
+    }
+}
+
+
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <mpmc_value T>
+    using mpmc_queue = ::mpmc_queue<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+extern template class mpmc_queue<int>;
+extern template class mpmc_queue<char>;
+extern template class mpmc_queue<long>;
+extern template class mpmc_queue<short>;
+extern template class mpmc_queue<unsigned int>;
+extern template class mpmc_queue<unsigned char>;
+extern template class mpmc_queue<unsigned long>;
+extern template class mpmc_queue<unsigned short>;
+extern template class mpmc_queue<float>;
+extern template class mpmc_queue<double>;
+extern template class mpmc_queue<std::string>;
+extern template class mpmc_queue<void*>;
+
+#endif
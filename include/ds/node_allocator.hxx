@@ -0,0 +1,107 @@
+#ifndef NODE_ALLOCATOR_HXX
+#define NODE_ALLOCATOR_HXX
+
+#include <cassert>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+#include <ds/container_stats.hxx>
+
+
+/**
+ * Keeps a container's forwarding range constructor from hijacking its
+ * copy constructor ( or one of a derived type ).
+ * **/
+template <class T, class U>
+concept non_self =
+        not std::is_same<std::decay_t<T>, U>::value &&
+        not std::is_base_of<U, std::decay_t<T>>::value;
+
+
+/**
+ * Node allocation shared by the node based containers.
+ *
+ * Nodes come from the container's allocator rebound to the node type
+ * ( std::allocator_traits<A>::rebind_alloc<node> ). A failed allocation
+ * yields nullptr, like new (std::nothrow), so the containers keep dropping
+ * the element on failure; an exception thrown by the element constructor
+ * still propagates, after the memory is handed back. Both ends report to
+ * the DATA_L_STATS counters of the allocator type.
+ * **/
+template <class Node, class Allocator, class... ARGS>
+[[nodiscard]] auto allocate_node(Allocator& p_alloc, ARGS&&... p_args)
+    noexcept(std::is_nothrow_constructible<Node, ARGS...>::value) -> Node*
+{
+    using traits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_same<typename traits::value_type, Node>::value,
+                  "allocator must be rebound to the node type");
+
+    typename traits::pointer v_block {};
+
+    try {
+        v_block = traits::allocate(p_alloc, 1ul);
+    }
+    catch (std::bad_alloc const&) {
+        stats_failed<Allocator>();
+
+        return nullptr;
+    }
+
+    Node* v_node = std::to_address(v_block);
+
+    if constexpr (std::is_nothrow_constructible<Node, ARGS...>::value)
+    {
+        traits::construct(p_alloc, v_node, std::forward<ARGS>(p_args)...);
+    }
+    else {
+        try {
+            traits::construct(p_alloc, v_node, std::forward<ARGS>(p_args)...);
+        }
+        catch (...) {
+            traits::deallocate(p_alloc, v_block, 1ul);
+            throw;
+        }
+    }
+
+    stats_allocated<Allocator>();
+
+    return v_node;
+}
+
+
+/** DESTROY A NODE AND RETURN ITS MEMORY TO THE ALLOCATOR THAT MADE IT **/
+template <class Allocator, class Node>
+void deallocate_node(Allocator& p_alloc, Node* p_node)
+    noexcept(std::is_nothrow_destructible<Node>::value)
+{
+    using traits = std::allocator_traits<Allocator>;
+
+    traits::destroy(p_alloc, p_node);
+    traits::deallocate(p_alloc, std::pointer_traits<typename traits::pointer>::pointer_to(*p_node), 1ul);
+
+    stats_freed<Allocator>();
+}
+
+
+/**
+ * Allocators are exchanged only when they propagate on swap; otherwise
+ * they must already compare equal ( std::pmr allocators never propagate ).
+ * **/
+template <class Allocator>
+void swap_allocators(Allocator& p_lhs, Allocator& p_rhs) noexcept(true)
+{
+    if constexpr (std::allocator_traits<Allocator>::propagate_on_container_swap::value)
+    {
+        using std::swap;
+
+        swap(p_lhs, p_rhs);
+    }
+    else {
+        assert(p_lhs == p_rhs);
+    }
+}
+
+#endif
@@ -0,0 +1,253 @@
+#ifndef NODE_POOL_HXX
+#define NODE_POOL_HXX
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+
+/** START STATS **/
+
+struct node_pool_stats
+{
+    std::size_t m_slabs {};                 /** slabs currently held **/
+    std::size_t m_capacity {};              /** blocks carved out of those slabs **/
+    std::size_t m_in_use {};                /** blocks handed out and not yet returned **/
+    std::size_t m_system_allocations {};    /** slabs ever requested from operator new **/
+    std::size_t m_system_deallocations {};  /** slabs ever handed back to operator delete **/
+};
+
+/** END STATS **/
+
+
+
+/** START POOL **/
+
+/**
+ * Slab allocator for fixed size nodes.
+ *
+ * Blocks are carved out of slabs of `slab_blocks` nodes and recycled
+ * through an intrusive free list, so once the pool is warm a push / pop
+ * cycle never reaches the system allocator. One pool serves every node
+ * type its allocators are rebound to ( one size class per type ).
+ * Not thread safe, like the containers using it.
+ * **/
+class node_pool final
+{
+
+public: /** TYPE ALIAS **/
+    using size_type = std::size_t;
+
+    static constexpr size_type default_slab_blocks = 256ul;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    explicit node_pool(size_type /* slab_blocks */ = default_slab_blocks) noexcept(true);
+
+    node_pool(node_pool const&) = delete;
+
+    auto operator=(node_pool const&) -> node_pool& = delete;
+
+
+public:
+    /** ONE BLOCK OF `size` BYTES, throws std::bad_alloc **/
+    [[nodiscard]] auto allocate(size_type /* size */, size_type /* align */) -> void*;
+
+    void deallocate(void* /* block */, size_type /* size */, size_type /* align */) noexcept(true);
+
+
+public:
+    /** MAKE SURE AT LEAST `count` BLOCKS OF THAT SIZE ARE FREE **/
+    void reserve(size_type /* size */, size_type /* align */, size_type /* count */);
+
+    /** HAND EVERY SLAB WITHOUT A LIVE BLOCK BACK TO THE SYSTEM **/
+    void shrink_to_fit() noexcept(true);
+
+    [[nodiscard]] auto stats() const noexcept(true) -> node_pool_stats;
+
+
+public:
+    ~node_pool() noexcept(true);
+
+
+private:
+    struct free_block
+    {
+        free_block* m_next {};
+    };
+
+    struct slab
+    {
+        std::byte* m_begin {};
+        size_type  m_blocks {};
+    };
+
+    struct size_class
+    {
+        size_type m_size {};
+        size_type m_align {};
+
+        free_block*       m_free {};
+        std::vector<slab> m_slabs;      /** sorted by address **/
+
+        size_type m_capacity {};
+        size_type m_in_use {};
+    };
+
+
+private:
+    [[nodiscard]] static auto block_size(size_type /* size */, size_type /* align */) noexcept(true) -> size_type;
+
+    [[nodiscard]] auto find(size_type /* size */, size_type /* align */) -> size_class&;
+
+    void grow(size_class& /* class */, size_type /* blocks */);
+
+    void release(size_class& /* class */, slab const& /* slab */) noexcept(true);
+
+
+private:
+    std::vector<size_class> m_classes;
+
+    size_type m_slab_blocks {};
+    size_type m_system_allocations {};
+    size_type m_system_deallocations {};
+};
+
+/** END POOL **/
+
+
+
+/** START POOL ALLOCATOR **/
+
+/**
+ * Allocator handing out single nodes from a shared node_pool.
+ *
+ * Rebound copies share the pool, so a container's node allocator and its
+ * get_allocator() compare equal. A copied container gets a pool of its
+ * own; swap and assignment carry the pool along with the nodes.
+ * **/
+template <class T> class pool_allocator
+{
+
+public:
+    template <class> friend class pool_allocator;
+
+public: /** TYPE ALIAS **/
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::false_type;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR ( fresh pool, may throw std::bad_alloc: the containers' default and copy ctors are noexcept only without it ) **/
+    pool_allocator() : m_pool(std::make_shared<node_pool>()) {}
+
+    /** POOL CTOR ( share an existing pool ) **/
+    explicit pool_allocator(std::shared_ptr<node_pool> p_pool) noexcept(true)
+        : m_pool(std::move(p_pool))
+    {}
+
+    /** REBIND CTOR **/
+    template <class U>
+    pool_allocator(pool_allocator<U> const& p_other) noexcept(true)
+        : m_pool(p_other.m_pool)
+    {}
+
+
+public:
+    [[nodiscard]] auto allocate(size_type p_count) -> T*
+    {
+        if (p_count == 1ul)
+        {
+            return static_cast<T*>(m_pool->allocate(sizeof(T), alignof(T)));
+        }
+
+        return static_cast<T*>(::operator new(p_count * sizeof(T), std::align_val_t{alignof(T)}));
+    }
+
+    void deallocate(T* p_block, size_type p_count) noexcept(true)
+    {
+        if (p_count == 1ul)
+        {
+            m_pool->deallocate(p_block, sizeof(T), alignof(T));
+            return;
+        }
+
+        ::operator delete(p_block, std::align_val_t{alignof(T)});
+    }
+
+    [[nodiscard]] auto select_on_container_copy_construction() const -> pool_allocator
+    {
+        return pool_allocator();
+    }
+
+
+public:
+    void reserve(size_type p_count) { m_pool->reserve(sizeof(T), alignof(T), p_count); }
+
+    void shrink_to_fit() noexcept(true) { m_pool->shrink_to_fit(); }
+
+    [[nodiscard]] auto stats() const noexcept(true) -> node_pool_stats { return m_pool->stats(); }
+
+    [[nodiscard]] auto pool() const noexcept(true) -> std::shared_ptr<node_pool> const& { return m_pool; }
+
+
+public:
+    friend auto operator==(pool_allocator const& p_lhs, pool_allocator const& p_rhs) noexcept(true) -> bool
+    {
+        return (p_lhs.m_pool == p_rhs.m_pool);
+    }
+
+
+private:
+    std::shared_ptr<node_pool> m_pool;
+};
+
+/** END POOL ALLOCATOR **/
+
+
+/** ALLOCATORS THAT CAN PRE-ALLOCATE AND RELEASE NODES ( see container reserve / shrink_to_fit ) **/
+template <class A>
+concept node_pooling = requires(A& p_alloc, std::size_t p_count) {
+    p_alloc.reserve(p_count);
+    p_alloc.shrink_to_fit();
+};
+
+
+/**
+ * Ahead of a bulk insert: with a pooling allocator and a count ( or a
+ * range that knows its size ), set aside all the nodes at once so the
+ * chain comes out of as few slabs as possible. Best effort, the insert allocates what is missing.
+ * **/
+template <class Allocator>
+void reserve_nodes(Allocator& p_alloc, [[maybe_unused]] std::size_t p_count) noexcept(true)
+{
+    if constexpr (node_pooling<Allocator>)
+    {
+        try {
+            p_alloc.reserve(p_count);
+        }
+        catch (...) {}
+    }
+}
+
+template <class Allocator, class R>
+void reserve_nodes(Allocator& p_alloc, R& p_range) noexcept(true)
+{
+    if constexpr (node_pooling<Allocator> and std::ranges::sized_range<R>)
+    {
+        reserve_nodes(p_alloc, static_cast<std::size_t>(std::ranges::size(p_range)));
+    }
+}
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef OUTPUT_SINK_HXX
+#define OUTPUT_SINK_HXX
+
+#include <type_traits>
+#include <utility>
+
+
+/**
+ * An output iterator that takes a moved T without throwing: the write
+ * through it ( T's move assignment included ), the step past it and its
+ * own move. The bulk pops of the containers are noexcept only when this
+ * holds; otherwise they keep the container consistent when the sink throws.
+ * **/
+template <class O, class T>
+concept nothrow_sink =
+        std::is_nothrow_move_constructible<O>::value &&
+        noexcept(*std::declval<O&>() = std::declval<T&&>()) &&
+        noexcept(++std::declval<O&>());
+
+#endif
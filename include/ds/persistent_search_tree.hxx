@@ -0,0 +1,574 @@
+#ifndef PERSISTENT_SEARCH_TREE_HXX
+#define PERSISTENT_SEARCH_TREE_HXX
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <ds/epoch_domain.hxx>
+
+
+/** START CONSTRAINTS **/
+
+/** updates copy the keys along the search path, so keys must be copyable **/
+template <class T>
+concept persistent_key = std::totally_ordered<T> && std::copy_constructible<T>;
+
+/** END CONSTRAINTS **/
+
+
+/** FROWARD DECL **/
+template <persistent_key> class persistent_search_tree;
+template <persistent_key> class persistent_snapshot;
+template <class> class persistent_node;
+
+
+/** START LINK **/
+
+/**
+ * Owning pointer to a node, counted in the node itself. Versions share
+ * subtrees, so a node lives while any parent, tree or retired version
+ * links to it. Only writers copy or drop links; readers follow the raw
+ * pointers under a pin and never touch a count.
+ * **/
+template <class T> class persistent_link final
+{
+
+public: /** TYPE ALIAS **/
+    using node_type = persistent_node<T>;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    persistent_link() noexcept(true) = default;
+
+    persistent_link(std::nullptr_t) noexcept(true) {}
+
+    /** TAKE OVER A REFERENCE THE CALLER OWNS **/
+    [[nodiscard]] static auto adopt(node_type const* /* node */) noexcept(true) -> persistent_link;
+
+    /** ADD A REFERENCE TO A NODE KEPT ALIVE MEANWHILE ( by a pin or another link ) **/
+    [[nodiscard]] static auto share(node_type const* /* node */) noexcept(true) -> persistent_link;
+
+    /** COPY CTOR **/
+    persistent_link(persistent_link const& p_outer) noexcept(true)
+        : persistent_link(share(p_outer.m_node))
+    {
+    }
+
+    /** MOVE CTOR **/
+    persistent_link(persistent_link&& p_outer) noexcept(true)
+        : m_node(std::exchange(p_outer.m_node, nullptr))
+    {
+    }
+
+    /** ASSIGNMENT **/
+    auto operator=(persistent_link p_rhs) noexcept(true) -> persistent_link&
+    {
+        std::swap(m_node, p_rhs.m_node);
+
+        return *this;
+    }
+
+    ~persistent_link() noexcept(true);
+
+
+public:
+    [[nodiscard]] auto get() const noexcept(true) -> node_type const* { return m_node; }
+
+    [[nodiscard]] auto operator->() const noexcept(true) -> node_type const* { return m_node; }
+
+    [[nodiscard]] explicit operator bool() const noexcept(true) { return (m_node != nullptr); }
+
+    [[nodiscard]] auto operator==(persistent_link const&) const noexcept(true) -> bool = default;
+
+    /** GIVE THE REFERENCE UP WITHOUT DROPPING IT **/
+    [[nodiscard]] auto release() noexcept(true) -> node_type const*
+    {
+        return std::exchange(m_node, nullptr);
+    }
+
+
+private:
+    node_type const* m_node {};
+};
+
+/** END LINK **/
+
+
+/** START NODE **/
+
+/**
+ * Immutable AVL node. Once published a node is never written again:
+ * an update builds new nodes for the path it changes and shares every
+ * other subtree with the previous version.
+ * **/
+template <class T> class persistent_node final
+{
+
+public:
+    template <persistent_key> friend class persistent_search_tree;
+    template <persistent_key> friend class persistent_snapshot;
+    friend class persistent_link<T>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using link_type       = persistent_link<T>;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** PARAM CTOR **/
+    template <class... ARGS>
+    persistent_node(link_type p_left, link_type p_right, std::in_place_t, ARGS&&... p_args)
+            noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+            requires(std::is_constructible<T, ARGS...>::value)
+        : m_data(std::forward<ARGS>(p_args)...)
+        , m_left(std::move(p_left))
+        , m_right(std::move(p_right))
+    {
+        std::uint8_t v_left  = m_left  ? m_left->m_height  : 0u;
+        std::uint8_t v_right = m_right ? m_right->m_height : 0u;
+
+        m_height = static_cast<std::uint8_t>(std::max(v_left, v_right) + 1u);
+        m_count  = (m_left ? m_left->m_count : 0ul) + (m_right ? m_right->m_count : 0ul) + 1ul;
+    }
+
+
+private:
+    value_type   m_data;
+    link_type    m_left   {};
+    link_type    m_right  {};
+    std::size_t  m_count  {1ul};   // nodes in the subtree rooted here
+    std::uint8_t m_height {1u};
+
+    /** links to this node; the only field written after publication, by writers only **/
+    mutable std::atomic<std::size_t> m_refs {1ul};
+};
+
+/** END NODE **/
+
+
+template <class T>
+auto persistent_link<T>::adopt(node_type const* p_node) noexcept(true) -> persistent_link
+{
+    persistent_link v_link;
+
+    v_link.m_node = p_node;
+
+    return v_link;
+}
+
+template <class T>
+auto persistent_link<T>::share(node_type const* p_node) noexcept(true) -> persistent_link
+{
+    if (p_node != nullptr) p_node->m_refs.fetch_add(1ul, std::memory_order_relaxed);
+
+    return adopt(p_node);
+}
+
+template <class T>
+persistent_link<T>::~persistent_link() noexcept(true)
+{
+    // the children go with their links, so a chain of last references is freed top down
+    if ((m_node != nullptr) && (m_node->m_refs.fetch_sub(1ul, std::memory_order_acq_rel) == 1ul))
+    {
+        delete m_node;
+    }
+}
+
+
+/** START SNAPSHOT **/
+
+/**
+ * One version of the tree. While it lives its thread stays pinned in the
+ * epoch_domain, so nothing it can reach is freed, and nothing it can
+ * reach ever changes: it is read without any synchronization.
+ * A snapshot stays on the thread that took it ( copies pin the thread
+ * that makes them ), and one kept for long holds back the freeing of
+ * every version retired meanwhile.
+ * **/
+template <persistent_key T> class persistent_snapshot final
+{
+
+public:
+    friend class persistent_search_tree<T>;
+
+public: /** TYPE ALIAS **/
+    using node_type = persistent_node<T>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = typename node_type::value_type;
+    using reference       = typename node_type::reference;
+    using const_reference = typename node_type::const_reference;
+    using pointer         = typename node_type::pointer;
+    using const_pointer   = typename node_type::const_pointer;
+    using size_type       = std::size_t;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR ( the empty version, holds no pin ) **/
+    persistent_snapshot() noexcept(true);
+
+    /** COPY CTOR ( pins the calling thread ) **/
+    persistent_snapshot(persistent_snapshot const& /* outer */) noexcept(true);
+
+    /** MOVE CTOR **/
+    persistent_snapshot(persistent_snapshot&& /* outer */) noexcept(true);
+
+    /** ASSIGNMENT **/
+    auto operator=(persistent_snapshot /* rhs */) noexcept(true) -> persistent_snapshot&;
+
+    ~persistent_snapshot() noexcept(true);
+
+
+public:
+    /** SEARCH FOR A NODE IN TREE **/
+    auto search(T const& /* key */) const
+        noexcept(true) -> std::optional<value_type>;
+
+    /**
+     * FIND A NODE EQUAL TO KEY
+     * (Valid as long as this snapshot, or a copy of it, is alive)
+     * **/
+    template <class K>
+    [[nodiscard]] auto find(K const& /* key */) const noexcept(true) -> const_pointer
+        requires(std::totally_ordered_with<T, K>);
+
+    template <class K>
+    [[nodiscard]] auto contains(K const& /* key */) const noexcept(true) -> bool
+        requires(std::totally_ordered_with<T, K>);
+
+
+public:
+
+    /** PRINT TREE NODES IN INORDER **/
+    void print_inorder() const noexcept(true);
+
+
+public:
+
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+    [[nodiscard]] auto max() const noexcept(true) -> std::optional<value_type>;
+
+    [[nodiscard]] auto min() const noexcept(true) -> std::optional<value_type>;
+
+
+private:
+
+    /** TAKES OVER A PIN THE CALLER HOLDS **/
+    explicit persistent_snapshot(node_type const* /* root */) noexcept(true);
+
+    static void print(node_type const* /* node */) noexcept(true);
+
+
+private:
+    /** non-null only while this snapshot holds a pin **/
+    node_type const* m_root {};
+};
+
+/** END SNAPSHOT **/
+
+
+/** START TREE **/
+
+/**
+ * Ordered tree whose readers never wait.
+ *
+ * Updates copy the O(log n) nodes on their path and publish the new root
+ * with one compare-and-swap of a plain pointer. snapshot() pins the
+ * calling thread in the epoch_domain and loads that pointer: readers
+ * write only to a cache line of their own, so lookups scale with the
+ * number of reader threads. A replaced version is retired to the domain
+ * and freed once no pinned reader can still reach it; nodes shared
+ * between versions are reference counted, by the writers alone.
+ * Concurrent writers are safe too ( a lost race rebuilds the path and
+ * retries ) but are meant to be rare.
+ * **/
+template <persistent_key T> class persistent_search_tree final
+{
+
+public: /** TYPE ALIAS **/
+    using node_type     = persistent_node<T>;
+    using link_type     = typename node_type::link_type;
+    using snapshot_type = persistent_snapshot<T>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = typename node_type::value_type;
+    using reference       = typename node_type::reference;
+    using const_reference = typename node_type::const_reference;
+    using pointer         = typename node_type::pointer;
+    using const_pointer   = typename node_type::const_pointer;
+    using size_type       = std::size_t;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    persistent_search_tree() noexcept(true);
+
+    /**
+     * INITIALIZER_LIST CTOR
+     * (Construct with the contents of the initializer list)
+     * **/
+    persistent_search_tree(std::initializer_list<T> /* list */) noexcept(
+        std::is_nothrow_copy_constructible<T>::value);
+
+    /**
+     * COPY CTOR
+     * (O(1): both trees share the current version until one of them changes)
+     * **/
+    persistent_search_tree(persistent_search_tree const& /* outer */) noexcept(true);
+
+    /** ASSIGNMENT **/
+    persistent_search_tree& operator=(persistent_search_tree const& /* rhs */) noexcept(true);
+
+    /** RETIRES THE CURRENT VERSION, SNAPSHOTS OF IT STAY READABLE **/
+    ~persistent_search_tree() noexcept(true);
+
+
+public: /** MEMBER FUNCTION **/
+
+    /** INSERTING A NODE IN TREE **/
+    template <class U>
+    void insert(U&& /* data */)
+        noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    /** INSERTING A NODE IN TREE ( construct in place ) **/
+    template <class... Args>
+    void emplace(Args&&... /* args */) noexcept(
+        std::is_nothrow_constructible<T, Args...>::value);
+
+
+public:
+
+    /** CURRENT VERSION, WAIT-FREE ( a pin in the calling thread's own slot and one load ) **/
+    [[nodiscard]] auto snapshot() const noexcept(true) -> snapshot_type;
+
+    /** SEARCH FOR A NODE IN TREE ( in the current version ) **/
+    auto search(T const& /* key */) const
+        noexcept(true) -> std::optional<value_type>;
+
+    template <class K>
+    [[nodiscard]] auto contains(K const& /* key */) const noexcept(true) -> bool
+        requires(std::totally_ordered_with<T, K>);
+
+
+public:
+
+    /** DELETE A NODE FROM TREE **/
+    void remove(T const& /* key */) noexcept(true);
+
+    /** MAKE TREE EMPTY ( live snapshots keep their version ) **/
+    void clear() noexcept(true);
+
+
+public:
+
+    /** PRINT TREE NODES IN INORDER **/
+    void print_inorder() const noexcept(true);
+
+
+public:
+
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+    [[nodiscard]] auto max() const noexcept(true) -> std::optional<value_type>;
+
+    [[nodiscard]] auto min() const noexcept(true) -> std::optional<value_type>;
+
+
+private: /** PATH COPYING HELPERS ( every result is a new or shared node, nothing is modified ) **/
+
+    /** NEW NODE WITH THE KEY OF FROM AND THE GIVEN CHILDREN **/
+    [[nodiscard]] static auto make(node_type const* /* from */, link_type /* left */, link_type /* right */)
+        -> link_type;
+
+    [[nodiscard]] static auto height(link_type const& p_node) noexcept(true) -> int
+    {
+        return p_node ? p_node->m_height : 0;
+    }
+
+    /** REBUILD A NODE OVER NEW CHILDREN, ROTATING IF THEIR HEIGHTS DIFFER BY TWO **/
+    [[nodiscard]] static auto balance(node_type const* /* from */, link_type /* left */, link_type /* right */)
+        -> link_type;
+
+    /** NEW VERSION OF A SUBTREE WITH LEAF LINKED IN **/
+    [[nodiscard]] static auto attach(link_type const& /* root */, link_type const& /* leaf */) -> link_type;
+
+    /** NEW VERSION OF A SUBTREE WITHOUT ONE NODE EQUAL TO KEY, THE SAME ONE WHEN ABSENT **/
+    [[nodiscard]] static auto detach(link_type const& /* root */, T const& /* key */) -> link_type;
+
+    /** ( subtree without its smallest node, that node ) **/
+    [[nodiscard]] static auto take_min(link_type const& /* root */) -> std::pair<link_type, link_type>;
+
+    /** A COUNTED LINK TO THE CURRENT ROOT **/
+    [[nodiscard]] auto current() const noexcept(true) -> link_type;
+
+    /** PUBLISH THE ROOT REBUILT FROM THE CURRENT ONE, RETRYING IF ANOTHER WRITER WON **/
+    template <class F>
+    void update(F&& /* rebuild */) noexcept(true);
+
+    /** HAND THE TREE'S REFERENCE TO A REPLACED ROOT OVER TO THE EPOCH DOMAIN **/
+    static void retire(node_type const* /* root */) noexcept(true);
+
+    /** THE DOMAIN'S DELETER: DROP THAT REFERENCE ONCE NO READER CAN HOLD THE ROOT **/
+    static void release(void* /* root */) noexcept(true);
+
+
+private:
+    /** owns one reference to the current version **/
+    std::atomic<node_type const*> m_root {};
+};
+
+/** END TREE **/
+
+// //
+
+template <persistent_key T>
+template <class K>
+auto persistent_snapshot<T>::find(K const& p_key) const noexcept(true) -> const_pointer
+    requires(std::totally_ordered_with<T, K>)
+{
+    node_type const* v_current = m_root;
+
+    while (v_current != nullptr)
+    {
+        if (p_key < v_current->m_data)
+        {
+            v_current = v_current->m_left.get();
+        }
+        else if (v_current->m_data < p_key) {
+            v_current = v_current->m_right.get();
+        }
+        else return std::addressof(v_current->m_data);
+    }
+
+    return nullptr;
+}
+
+template <persistent_key T>
+template <class K>
+auto persistent_snapshot<T>::contains(K const& p_key) const noexcept(true) -> bool
+    requires(std::totally_ordered_with<T, K>)
+{
+    return (find(p_key) != nullptr);
+}
+
+
+template <persistent_key T>
+template <class U>
+void persistent_search_tree<T>::insert(U&& p_data)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    emplace(std::forward<U>(p_data));
+}
+
+template <persistent_key T>
+template <class... Args>
+void persistent_search_tree<T>::emplace(Args&&... p_args)
+    noexcept(std::is_nothrow_constructible<T, Args...>::value)
+{
+    link_type v_leaf;
+
+    try {
+        v_leaf = link_type::adopt(new node_type const(
+            nullptr, nullptr, std::in_place, std::forward<Args>(p_args)...));
+    }
+    catch (std::bad_alloc const&) {
+        return;
+    }
+
+    // the leaf is built once; a retry only rebuilds the path above it
+    update([&v_leaf](link_type const& p_root) { return attach(p_root, v_leaf); });
+}
+
+template <persistent_key T>
+template <class K>
+auto persistent_search_tree<T>::contains(K const& p_key) const noexcept(true) -> bool
+    requires(std::totally_ordered_with<T, K>)
+{
+    return snapshot().contains(p_key);
+}
+
+template <persistent_key T>
+template <class F>
+void persistent_search_tree<T>::update(F&& p_rebuild) noexcept(true)
+{
+    // a counted link: the expected root can not be freed, so its address
+    // can not come back under another version while we rebuild
+    link_type v_expected = current();
+
+    while (true)
+    {
+        link_type v_desired;
+
+        try {
+            v_desired = p_rebuild(v_expected);
+        }
+        catch (std::bad_alloc const&) {
+            // the current version is untouched: drop the update
+            return;
+        }
+
+        if (v_desired == v_expected) return;
+
+        node_type const* v_seen = v_expected.get();
+
+        if (m_root.compare_exchange_strong(v_seen, v_desired.get(), std::memory_order_seq_cst))
+        {
+            static_cast<void>(v_desired.release());
+
+            return retire(v_seen);
+        }
+
+        v_expected = current();
+    }
+}
+
+
+extern template class persistent_snapshot<int>;
+extern template class persistent_snapshot<char>;
+extern template class persistent_snapshot<long>;
+extern template class persistent_snapshot<short>;
+extern template class persistent_snapshot<unsigned int>;
+extern template class persistent_snapshot<unsigned char>;
+extern template class persistent_snapshot<unsigned long>;
+extern template class persistent_snapshot<unsigned short>;
+extern template class persistent_snapshot<float>;
+extern template class persistent_snapshot<double>;
+extern template class persistent_snapshot<std::string>;
+
+extern template class persistent_search_tree<int>;
+extern template class persistent_search_tree<char>;
+extern template class persistent_search_tree<long>;
+extern template class persistent_search_tree<short>;
+extern template class persistent_search_tree<unsigned int>;
+extern template class persistent_search_tree<unsigned char>;
+extern template class persistent_search_tree<unsigned long>;
+extern template class persistent_search_tree<unsigned short>;
+extern template class persistent_search_tree<float>;
+extern template class persistent_search_tree<double>;
+extern template class persistent_search_tree<std::string>;
+
+#endif
@@ -7,21 +7,27 @@
 #include <exception>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <ranges>
 #include <string>
 
+#include <ds/node_allocator.hxx>
+#include <ds/node_pool.hxx>
+#include <ds/output_sink.hxx>
 
-template <class> class queue;
+
+template <class T, class = std::allocator<T>> class queue;
 
 //
 // START NODE
 //
-template <class T> class node final
+template <class T> class queue_node final
 {
 
 public:
-    friend class queue<T>;
+    template <class, class> friend class queue;
 
 public: /** TYPE ALIAS **/
     using value_type      = T;
@@ -34,15 +40,15 @@ public: /** TYPE ALIAS **/
 
 public: /** CONSTRUCTORS **/
     /** DEFAULT CTOR **/
-    node() noexcept(std::is_nothrow_default_constructible<T>::value)
-            requires(std::default_constructible<T>::value)
+    queue_node() noexcept(std::is_nothrow_default_constructible<T>::value)
+            requires(std::is_default_constructible<T>::value)
         : m_data{T{}}
         , m_prev{this}
         , m_next{this}
     {}
 
     /** PARAM CTOR (copy) **/
-    explicit node(T const& p_data) noexcept(std::is_nothrow_copy_constructible<T>::value)
+    explicit queue_node(T const& p_data) noexcept(std::is_nothrow_copy_constructible<T>::value)
     requires(std::is_copy_constructible<T>::value)
         : m_data{p_data}
         , m_prev{this}
@@ -50,7 +56,7 @@ public: /** CONSTRUCTORS **/
     {}
 
     /** PARAM CTOR (move) **/
-    explicit node(T&& p_data) noexcept(std::is_nothrow_move_constructible<T>::value)
+    explicit queue_node(T&& p_data) noexcept(std::is_nothrow_move_constructible<T>::value)
             requires(std::is_move_constructible<T>::value)
         : m_data{std::move(p_data)}
         , m_prev{this}
@@ -59,8 +65,8 @@ public: /** CONSTRUCTORS **/
 
     /** **/
     template <class... ARGS>
-    node(std::in_place_t, &&... p_args)
-            noexcept(std::is_notrow_constructible<T, ARGS...>::value)
+    queue_node(std::in_place_t, ARGS&&... p_args)
+            noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
             requires(std::is_constructible<T, ARGS...>::value)
         : m_data{T{std::forward<ARGS>(p_args)...}}
         , m_prev{this}
@@ -78,7 +84,7 @@ public: /** GETTERS **/
 private: /** HELPERS **/
 
 
-    void push_front(node* p_node) noexcept(true)
+    void push_front(queue_node* p_node) noexcept(true)
     {
         p_node->m_next = m_next;
         p_node->m_prev = this;
@@ -86,7 +92,7 @@ private: /** HELPERS **/
         m_next = p_node;
     }
 
-    void push_back(node* p_node) noexcept(true)
+    void push_back(queue_node* p_node) noexcept(true)
     {
         p_node->m_prev = m_prev;
         p_node->m_next = this;
@@ -97,20 +103,24 @@ private: /** HELPERS **/
 
 
 private:
-    value_type m_data;
-    node*      m_prev;
-    node*      m_next;
+    value_type  m_data;
+    queue_node* m_prev;
+    queue_node* m_next;
 };
 
 //* END NODE *//
 
 
 // /** **/ //
-template <class T> class queue final
+template <class T, class Allocator> class queue final
 {
 
 public: /** TYPE ALIAS **/
-    using node_type = node<T>;
+    using node_type = queue_node<T>;
+
+private: /** TYPE ALIAS **/
+    using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+    using alloc_traits        = std::allocator_traits<Allocator>;
 
 public: /** TYPE ALIAS **/
     using value_type      = typename node_type::value_type;
@@ -119,15 +129,24 @@ public: /** TYPE ALIAS **/
     using pointer         = typename node_type::pointer;
     using const_pointer   = typename node_type::const_pointer;
     using size_type       = std::size_t;
+    using allocator_type  = Allocator;
 
 
 
 public: /** CONSTRUCTORS **/
     /** DEFAULT CTOR **/
-    queue() noexcept(std::is_nothrow_default_constructible<T>::value);
+    queue() noexcept(std::is_nothrow_default_constructible<T>::value &&
+                     std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** ALLOCATOR CTOR **/
+    explicit queue(Allocator const&) noexcept(std::is_nothrow_default_constructible<T>::value);
 
     /** COPY CTOR **/
-    queue(queue const&) noexcept(std::is_nothrow_copy_constructible<T>::value);
+    queue(queue const&) noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                                 std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** COPY CTOR ( allocator-extended ) **/
+    queue(queue const&, Allocator const&) noexcept(std::is_nothrow_copy_constructible<T>::value);
 
     /** MOVE CTOR **/
     queue(queue&&) noexcept(true);
@@ -137,7 +156,7 @@ public: /** CONSTRUCTORS **/
     * (Construct with the contents of the range [ begin, end ])
     * **/
     template <std::input_iterator I, std::sentinel_for<I> S>
-    queue(I, S) noexcept(std::is_nothrow_constructible<T, std::iter_value_t<T>>::value)
+    queue(I, S, Allocator const& = Allocator()) noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
         requires(std::is_constructible<T, std::iter_value_t<I>>::value);
 
     /**
@@ -145,14 +164,14 @@ public: /** CONSTRUCTORS **/
     * (Construct with the contents of the range)
     * **/
     template <std::ranges::range R>
-    queue(R&&) noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<T>>::value)
+    queue(R&&, Allocator const& = Allocator()) noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
         requires(std::is_constructible<T, std::ranges::range_value_t<R>>::value);
 
     /**
     * ASSIGNMENT OP
     * ( copy-swap idiom )
     * **/
-    auto operator=(queue) noexcept -> queue &;
+    auto operator=(queue) noexcept(std::is_nothrow_copy_constructible<T>::value) -> queue &;
 
 
 public: /** **/
@@ -170,11 +189,32 @@ public: /** **/
     template <class... ARGS>
     void emplace(ARGS&&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
 
+    /**
+    * APPEND EVERY ELEMENT OF THE RANGE, IN ORDER
+    * ( the nodes are chained off to the side and linked in at the back in one go )
+    * **/
+    template <std::ranges::range R>
+    void push_range(R&&) noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_reference_t<R>>::value);
+
 
 public:
     void pop_front() noexcept(std::is_nothrow_destructible<T>::value);
     void pop() noexcept(std::is_nothrow_destructible<T>::value);
 
+    /** MOVE THE FRONT ELEMENT OUT AND POP IT, std::nullopt WHEN EMPTY **/
+    [[nodiscard]] auto try_pop() noexcept(std::is_nothrow_move_constructible<T>::value) -> std::optional<value_type>;
+
+    /** MOVE UP TO `count` ELEMENTS INTO `out`, FRONT FIRST; RETURNS HOW MANY **/
+    template <std::weakly_incrementable O>
+    auto pop_n(size_type, O) noexcept(nothrow_sink<O, T>) -> size_type
+        requires(std::indirectly_writable<O, T&&>);
+
+    /** MOVE EVERY ELEMENT INTO `out`, FRONT FIRST; RETURNS HOW MANY **/
+    template <std::weakly_incrementable O>
+    auto drain(O) noexcept(nothrow_sink<O, T>) -> size_type
+        requires(std::indirectly_writable<O, T&&>);
+
 
 public:
     [[nodiscard]] auto peek() const noexcept(true) -> std::optional<value_type>;
@@ -186,6 +226,13 @@ public:
     [[nodiscard]] auto back() const noexcept(true) -> std::optional<value_type>;
     [[nodiscard]] auto back()       noexcept(true) -> std::optional<value_type>;
 
+    /** THE ELEMENT IN PLACE, nullptr WHEN EMPTY ( valid until it is popped ) **/
+    [[nodiscard]] auto front_ptr() const noexcept(true) -> const_pointer;
+    [[nodiscard]] auto front_ptr()       noexcept(true) -> pointer;
+
+    [[nodiscard]] auto back_ptr() const noexcept(true) -> const_pointer;
+    [[nodiscard]] auto back_ptr()       noexcept(true) -> pointer;
+
 
 public:
     [[nodiscard]] auto empty() const noexcept(true) -> bool;
@@ -193,6 +240,17 @@ public:
     [[nodiscard]] auto size() const noexcept(true) -> size_type;
 
 
+public:
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+
+public: /** NODE POOL ( only with a pooling allocator, see node_pool.hxx ) **/
+    /** keep enough free nodes around for `count` elements in total **/
+    void reserve(size_type /* count */) requires(node_pooling<node_allocator_type>);
+
+    void shrink_to_fit() noexcept(true) requires(node_pooling<node_allocator_type>);
+
+
 public:
     ~queue() noexcept(std::is_nothrow_destructible<T>::value);
 
@@ -200,8 +258,9 @@ public:
 public:
     friend void swap(queue& p_lhs, queue& p_rhs) noexcept(true)
     {
-        std::swap(p_lhs.m_head, p_rhs.m_head);
-        std::swap(p_lhs.m_size, p_rhs.m_size);
+        std::swap(p_lhs.m_head,  p_rhs.m_head);
+        std::swap(p_lhs.m_size,  p_rhs.m_size);
+        swap_allocators(p_lhs.m_alloc, p_rhs.m_alloc);
     }
 
     void debug() noexcept(true)
@@ -219,6 +278,8 @@ public:
 
 
 private:
+    [[no_unique_address]] node_allocator_type m_alloc;
+
     node_type* m_head;
     size_type  m_size;
 };
@@ -228,12 +289,12 @@ private:
 //  //
 /** **/
 
-template <class T>
+template <class T, class Allocator>
 template <std::input_iterator I, std::sentinel_for<I> S>
-queue<T>::queue(I p_begin, S p_end)
-        noexcept(std::is_nothrow_constructible<T, std::iter_value_t<T>>::value)
+queue<T, Allocator>::queue(I p_begin, S p_end, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
         requires(std::is_constructible<T, std::iter_value_t<I>>::value)
-    : queue()
+    : queue(p_alloc)
 {
     using std::placeholders::_1;
 
@@ -243,23 +304,23 @@ queue<T>::queue(I p_begin, S p_end)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <std::ranges::range R>
-queue<T>::queue(R&& p_container)
-        noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<T>>::value)
+queue<T, Allocator>::queue(R&& p_container, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
         requires(std::is_constructible<T, std::ranges::range_value_t<R>>::value)
-    : queue(std::ranges::begin(p_container), std::ranges::end(p_container))
+    : queue(std::ranges::begin(p_container), std::ranges::end(p_container), p_alloc)
 {}
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void queue<T>::push_back(U&& p_value) noexcept(std::is_nothrow_constructible<T, U>::value)
+void queue<T, Allocator>::push_back(U&& p_value) noexcept(std::is_nothrow_constructible<T, U>::value)
     requires(std::is_constructible<T, U>::value)
 {
     if (not m_head) return;
 
-    if ( auto v_node = new(std::nothrow) node_type(std::forward<U>(p_value)) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::forward<U>(p_value)) )
     {
         m_head->push_back(v_node);
 
@@ -268,22 +329,22 @@ void queue<T>::push_back(U&& p_value) noexcept(std::is_nothrow_constructible<T,
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void queue<T>::push(U&& p_value) noexcept(std::is_nothrow_constructible<T, U>::value)
+void queue<T, Allocator>::push(U&& p_value) noexcept(std::is_nothrow_constructible<T, U>::value)
     requires(std::is_constructible<T, U>::value)
 {
     push_back(std::forward<U>(p_value));
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void queue<T>::emplace_back(ARGS&&... p_args) noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+void queue<T, Allocator>::emplace_back(ARGS&&... p_args) noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
     if (not m_head) return;
     
-    if ( auto v_node = new node_type(std::in_place, std::forward<ARGS>(p_args)...) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::in_place, std::forward<ARGS>(p_args)...) )
     {
         m_head->push_back(v_node);
 
@@ -292,11 +353,142 @@ void queue<T>::emplace_back(ARGS&&... p_args) noexcept(std::is_nothrow_construct
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void queue<T>::emplace(ARGS&&... p_args) noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+void queue<T, Allocator>::emplace(ARGS&&... p_args) noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
-    emplace_front(std::forward<ARGS>(p_args)...);
+    emplace_back(std::forward<ARGS>(p_args)...);
+}
+
+
+
+template <class T, class Allocator>
+template <std::ranges::range R>
+void queue<T, Allocator>::push_range(R&& p_range)
+    noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+    requires(std::is_constructible<T, std::ranges::range_reference_t<R>>::value)
+{
+    if (not m_head) return;
+
+    reserve_nodes(m_alloc, p_range);
+
+    node_type* v_first = nullptr;
+    node_type* v_last  = nullptr;
+    size_type  v_count = 0ul;
+
+    auto v_build = [&]() -> void
+    {
+        for (auto&& v_elem : p_range)
+        {
+            node_type* v_node = allocate_node<node_type>(m_alloc, std::forward<decltype(v_elem)>(v_elem));
+
+            if (v_node == nullptr) break;
+
+            if (v_last) { v_last->m_next = v_node; v_node->m_prev = v_last; }
+            else        { v_first = v_node; }
+
+            v_last  = v_node;
+            v_count = v_count + 1ul;
+        }
+    };
+
+    if constexpr (std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+    {
+        v_build();
+    }
+    else {
+        // all or nothing: the queue is untouched until the chain is complete
+        try {
+            v_build();
+        }
+        catch (...) {
+            while (v_count)
+            {
+                node_type* v_next = v_first->m_next;
+
+                deallocate_node(m_alloc, v_first);
+
+                v_first = v_next;
+                v_count = v_count - 1ul;
+            }
+
+            throw;
+        }
+    }
+
+    if (v_first == nullptr) return;
+
+    v_first->m_prev         = m_head->m_prev;
+    m_head->m_prev->m_next  = v_first;
+    v_last->m_next          = m_head;
+    m_head->m_prev          = v_last;
+
+    m_size = m_size + v_count;
+}
+
+
+template <class T, class Allocator>
+template <std::weakly_incrementable O>
+auto queue<T, Allocator>::pop_n(size_type p_count, O p_out)
+    noexcept(nothrow_sink<O, T>) -> size_type
+    requires(std::indirectly_writable<O, T&&>)
+{
+    if (not m_head) return 0ul;
+
+    node_type* v_node = m_head->m_next;
+    size_type  v_done = 0ul;
+
+    auto v_drain = [&]() -> void
+    {
+        for (; (v_done < p_count) && (v_node != m_head); ++v_done, ++p_out)
+        {
+            *p_out = std::move(v_node->m_data);
+
+            node_type* v_next = v_node->m_next;
+
+            deallocate_node(m_alloc, v_node);
+
+            v_node = v_next;
+        }
+    };
+
+    // relink once, behind whatever was moved out
+    auto v_relink = [&]() -> void
+    {
+        m_head->m_next = v_node;
+        v_node->m_prev = m_head;
+
+        m_size = m_size - v_done;
+    };
+
+    if constexpr (nothrow_sink<O, T>)
+    {
+        v_drain();
+    }
+    else {
+        // the element whose move ( or write ) threw stays in front
+        try {
+            v_drain();
+        }
+        catch (...) {
+            v_relink();
+            throw;
+        }
+    }
+
+    v_relink();
+
+    return v_done;
+}
+
+
+template <class T, class Allocator>
+template <std::weakly_incrementable O>
+auto queue<T, Allocator>::drain(O p_out)
+    noexcept(nothrow_sink<O, T>) -> size_type
+    requires(std::indirectly_writable<O, T&&>)
+{
+    return pop_n(m_size, std::move(p_out));
 }
 
 
@@ -310,6 +502,22 @@ template <std::input_iterator I, std::sentinel_for<I> S>
 queue( I, S ) -> queue<std::iter_value_t<I>>;
 
 
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <class T>
+    using queue = ::queue<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+/** NODE POOL ALIAS **/
+namespace pooled
+{
+    template <class T>
+    using queue = ::queue<T, pool_allocator<T>>;
+}
+
+
 
 extern template class queue<int>;
 extern template class queue<char>;
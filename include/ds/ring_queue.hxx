@@ -0,0 +1,380 @@
+#ifndef RING_QUEUE_HXX
+#define RING_QUEUE_HXX
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <utility>
+
+#include <ds/node_allocator.hxx>
+
+
+template <class T, class = std::allocator<T>> class ring_queue;
+
+
+/** TAG FOR A RING THAT NEVER GROWS **/
+struct fixed_capacity_t
+{
+    explicit fixed_capacity_t() = default;
+};
+
+inline constexpr fixed_capacity_t fixed_capacity {};
+
+
+
+/** START RING QUEUE **/
+
+/**
+ * FIFO queue over one contiguous ring buffer.
+ *
+ * Capacity is always a power of two, so wrapping is a mask. The ring
+ * doubles when full unless it was built with fixed_capacity, in which
+ * case push drops the element ( try_push reports it ).
+ * **/
+template <class T, class Allocator> class ring_queue final
+{
+
+private: /** TYPE ALIAS **/
+    using element_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+    using alloc_traits           = std::allocator_traits<element_allocator_type>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using size_type       = std::size_t;
+    using allocator_type  = Allocator;
+
+    static constexpr size_type initial_capacity = 16ul;
+
+
+public: /** CONSTRUCTORS **/
+    /** DEFAULT CTOR **/
+    ring_queue() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** ALLOCATOR CTOR **/
+    explicit ring_queue(Allocator const&) noexcept(true);
+
+    /**
+    * FIXED CAPACITY CTOR
+    * ( capacity rounded up to a power of two, never grows; with no ring every push is dropped )
+    * **/
+    ring_queue(fixed_capacity_t, size_type, Allocator const& = Allocator()) noexcept(true);
+
+    /** COPY CTOR **/
+    ring_queue(ring_queue const&) noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                                           std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** COPY CTOR ( allocator-extended ) **/
+    ring_queue(ring_queue const&, Allocator const&) noexcept(std::is_nothrow_copy_constructible<T>::value);
+
+    /** MOVE CTOR **/
+    ring_queue(ring_queue&&) noexcept(true);
+
+    /**
+    * RANGE CTOR
+    * (Construct with the contents of the range [ begin, end ], reserving once when the length is known)
+    * **/
+    template <std::input_iterator I, std::sentinel_for<I> S>
+    ring_queue(I, S, Allocator const& = Allocator()) noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+        requires(std::is_constructible<T, std::iter_value_t<I>>::value);
+
+    /**
+    * RANGE CTOR
+    * (Construct with the contents of the range)
+    * **/
+    template <std::ranges::range R>
+    ring_queue(R&&, Allocator const& = Allocator()) noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_value_t<R>>::value);
+
+    /**
+    * ASSIGNMENT OP
+    * ( copy-swap idiom )
+    * **/
+    auto operator=(ring_queue) noexcept(std::is_nothrow_copy_constructible<T>::value) -> ring_queue &;
+
+
+public: /** **/
+    template <class U>
+    void push_back(U&&) noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    template <class U>
+    void push(U&&) noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    template <class... ARGS>
+    void emplace_back(ARGS&&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+    template <class... ARGS>
+    void emplace(ARGS&&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+    /** false when the ring is full and fixed ( or out of memory ) **/
+    template <class U>
+    [[nodiscard]] auto try_push(U&&) noexcept(std::is_nothrow_constructible<T, U>::value) -> bool
+        requires(std::is_constructible<T, U>::value);
+
+    template <class... ARGS>
+    [[nodiscard]] auto try_emplace(ARGS&&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value) -> bool;
+
+
+public:
+    void pop_front() noexcept(std::is_nothrow_destructible<T>::value);
+    void pop() noexcept(std::is_nothrow_destructible<T>::value);
+
+    /** MOVE THE FRONT ELEMENT OUT AND POP IT, std::nullopt WHEN EMPTY **/
+    [[nodiscard]] auto try_pop() noexcept(std::is_nothrow_move_constructible<T>::value) -> std::optional<value_type>;
+
+
+public:
+    [[nodiscard]] auto peek() const noexcept(true) -> std::optional<value_type>;
+    [[nodiscard]] auto peek()       noexcept(true) -> std::optional<value_type>;
+
+    [[nodiscard]] auto front() const noexcept(true) -> std::optional<value_type>;
+    [[nodiscard]] auto front()       noexcept(true) -> std::optional<value_type>;
+
+    [[nodiscard]] auto back() const noexcept(true) -> std::optional<value_type>;
+    [[nodiscard]] auto back()       noexcept(true) -> std::optional<value_type>;
+
+    /** THE ELEMENT IN PLACE, nullptr WHEN EMPTY ( valid until it is popped ) **/
+    [[nodiscard]] auto front_ptr() const noexcept(true) -> const_pointer;
+    [[nodiscard]] auto front_ptr()       noexcept(true) -> pointer;
+
+    [[nodiscard]] auto back_ptr() const noexcept(true) -> const_pointer;
+    [[nodiscard]] auto back_ptr()       noexcept(true) -> pointer;
+
+
+public:
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto full() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+    [[nodiscard]] auto capacity() const noexcept(true) -> size_type;
+
+    [[nodiscard]] auto is_fixed() const noexcept(true) -> bool;
+
+
+public:
+    /** GROW TO HOLD AT LEAST `count` ELEMENTS ( no-op on a fixed ring ) **/
+    void reserve(size_type /* count */) noexcept(true);
+
+    /** SHRINK TO THE SMALLEST POWER OF TWO HOLDING size() ( no-op on a fixed ring ) **/
+    void shrink_to_fit() noexcept(true);
+
+
+public:
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+
+public:
+    ~ring_queue() noexcept(std::is_nothrow_destructible<T>::value);
+
+
+public:
+    friend void swap(ring_queue& p_lhs, ring_queue& p_rhs) noexcept(true)
+    {
+        std::swap(p_lhs.m_data,     p_rhs.m_data);
+        std::swap(p_lhs.m_capacity, p_rhs.m_capacity);
+        std::swap(p_lhs.m_head,     p_rhs.m_head);
+        std::swap(p_lhs.m_size,     p_rhs.m_size);
+        std::swap(p_lhs.m_fixed,    p_rhs.m_fixed);
+        swap_allocators(p_lhs.m_alloc, p_rhs.m_alloc);
+    }
+
+    void debug() const noexcept(true)
+    {
+        for (size_type i = 0ul; i < m_size; ++i)
+        {
+            std::cout << m_data[slot(i)] << ' ';
+        }
+        std::cout << std::endl;
+    }
+
+
+private:
+    /** PHYSICAL INDEX OF THE i-TH ELEMENT FROM THE FRONT **/
+    [[nodiscard]] auto slot(size_type p_index) const noexcept(true) -> size_type
+    {
+        return (m_head + p_index) & (m_capacity - 1ul);
+    }
+
+    /** MAKE ROOM FOR ONE MORE ELEMENT **/
+    [[nodiscard]] auto make_room() noexcept(true) -> bool;
+
+    /**
+    * MOVE THE ELEMENTS INTO A FRESH RING OF `capacity` SLOTS ( a power of two, >= size )
+    * ( false, with the ring untouched, when allocation or a copy fails )
+    * **/
+    [[nodiscard]] auto relocate(size_type /* capacity */) noexcept(true) -> bool;
+
+
+private:
+    T*        m_data {};
+    size_type m_capacity {};
+    size_type m_head {};
+    size_type m_size {};
+    bool      m_fixed {};
+
+    [[no_unique_address]] element_allocator_type m_alloc;
+};
+
+
+/** **/
+//  //
+/** **/
+
+
+template <class T, class Allocator>
+template <std::input_iterator I, std::sentinel_for<I> S>
+ring_queue<T, Allocator>::ring_queue(I p_begin, S p_end, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+        requires(std::is_constructible<T, std::iter_value_t<I>>::value)
+    : ring_queue(p_alloc)
+{
+    // the length is known up front: one allocation, no regrowth
+    if constexpr (std::sized_sentinel_for<S, I> or std::forward_iterator<I>)
+    {
+        reserve(static_cast<size_type>(std::ranges::distance(p_begin, p_end)));
+    }
+
+    using std::placeholders::_1;
+
+    auto lambda = &ring_queue::template push_back<std::iter_reference_t<I>>;
+
+    std::ranges::for_each(p_begin, p_end, std::bind(lambda, this, _1));
+}
+
+
+template <class T, class Allocator>
+template <std::ranges::range R>
+ring_queue<T, Allocator>::ring_queue(R&& p_container, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_value_t<R>>::value)
+    : ring_queue(p_alloc)
+{
+    if constexpr (std::ranges::sized_range<R> or std::ranges::forward_range<R>)
+    {
+        reserve(static_cast<size_type>(std::ranges::distance(p_container)));
+    }
+
+    using std::placeholders::_1;
+
+    auto lambda = &ring_queue::template push_back<std::ranges::range_reference_t<R>>;
+
+    std::ranges::for_each(p_container, std::bind(lambda, this, _1));
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+auto ring_queue<T, Allocator>::try_emplace(ARGS&&... p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value) -> bool
+{
+    if (m_size == m_capacity and not m_fixed)
+    {
+        // the arguments may refer to an element of the ring that growing frees
+        T v_value(std::forward<ARGS>(p_args)...);
+
+        if (not make_room()) return false;
+
+        alloc_traits::construct(m_alloc, m_data + slot(m_size), std::move(v_value));
+    }
+    else {
+        if (not make_room()) return false;
+
+        alloc_traits::construct(m_alloc, m_data + slot(m_size), std::forward<ARGS>(p_args)...);
+    }
+
+    m_size = m_size + 1ul;
+
+    return true;
+}
+
+
+template <class T, class Allocator>
+template <class U>
+auto ring_queue<T, Allocator>::try_push(U&& p_value)
+    noexcept(std::is_nothrow_constructible<T, U>::value) -> bool
+    requires(std::is_constructible<T, U>::value)
+{
+    return try_emplace(std::forward<U>(p_value));
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void ring_queue<T, Allocator>::push_back(U&& p_value) noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    static_cast<void>(try_emplace(std::forward<U>(p_value)));
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void ring_queue<T, Allocator>::push(U&& p_value) noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    push_back(std::forward<U>(p_value));
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void ring_queue<T, Allocator>::emplace_back(ARGS&&... p_args) noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    static_cast<void>(try_emplace(std::forward<ARGS>(p_args)...));
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void ring_queue<T, Allocator>::emplace(ARGS&&... p_args) noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    emplace_back(std::forward<ARGS>(p_args)...);
+}
+
+
+
+/** USER DEFINED TYPE DEDUCTION **/
+
+template <std::ranges::range R>
+ring_queue( R ) -> ring_queue<std::ranges::range_value_t<R>>;
+
+template <std::input_iterator I, std::sentinel_for<I> S>
+ring_queue( I, S ) -> ring_queue<std::iter_value_t<I>>;
+
+
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <class T>
+    using ring_queue = ::ring_queue<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+extern template class ring_queue<int>;
+extern template class ring_queue<char>;
+extern template class ring_queue<long>;
+extern template class ring_queue<short>;
+extern template class ring_queue<unsigned int>;
+extern template class ring_queue<unsigned char>;
+extern template class ring_queue<unsigned long>;
+extern template class ring_queue<unsigned short>;
+extern template class ring_queue<float>;
+extern template class ring_queue<double>;
+extern template class ring_queue<std::string>;
+
+#endif
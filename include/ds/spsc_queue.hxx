@@ -0,0 +1,276 @@
+#ifndef SPSC_QUEUE_HXX
+#define SPSC_QUEUE_HXX
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <ds/cache_line.hxx>
+#include <ds/container_stats.hxx>
+#include <ds/output_sink.hxx>
+
+
+template <class T, class = std::allocator<T>> class spsc_queue;
+
+
+/** START SPSC QUEUE **/
+
+/**
+ * Bounded wait-free queue for exactly one producer and one consumer thread.
+ *
+ * The ring is allocated once, in the constructor. Each side owns one
+ * index and keeps a cached copy of the other side's index on its own
+ * cache line; it only reloads the shared one when the cache says the
+ * ring looks full ( producer ) or empty ( consumer ).
+ *
+ * try_push / try_emplace / push_n may only be called from the producer,
+ * try_pop / pop_n only from the consumer.
+ * **/
+template <class T, class Allocator> class spsc_queue final
+{
+
+private: /** TYPE ALIAS **/
+    using element_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+    using alloc_traits           = std::allocator_traits<element_allocator_type>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using size_type       = std::size_t;
+    using allocator_type  = Allocator;
+
+
+public: /** CONSTRUCTORS **/
+
+    /**
+    * CAPACITY CTOR
+    * ( capacity rounded up to a power of two, at least 2; 0 when out of memory )
+    * **/
+    explicit spsc_queue(size_type /* capacity */, Allocator const& = Allocator()) noexcept(true);
+
+    spsc_queue(spsc_queue const&) = delete;
+
+    auto operator=(spsc_queue const&) -> spsc_queue& = delete;
+
+
+public: /** PRODUCER **/
+    template <class U>
+    [[nodiscard]] auto try_push(U&&) noexcept(std::is_nothrow_constructible<T, U>::value) -> bool
+        requires(std::is_constructible<T, U>::value);
+
+    template <class... ARGS>
+    [[nodiscard]] auto try_emplace(ARGS&&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value) -> bool;
+
+    /** PUSH UP TO `count` ELEMENTS FROM `first`, RETURNS HOW MANY FIT ( one index publish per batch ) **/
+    template <std::input_iterator I>
+    auto push_n(I /* first */, size_type /* count */)
+        noexcept(std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value) -> size_type
+        requires(std::is_constructible<T, std::iter_reference_t<I>>::value);
+
+
+public: /** CONSUMER **/
+    [[nodiscard]] auto try_pop() noexcept(std::is_nothrow_move_constructible<T>::value) -> std::optional<value_type>;
+
+    /** MOVE UP TO `count` ELEMENTS INTO `out`, RETURNS HOW MANY ( one index publish per batch ) **/
+    template <std::weakly_incrementable O>
+    auto pop_n(O /* out */, size_type /* count */)
+        noexcept(nothrow_sink<O, T>) -> size_type
+        requires(std::indirectly_writable<O, T&&>);
+
+
+public: /** EITHER SIDE ( a snapshot, exact only when the other side is idle ) **/
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+    [[nodiscard]] auto capacity() const noexcept(true) -> size_type;
+
+
+public:
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+
+public:
+    ~spsc_queue() noexcept(std::is_nothrow_destructible<T>::value);
+
+
+private:
+    [[nodiscard]] auto slot(size_type p_index) const noexcept(true) -> T*
+    {
+        return m_data + (p_index & (m_capacity - 1ul));
+    }
+
+    /** FREE SLOTS AS SEEN BY THE PRODUCER, RELOADING THE HEAD ONLY WHEN NEEDED **/
+    [[nodiscard]] auto free_slots(size_type /* tail */, size_type /* wanted */) noexcept(true) -> size_type;
+
+    /** READY ELEMENTS AS SEEN BY THE CONSUMER, RELOADING THE TAIL ONLY WHEN NEEDED **/
+    [[nodiscard]] auto ready_slots(size_type /* head */, size_type /* wanted */) noexcept(true) -> size_type;
+
+
+private:
+    /** consumer side **/
+    alignas(cache_line_size) std::atomic<size_type> m_head {};
+    size_type m_tail_cache {};
+
+    /** producer side **/
+    alignas(cache_line_size) std::atomic<size_type> m_tail {};
+    size_type m_head_cache {};
+
+    /** read only after construction **/
+    alignas(cache_line_size) T* m_data {};
+    size_type m_capacity {};
+
+    [[no_unique_address]] element_allocator_type m_alloc;
+};
+
+/** END SPSC QUEUE **/
+
+
+/** **/
+//  //
+/** **/
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+auto spsc_queue<T, Allocator>::try_emplace(ARGS&&... p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value) -> bool
+{
+    const size_type v_tail = m_tail.load(std::memory_order_relaxed);
+
+    if (free_slots(v_tail, 1ul) == 0ul) return false;
+
+    alloc_traits::construct(m_alloc, slot(v_tail), std::forward<ARGS>(p_args)...);
+
+    m_tail.store(v_tail + 1ul, std::memory_order_release);
+
+    return true;
+}
+
+
+template <class T, class Allocator>
+template <class U>
+auto spsc_queue<T, Allocator>::try_push(U&& p_value)
+    noexcept(std::is_nothrow_constructible<T, U>::value) -> bool
+    requires(std::is_constructible<T, U>::value)
+{
+    return try_emplace(std::forward<U>(p_value));
+}
+
+
+template <class T, class Allocator>
+template <std::input_iterator I>
+auto spsc_queue<T, Allocator>::push_n(I p_first, size_type p_count)
+    noexcept(std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value) -> size_type
+    requires(std::is_constructible<T, std::iter_reference_t<I>>::value)
+{
+    const size_type v_tail  = m_tail.load(std::memory_order_relaxed);
+    const size_type v_count = std::min(p_count, free_slots(v_tail, p_count));
+
+    size_type v_done = 0ul;
+
+    auto v_fill = [&]() -> void
+    {
+        for (; v_done < v_count; ++v_done, ++p_first)
+        {
+            alloc_traits::construct(m_alloc, slot(v_tail + v_done), *p_first);
+        }
+    };
+
+    if constexpr (std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value)
+    {
+        v_fill();
+    }
+    else {
+        // publish whatever was built before the throw
+        try {
+            v_fill();
+        }
+        catch (...) {
+            m_tail.store(v_tail + v_done, std::memory_order_release);
+            throw;
+        }
+    }
+
+    m_tail.store(v_tail + v_done, std::memory_order_release);
+
+    return v_done;
+}
+
+
+template <class T, class Allocator>
+template <std::weakly_incrementable O>
+auto spsc_queue<T, Allocator>::pop_n(O p_out, size_type p_count)
+    noexcept(nothrow_sink<O, T>) -> size_type
+    requires(std::indirectly_writable<O, T&&>)
+{
+    const size_type v_head  = m_head.load(std::memory_order_relaxed);
+    const size_type v_count = std::min(p_count, ready_slots(v_head, p_count));
+
+    size_type v_done = 0ul;
+
+    auto v_drain = [&]() -> void
+    {
+        for (; v_done < v_count; ++v_done, ++p_out)
+        {
+            T* v_elem = slot(v_head + v_done);
+
+            *p_out = std::move(*v_elem);
+
+            alloc_traits::destroy(m_alloc, v_elem);
+        }
+    };
+
+    if constexpr (nothrow_sink<O, T>)
+    {
+        v_drain();
+    }
+    else {
+        // the element whose move ( or write ) threw stays queued,
+        // only the slots already consumed are handed back to the producer
+        try {
+            v_drain();
+        }
+        catch (...) {
+            m_head.store(v_head + v_done, std::memory_order_release);
+            throw;
+        }
+    }
+
+    m_head.store(v_head + v_done, std::memory_order_release);
+
+    return v_done;
+}
+
+
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <class T>
+    using spsc_queue = ::spsc_queue<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+extern template class spsc_queue<int>;
+extern template class spsc_queue<char>;
+extern template class spsc_queue<long>;
+extern template class spsc_queue<short>;
+extern template class spsc_queue<unsigned int>;
+extern template class spsc_queue<unsigned char>;
+extern template class spsc_queue<unsigned long>;
+extern template class spsc_queue<unsigned short>;
+extern template class spsc_queue<float>;
+extern template class spsc_queue<double>;
+extern template class spsc_queue<std::string>;
+
+#endif
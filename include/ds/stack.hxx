@@ -6,21 +6,27 @@
 #include <exception>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <ranges>
 #include <string>
 
+#include <ds/node_allocator.hxx>
+#include <ds/node_pool.hxx>
+#include <ds/output_sink.hxx>
 
-template <class> class stack;
+
+template <class T, class = std::allocator<T>> class stack;
 
 
 // START NODE
 //
-template <class T> class node final
+template <class T> class stack_node final
 {
 
 public:
-    friend class stack<T>;
+    template <class, class> friend class stack;
 
 public: /** TYPE ALIAS **/
     using value_type      = T;
@@ -33,13 +39,13 @@ public: /** TYPE ALIAS **/
 
 public: /** CONSTRUCTORS **/
     /** DEFAULT CTOR **/
-    node() noexcept(std::is_nothrow_default_constructible<T>::value)
+    stack_node() noexcept(std::is_nothrow_default_constructible<T>::value)
             requires(std::is_default_constructible<T>::value)
         : m_data{T{}}
     {}
 
     /** PARAM CTOR **/
-    explicit node(T const &p_value, node* p_next)
+    explicit stack_node(T const &p_value, stack_node* p_next)
             noexcept(std::is_nothrow_copy_constructible<T>::value)
         requires(std::is_copy_constructible<T>::value)
         : m_data{p_value}
@@ -47,7 +53,7 @@ public: /** CONSTRUCTORS **/
     {}
 
     /** PARAM CTOR **/
-    explicit node(T &&p_value, node* p_next)
+    explicit stack_node(T &&p_value, stack_node* p_next)
             noexcept(std::is_nothrow_move_constructible<T>::value)
         requires(std::is_move_constructible<T>::value)
         : m_data{std::move(p_value)}
@@ -56,8 +62,8 @@ public: /** CONSTRUCTORS **/
 
     /** **/
     template <class... ARGS>
-    node(std::in_place_t,  &&...p_args)
-            noexcept(std::ic_nothrow_constructible<T, ARGS...>::value)
+    stack_node(std::in_place_t, ARGS &&...p_args)
+            noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
             requires(std::is_constructible<T, ARGS...>::value)
         : m_data{std::forward<ARGS>(p_args)...}
         , m_next{nullptr}
@@ -73,19 +79,23 @@ public: /** GETTERS **/
     auto next()       noexcept(true) -> decltype(auto) { return m_next; }
 
 private:
-    value_type m_data;
-    node*      m_next {};
+    value_type  m_data;
+    stack_node* m_next {};
 
 };
 
 //* END NODE *//
 
 
-template <class T> class stack final
+template <class T, class Allocator> class stack final
 {
 
 public: /** TYPE ALIAS **/
-    using node_type = node<T>;
+    using node_type = stack_node<T>;
+
+private: /** TYPE ALIAS **/
+    using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+    using alloc_traits        = std::allocator_traits<Allocator>;
 
 public: /** TYPE ALIAS **/
     using value_type      = typename node_type::value_type;
@@ -94,16 +104,24 @@ public: /** TYPE ALIAS **/
     using pointer         = typename node_type::pointer;
     using const_pointer   = typename node_type::const_pointer;
     using size_type       = std::size_t;
+    using allocator_type  = Allocator;
 
 
 public: /** CONSTRUCTORS **/
 
 
     /** DEFAULT CTOR **/
-    stack() noexcept(true);
+    stack() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** ALLOCATOR CTOR **/
+    explicit stack(Allocator const &) noexcept(true);
 
     /** COPY CTOR **/
-    stack(stack const &) noexcept(std::is_nothrow_constructible<T>::value);
+    stack(stack const &) noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                                  std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** COPY CTOR ( allocator-extended ) **/
+    stack(stack const &, Allocator const &) noexcept(std::is_nothrow_copy_constructible<T>::value);
 
     /** MOVE CTOR **/
     stack(stack &&) noexcept(true);
@@ -113,7 +131,7 @@ public: /** CONSTRUCTORS **/
     * (Construct with the contents of the range [ begin, end ])
     * **/
     template <std::input_iterator I, std::sentinel_for<I> S>
-    stack(I, S) noexcept(std::is_nothrow_constructible<T, std::iter_value_t<T>>::value)
+    stack(I, S, Allocator const & = Allocator()) noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
         requires(std::is_constructible<T, std::iter_value_t<I>>::value);
 
     /**
@@ -121,7 +139,7 @@ public: /** CONSTRUCTORS **/
     * (Construct with the contents of the range)
     * **/
     template <std::ranges::range R>
-    stack(R &&) noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<T>>::value)
+    stack(R &&, Allocator const & = Allocator()) noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
         requires(std::is_constructible<T, std::ranges::range_value_t<R>>::value);
 
     
@@ -148,17 +166,42 @@ public:
     template <class... ARGS>
     void emplace(ARGS &&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
 
+    /**
+    * PUSH EVERY ELEMENT OF THE RANGE ( the last one ends up on top )
+    * ( the nodes are chained off to the side and linked in with one pointer update )
+    * **/
+    template <std::ranges::range R>
+    void push_range(R &&) noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_reference_t<R>>::value);
+
 
 
 public:
     void pop_front() noexcept(std::is_nothrow_destructible<T>::value);
     void pop() noexcept(std::is_nothrow_destructible<T>::value);
 
+    /** MOVE THE TOP ELEMENT OUT AND POP IT, std::nullopt WHEN EMPTY **/
+    [[nodiscard]] auto try_pop() noexcept(std::is_nothrow_move_constructible<T>::value) -> std::optional<value_type>;
+
+    /** MOVE UP TO `count` ELEMENTS INTO `out`, TOP FIRST; RETURNS HOW MANY **/
+    template <std::weakly_incrementable O>
+    auto pop_n(size_type, O) noexcept(nothrow_sink<O, T>) -> size_type
+        requires(std::indirectly_writable<O, T &&>);
+
+    /** MOVE EVERY ELEMENT INTO `out`, TOP FIRST; RETURNS HOW MANY **/
+    template <std::weakly_incrementable O>
+    auto drain(O) noexcept(nothrow_sink<O, T>) -> size_type
+        requires(std::indirectly_writable<O, T &&>);
+
 
 public:
     [[nodiscard]] auto peep() const noexcept(true) -> std::optional<value_type>;
     [[nodiscard]] auto peep()       noexcept(true) -> std::optional<value_type>;
 
+    /** THE TOP ELEMENT IN PLACE, nullptr WHEN EMPTY ( valid until it is popped ) **/
+    [[nodiscard]] auto peep_ptr() const noexcept(true) -> const_pointer;
+    [[nodiscard]] auto peep_ptr()       noexcept(true) -> pointer;
+
 
 public:
     [[nodiscard]] auto empty() const noexcept(true) -> bool;
@@ -166,6 +209,17 @@ public:
     [[nodiscard]] auto size() const noexcept(true) -> size_type;
 
 
+public:
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+
+public: /** NODE POOL ( only with a pooling allocator, see node_pool.hxx ) **/
+    /** keep enough free nodes around for `count` elements in total **/
+    void reserve(size_type /* count */) requires(node_pooling<node_allocator_type>);
+
+    void shrink_to_fit() noexcept(true) requires(node_pooling<node_allocator_type>);
+
+
 public:
     ~stack() noexcept(std::is_nothrow_destructible<T>::value);
 
@@ -177,8 +231,9 @@ public:
 
     friend void swap(stack &p_lhs, stack &p_rhs) noexcept(true)
     {
-        std::swap(p_lhs.m_head, p_rhs.m_head);
-        std::swap(p_lhs.m_size, p_rhs.m_size);
+        std::swap(p_lhs.m_head,  p_rhs.m_head);
+        std::swap(p_lhs.m_size,  p_rhs.m_size);
+        swap_allocators(p_lhs.m_alloc, p_rhs.m_alloc);
     }
 
 
@@ -199,6 +254,8 @@ public:
 private:
     node_type* m_head {};
     size_type  m_size {};
+
+    [[no_unique_address]] node_allocator_type m_alloc;
 };
 
 
@@ -208,12 +265,12 @@ private:
 /****/
 
 
-template <class T>
+template <class T, class Allocator>
 template <std::input_iterator I, std::sentinel_for<I> S>
-stack<T>::stack(I p_begin, S p_end)
-        noexcept(std::is_nothrow_constructible<T, std::iter_value_t<T>>::value)
+stack<T, Allocator>::stack(I p_begin, S p_end, Allocator const &p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
         requires(std::is_constructible<T, std::iter_value_t<I>>::value)
-    : stack()
+    : stack(p_alloc)
 {
     using std::placeholders::_1;
 
@@ -223,21 +280,21 @@ stack<T>::stack(I p_begin, S p_end)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <std::ranges::range R>
-stack<T>::stack(R &&p_container)
-        noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<T>>::value)
+stack<T, Allocator>::stack(R &&p_container, Allocator const &p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
         requires(std::is_constructible<T, std::ranges::range_value_t<R>>::value)
-    : stack(std::ranges::begin(p_container), std::ranges::end(p_container))
+    : stack(std::ranges::begin(p_container), std::ranges::end(p_container), p_alloc)
 {}
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void stack<T>::push_front(U &&p_value) noexcept(std::is_nothrow_constructible<T,U>::value)
+void stack<T, Allocator>::push_front(U &&p_value) noexcept(std::is_nothrow_constructible<T,U>::value)
     requires(std::is_constructible<T, U>::value)
 {
-    if ( auto v_node = new(std::nothrow) node_type(std::forward<U>(p_value), m_head) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::forward<U>(p_value), m_head) )
     {
         m_head = v_node;
         
@@ -246,21 +303,21 @@ void stack<T>::push_front(U &&p_value) noexcept(std::is_nothrow_constructible<T,
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class U>
-void stack<T>::push(U &&p_value) noexcept(std::is_nothrow_constructible<T, U>::value)
+void stack<T, Allocator>::push(U &&p_value) noexcept(std::is_nothrow_constructible<T, U>::value)
     requires(std::is_constructible<T, U>::value)
 {
     push_front(std::forward<U>(p_value));
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void stack<T>::emplace_front(ARGS &&...p_args)
+void stack<T, Allocator>::emplace_front(ARGS &&...p_args)
     noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
-    if ( auto v_node = new(std::nothrow) node_type(std::in_place, std::forward<ARGS>(p_args)...) )
+    if ( auto v_node = allocate_node<node_type>(m_alloc, std::in_place, std::forward<ARGS>(p_args)...) )
     {
         v_node->m_next = m_head;
         m_head         = v_node;
@@ -270,9 +327,9 @@ void stack<T>::emplace_front(ARGS &&...p_args)
 }
 
 
-template <class T>
+template <class T, class Allocator>
 template <class... ARGS>
-void stack<T>::emplace(ARGS &&...p_args)
+void stack<T, Allocator>::emplace(ARGS &&...p_args)
     noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
 {
     emplace_front(std::forward<ARGS>(p_args)...);
@@ -280,6 +337,121 @@ void stack<T>::emplace(ARGS &&...p_args)
 
 
 
+template <class T, class Allocator>
+template <std::ranges::range R>
+void stack<T, Allocator>::push_range(R &&p_range)
+    noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+    requires(std::is_constructible<T, std::ranges::range_reference_t<R>>::value)
+{
+    reserve_nodes(m_alloc, p_range);
+
+    node_type* v_top    = nullptr;      // top of the new chain
+    node_type* v_bottom = nullptr;      // goes on the current top
+    size_type  v_count  = 0ul;
+
+    auto v_build = [&]() -> void
+    {
+        for (auto &&v_elem : p_range)
+        {
+            node_type* v_node = allocate_node<node_type>(m_alloc, std::forward<decltype(v_elem)>(v_elem), v_top);
+
+            if (v_node == nullptr) break;
+
+            if (v_bottom == nullptr) v_bottom = v_node;
+
+            v_top   = v_node;
+            v_count = v_count + 1ul;
+        }
+    };
+
+    if constexpr (std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+    {
+        v_build();
+    }
+    else {
+        // all or nothing: the stack is untouched until the chain is complete
+        try {
+            v_build();
+        }
+        catch (...) {
+            while (v_top)
+            {
+                node_type* v_next = v_top->m_next;
+
+                deallocate_node(m_alloc, v_top);
+
+                v_top = v_next;
+            }
+
+            throw;
+        }
+    }
+
+    if (v_bottom == nullptr) return;
+
+    v_bottom->m_next = m_head;
+    m_head           = v_top;
+
+    m_size = m_size + v_count;
+}
+
+
+template <class T, class Allocator>
+template <std::weakly_incrementable O>
+auto stack<T, Allocator>::pop_n(size_type p_count, O p_out)
+    noexcept(nothrow_sink<O, T>) -> size_type
+    requires(std::indirectly_writable<O, T &&>)
+{
+    node_type* v_node = m_head;
+    size_type  v_done = 0ul;
+
+    auto v_drain = [&]() -> void
+    {
+        for (; (v_done < p_count) && v_node; ++v_done, ++p_out)
+        {
+            *p_out = std::move(v_node->m_data);
+
+            node_type* v_next = v_node->m_next;
+
+            deallocate_node(m_alloc, v_node);
+
+            v_node = v_next;
+        }
+    };
+
+    if constexpr (nothrow_sink<O, T>)
+    {
+        v_drain();
+    }
+    else {
+        // the element whose move ( or write ) threw stays on top
+        try {
+            v_drain();
+        }
+        catch (...) {
+            m_head = v_node;
+            m_size = m_size - v_done;
+            throw;
+        }
+    }
+
+    m_head = v_node;
+    m_size = m_size - v_done;
+
+    return v_done;
+}
+
+
+template <class T, class Allocator>
+template <std::weakly_incrementable O>
+auto stack<T, Allocator>::drain(O p_out)
+    noexcept(nothrow_sink<O, T>) -> size_type
+    requires(std::indirectly_writable<O, T &&>)
+{
+    return pop_n(m_size, std::move(p_out));
+}
+
+
 /** USER DEFINED TYPE DEDUCTION **/
 template <std::ranges::range R>
 stack( R ) -> stack<std::ranges::range_value_t<R>>;
@@ -288,6 +460,22 @@ template <std::input_iterator I, std::sentinel_for<I> S>
 stack( I, S ) -> stack<std::iter_value_t<I>>;
 
 
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <class T>
+    using stack = ::stack<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+/** NODE POOL ALIAS **/
+namespace pooled
+{
+    template <class T>
+    using stack = ::stack<T, pool_allocator<T>>;
+}
+
+
 extern template class stack<int>;
 extern template class stack<char>;
 extern template class stack<long>;
@@ -0,0 +1,394 @@
+#ifndef STATIC_SEARCH_SET_HXX
+#define STATIC_SEARCH_SET_HXX
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include <ds/binary_search_tree.hxx>
+#include <ds/container_stats.hxx>
+
+
+/**
+ * Read-only snapshot of an ordered set.
+ *
+ * Keys are stored once, in an implicit Eytzinger ( BFS ) layout: the
+ * children of slot k are slots 2k and 2k + 1, there are no per-node
+ * pointers, and the top levels of every search share the same few
+ * cache lines. The descent is branch free ( one compare and one add
+ * per level ) and prefetches the cache line holding the great-grandchildren
+ * of the current slot, so the memory latency of consecutive levels overlaps.
+ * **/
+template <std::totally_ordered T> class static_search_set final
+{
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using size_type       = std::size_t;
+
+
+public: /** LAYOUT **/
+    static constexpr size_type cache_line = 64ul;
+
+    /** slots per cache line; prefetching slot k * stride fetches k's descendants log2(stride) levels down **/
+    static constexpr size_type prefetch_stride =
+        std::bit_floor(std::max<size_type>(1ul, cache_line / sizeof(T)));
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    static_search_set() noexcept(true);
+
+    /**
+     * TREE CTOR
+     * (Snapshot the keys of a tree; its in-order walk is already sorted)
+     * **/
+    template <balance_policy B, class A>
+    explicit static_search_set(binary_search_tree<T, B, A> const& /* tree */)
+        noexcept(std::is_nothrow_copy_constructible<T>::value);
+
+    /**
+     * INITIALIZER_LIST CTOR
+     * (Construct with the contents of the initializer list)
+     * **/
+    static_search_set(std::initializer_list<T> /* list */) noexcept(
+        std::is_nothrow_copy_constructible<T>::value);
+
+    /**
+     * RANGE TYPE CTOR
+     * (Construct with the contents of the range, sorted first)
+     * **/
+    template <std::ranges::input_range R>
+    explicit static_search_set(R&& /* range */)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(non_self<R, static_search_set> &&
+                 std::is_constructible<T, std::ranges::range_value_t<R>>::value);
+
+    /**
+     * SORTED RANGE TYPE CTOR
+     * (Construct with the contents of an already sorted range, no sorting pass)
+     * **/
+    template <std::ranges::forward_range R>
+    static_search_set(sorted_range_t, R&& /* range */)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_reference_t<R>>::value);
+
+    /** COPY CTOR **/
+    static_search_set(static_search_set const& /* outer */) noexcept(
+        std::is_nothrow_copy_constructible<T>::value);
+
+    /** MOVE CTOR **/
+    static_search_set(static_search_set&& /* outer */) noexcept(true);
+
+    /** ASSIGNMENT **/
+    static_search_set& operator=(static_search_set /* rhs */) noexcept(true);
+
+
+public: /** LOOKUP **/
+
+    /** SMALLEST KEY NOT LESS THAN KEY, NULL WHEN NONE **/
+    template <class K>
+    [[nodiscard]] auto lower_bound(K const& /* key */) const noexcept(true) -> const_pointer
+        requires(std::totally_ordered_with<T, K>);
+
+    /** SMALLEST KEY GREATER THAN KEY, NULL WHEN NONE **/
+    template <class K>
+    [[nodiscard]] auto upper_bound(K const& /* key */) const noexcept(true) -> const_pointer
+        requires(std::totally_ordered_with<T, K>);
+
+    /** KEY EQUAL TO KEY, NULL WHEN ABSENT **/
+    template <class K>
+    [[nodiscard]] auto find(K const& /* key */) const noexcept(true) -> const_pointer
+        requires(std::totally_ordered_with<T, K>);
+
+    template <class K>
+    [[nodiscard]] auto contains(K const& /* key */) const noexcept(true) -> bool
+        requires(std::totally_ordered_with<T, K>);
+
+    /** SEARCH FOR A KEY ( copy out, same contract as binary_search_tree::search ) **/
+    auto search(T const& /* key */) const noexcept(true) -> std::optional<value_type>;
+
+
+public:
+
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+    [[nodiscard]] auto max() const noexcept(true) -> std::optional<value_type>;
+
+    [[nodiscard]] auto min() const noexcept(true) -> std::optional<value_type>;
+
+
+public:
+
+    ~static_search_set() noexcept(std::is_nothrow_destructible<T>::value);
+
+
+public:
+
+    friend void swap(static_search_set& p_lhs, static_search_set& p_rhs) noexcept(true)
+    {
+        using std::swap;
+
+        swap(p_lhs.m_keys, p_rhs.m_keys);
+        swap(p_lhs.m_size, p_rhs.m_size);
+    }
+
+
+private: /** HELPERS **/
+
+    /** ALLOCATE SLOTS 0 .. n ( slot 0 stays unconstructed ), FALSE WHEN OUT OF MEMORY **/
+    [[nodiscard]] auto allocate(size_type /* count */) noexcept(true) -> bool;
+
+    /** HAND THE SLOTS BACK ( the keys must already be gone ) **/
+    void deallocate() noexcept(true);
+
+    /**
+     * FILL THE SUBTREE AT SLOT k OF A count SLOT LAYOUT FROM A SORTED SEQUENCE, IN ORDER
+     * ( when a key constructor throws, what the call built is destroyed again )
+     * **/
+    template <std::input_iterator I>
+    void layout(I& /* first */, size_type /* slot */, size_type /* count */)
+        noexcept(std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value);
+
+    /** DESTROY THE ( FULLY BUILT ) SUBTREE AT SLOT k OF A count SLOT LAYOUT **/
+    void destroy_subtree(size_type /* slot */, size_type /* count */) noexcept(true);
+
+    /** BUILD FROM count SORTED KEYS **/
+    template <std::input_iterator I>
+    void assign_sorted(I /* first */, size_type /* count */)
+        noexcept(std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value);
+
+    /** SLOT HOLDING THE RESULT OF A DESCENT THAT ENDED PAST THE LEAVES **/
+    [[nodiscard]] static constexpr auto settle(size_type p_slot) noexcept(true) -> size_type
+    {
+        // the descent went right once per trailing 1 bit after the last
+        // left turn; dropping those bits and that left turn gives the answer
+        return p_slot >> (std::countr_one(p_slot) + 1);
+    }
+
+    void prefetch(size_type p_slot) const noexcept(true)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        auto v_address = reinterpret_cast<std::uintptr_t>(m_keys)
+                       + (p_slot * prefetch_stride * sizeof(T));
+
+        __builtin_prefetch(reinterpret_cast<void const*>(v_address));
+#else
+        (void)p_slot;
+#endif
+    }
+
+
+private:
+    T*        m_keys {};   // slots 1 .. m_size
+    size_type m_size {};
+};
+
+// //
+
+template <std::totally_ordered T>
+template <balance_policy B, class A>
+static_search_set<T>::static_search_set(binary_search_tree<T, B, A> const& p_tree)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+    : static_search_set()
+{
+    assign_sorted(p_tree.begin(), static_cast<size_type>(std::ranges::distance(p_tree)));
+}
+
+
+template <std::totally_ordered T>
+template <std::ranges::input_range R>
+static_search_set<T>::static_search_set(R&& p_range)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(non_self<R, static_search_set> &&
+                 std::is_constructible<T, std::ranges::range_value_t<R>>::value)
+    : static_search_set()
+{
+    std::vector<T> v_sorted;
+
+    for (auto&& v_value : p_range)
+    {
+        v_sorted.emplace_back(std::forward<decltype(v_value)>(v_value));
+    }
+
+    std::ranges::sort(v_sorted);
+
+    assign_sorted(std::make_move_iterator(v_sorted.begin()), v_sorted.size());
+}
+
+
+template <std::totally_ordered T>
+template <std::ranges::forward_range R>
+static_search_set<T>::static_search_set(sorted_range_t, R&& p_range)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_reference_t<R>>::value)
+        requires(std::is_constructible<T, std::ranges::range_reference_t<R>>::value)
+    : static_search_set()
+{
+    assign_sorted(std::ranges::begin(p_range), static_cast<size_type>(std::ranges::distance(p_range)));
+}
+
+
+template <std::totally_ordered T>
+template <class K>
+auto static_search_set<T>::lower_bound(K const& p_key) const noexcept(true) -> const_pointer
+    requires(std::totally_ordered_with<T, K>)
+{
+    size_type v_slot = 1ul;
+
+    while (v_slot <= m_size)
+    {
+        prefetch(v_slot);
+
+        v_slot = (2ul * v_slot) + static_cast<size_type>(m_keys[v_slot] < p_key);
+    }
+
+    v_slot = settle(v_slot);
+
+    return (v_slot != 0ul) ? (m_keys + v_slot) : nullptr;
+}
+
+
+template <std::totally_ordered T>
+template <class K>
+auto static_search_set<T>::upper_bound(K const& p_key) const noexcept(true) -> const_pointer
+    requires(std::totally_ordered_with<T, K>)
+{
+    size_type v_slot = 1ul;
+
+    while (v_slot <= m_size)
+    {
+        prefetch(v_slot);
+
+        v_slot = (2ul * v_slot) + static_cast<size_type>(not (p_key < m_keys[v_slot]));
+    }
+
+    v_slot = settle(v_slot);
+
+    return (v_slot != 0ul) ? (m_keys + v_slot) : nullptr;
+}
+
+
+template <std::totally_ordered T>
+template <class K>
+auto static_search_set<T>::find(K const& p_key) const noexcept(true) -> const_pointer
+    requires(std::totally_ordered_with<T, K>)
+{
+    const_pointer v_bound = lower_bound(p_key);
+
+    return ((v_bound != nullptr) && not (p_key < *v_bound)) ? v_bound : nullptr;
+}
+
+
+template <std::totally_ordered T>
+template <class K>
+auto static_search_set<T>::contains(K const& p_key) const noexcept(true) -> bool
+    requires(std::totally_ordered_with<T, K>)
+{
+    return (find(p_key) != nullptr);
+}
+
+
+template <std::totally_ordered T>
+template <std::input_iterator I>
+void static_search_set<T>::layout(I& p_first, size_type p_slot, size_type p_count)
+    noexcept(std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value)
+{
+    if (p_slot > p_count) return;
+
+    layout(p_first, 2ul * p_slot, p_count);
+
+    if constexpr (std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value)
+    {
+        std::construct_at(m_keys + p_slot, *p_first);
+        ++p_first;
+
+        layout(p_first, (2ul * p_slot) + 1ul, p_count);
+    }
+    else {
+        // the left subtree is complete here; a throw below leaves only it ( and maybe this slot ) to undo
+        try {
+            std::construct_at(m_keys + p_slot, *p_first);
+        }
+        catch (...) {
+            destroy_subtree(2ul * p_slot, p_count);
+            throw;
+        }
+
+        try {
+            ++p_first;
+
+            layout(p_first, (2ul * p_slot) + 1ul, p_count);
+        }
+        catch (...) {
+            std::destroy_at(m_keys + p_slot);
+            destroy_subtree(2ul * p_slot, p_count);
+            throw;
+        }
+    }
+}
+
+
+template <std::totally_ordered T>
+template <std::input_iterator I>
+void static_search_set<T>::assign_sorted(I p_first, size_type p_count)
+    noexcept(std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value)
+{
+    if ((p_count == 0ul) || (not allocate(p_count))) return;
+
+    // m_size only once every key is there: the destructor trusts it
+    if constexpr (std::is_nothrow_constructible<T, std::iter_reference_t<I>>::value)
+    {
+        layout(p_first, 1ul, p_count);
+    }
+    else {
+        try {
+            layout(p_first, 1ul, p_count);
+        }
+        catch (...) {
+            deallocate();
+            throw;
+        }
+    }
+
+    m_size = p_count;
+}
+
+
+/** USER DEFINED TYPE DEDUCTION **/
+template <std::totally_ordered T, balance_policy B, class A>
+static_search_set(binary_search_tree<T, B, A> const&) -> static_search_set<T>;
+
+template <std::ranges::input_range R>
+static_search_set(R) -> static_search_set<std::ranges::range_value_t<R>>;
+
+template <std::ranges::forward_range R>
+static_search_set(sorted_range_t, R) -> static_search_set<std::ranges::range_value_t<R>>;
+
+
+extern template class static_search_set<int>;
+extern template class static_search_set<char>;
+extern template class static_search_set<long>;
+extern template class static_search_set<short>;
+extern template class static_search_set<unsigned int>;
+extern template class static_search_set<unsigned char>;
+extern template class static_search_set<unsigned long>;
+extern template class static_search_set<unsigned short>;
+extern template class static_search_set<float>;
+extern template class static_search_set<double>;
+extern template class static_search_set<std::string>;
+
+#endif
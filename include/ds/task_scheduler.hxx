@@ -0,0 +1,168 @@
+#ifndef TASK_SCHEDULER_HXX
+#define TASK_SCHEDULER_HXX
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <ds/cache_line.hxx>
+#include <ds/mpmc_queue.hxx>
+#include <ds/work_stealing_deque.hxx>
+
+
+/** START TASK SCHEDULER **/
+
+/**
+ * Fixed pool of worker threads that balance work by stealing.
+ *
+ * Every worker owns a work_stealing_deque. A task submitted from a worker
+ * goes onto that worker's own deque, which it pops newest first; idle
+ * workers steal the oldest tasks from the others, which for fork / join
+ * code are the largest pieces left. Tasks submitted from any other thread
+ * go through a shared inbox ( an mpmc_queue ) that workers check before
+ * they steal.
+ *
+ * Workers with nothing to do sleep on an atomic wait and are woken by the
+ * next submit, they do not spin.
+ *
+ * A task that waits for a subtask calls join() rather than future::get():
+ * on a worker, join() keeps running other tasks until the result is there,
+ * so the pool can not deadlock on its own children.
+ * **/
+class task_scheduler final
+{
+
+public: /** TYPE ALIAS **/
+    using size_type = std::size_t;
+    using task_type = std::move_only_function<void()>;
+
+
+private:
+    static constexpr size_type inbox_capacity = 1024ul;
+
+
+public: /** CONSTRUCTORS **/
+
+    /**
+    * WORKER COUNT CTOR
+    * ( at least one worker; defaults to one per hardware thread )
+    * **/
+    explicit task_scheduler(size_type = std::thread::hardware_concurrency());
+
+    task_scheduler(task_scheduler const&) = delete;
+
+    auto operator=(task_scheduler const&) -> task_scheduler& = delete;
+
+
+public:
+    /** RUN `f` ON SOME WORKER, ITS RESULT ( OR EXCEPTION ) ARRIVES THROUGH THE FUTURE **/
+    template <class F>
+    [[nodiscard]] auto submit(F&&) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+        requires(std::is_invocable<std::decay_t<F>>::value);
+
+    /** WAIT FOR `future`, RUNNING OTHER TASKS MEANWHILE WHEN CALLED FROM A WORKER **/
+    template <class R>
+    auto join(std::future<R>& /* future */) -> R;
+
+
+public:
+    [[nodiscard]] auto workers() const noexcept(true) -> size_type;
+
+
+public:
+    /** RUNS EVERYTHING ALREADY SUBMITTED, THEN STOPS THE WORKERS **/
+    ~task_scheduler() noexcept(true);
+
+
+private:
+    struct alignas(cache_line_size) worker final
+    {
+        work_stealing_deque<void*> m_deque;
+        std::thread                m_thread;
+    };
+
+private:
+    /** QUEUE A TASK: THE CALLING WORKER'S DEQUE, OR THE INBOX **/
+    void schedule(task_type* /* task */) noexcept(true);
+
+    /** OWN DEQUE, THEN THE INBOX, THEN STEAL; nullptr WHEN THERE IS NOTHING ANYWHERE **/
+    [[nodiscard]] auto find_task(size_type /* self */) noexcept(true) -> task_type*;
+
+    /** RUN AND FREE A TASK **/
+    static void execute(task_type* /* task */) noexcept(true);
+
+    /** INDEX OF THE CALLING THREAD IF IT IS ONE OF OUR WORKERS, workers() OTHERWISE **/
+    [[nodiscard]] auto current_worker() const noexcept(true) -> size_type;
+
+    /** BODY OF WORKER `self` **/
+    void run(size_type /* self */) noexcept(true);
+
+    /** ONE STEP OF join(): RUN SOMETHING, OR GIVE THE CPU UP **/
+    void help(size_type /* self */) noexcept(true);
+
+    void wake_one() noexcept(true);
+
+
+private:
+    std::vector<std::unique_ptr<worker>> m_workers;
+
+    mpmc_queue<void*> m_inbox;
+
+    /** bumped on every submit: a worker only sleeps if it saw no work since it read it **/
+    alignas(cache_line_size) std::atomic<std::uint32_t> m_signal {};
+    std::atomic<bool> m_stop {};
+};
+
+
+/** ONE SCHEDULER FOR THE WHOLE PROCESS, STARTED ON FIRST USE ( one worker per hardware thread ) **/
+[[nodiscard]] auto shared_scheduler() -> task_scheduler&;
+
+/** END TASK SCHEDULER **/
+
+
+/** **/
+//  //
+/** **/
+
+
+template <class F>
+auto task_scheduler::submit(F&& p_func) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+    requires(std::is_invocable<std::decay_t<F>>::value)
+{
+    using result_type = std::invoke_result_t<std::decay_t<F>>;
+
+    std::packaged_task<result_type()> v_job(std::forward<F>(p_func));
+
+    std::future<result_type> v_future = v_job.get_future();
+
+    schedule(std::make_unique<task_type>(std::move(v_job)).release());
+
+    return v_future;
+}
+
+
+template <class R>
+auto task_scheduler::join(std::future<R>& p_future) -> R
+{
+    const size_type v_self = current_worker();
+
+    if (v_self != workers())
+    {
+        while (p_future.wait_for(std::chrono::seconds::zero()) != std::future_status::ready)
+        {
+            help(v_self);
+        }
+    }
+
+    return p_future.get();
+}
+
+#endif
@@ -0,0 +1,651 @@
+#ifndef UNROLLED_FORWARD_LIST_HXX
+#define UNROLLED_FORWARD_LIST_HXX
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <ds/cache_line.hxx>
+#include <ds/node_allocator.hxx>
+#include <ds/node_pool.hxx>
+
+
+template <class T, class = std::allocator<T>> class unrolled_forward_list;
+template <class> class unrolled_iterator;
+
+
+/** START NODE **/
+
+/**
+ * Run of raw slots followed by the link, two cache lines for the
+ * arithmetic types. The live elements are always the last `m_count`
+ * slots, so the front of the node is where push_front writes and the
+ * scan kernels can read whole, aligned 16 byte chunks up to the end.
+ * **/
+template <class T> class alignas(std::max(cache_line_size, alignof(T))) unrolled_node final
+{
+
+public:
+    template <class, class> friend class unrolled_forward_list;
+    friend class unrolled_iterator<T>;
+
+public:
+    /** two cache lines less 16 bytes for the link and the count, never fewer than 4 slots **/
+    static constexpr std::size_t capacity = std::max<std::size_t>(4ul, (2ul * cache_line_size - 16ul) / sizeof(T));
+
+
+public: /** CONSTRUCTORS **/
+    /** DEFAULT CTOR ( slots stay raw ) **/
+    unrolled_node() noexcept(true) {}
+
+    unrolled_node(unrolled_node const&) = delete;
+
+    auto operator=(unrolled_node const&) -> unrolled_node& = delete;
+
+
+private:
+    auto slot(std::size_t p_index) noexcept(true) -> T*
+    {
+        return reinterpret_cast<T*>(m_storage + p_index * sizeof(T));
+    }
+
+    auto at(std::size_t p_index) const noexcept(true) -> T const*
+    {
+        return std::launder(reinterpret_cast<T const*>(m_storage + p_index * sizeof(T)));
+    }
+
+    auto at(std::size_t p_index) noexcept(true) -> T*
+    {
+        return std::launder(slot(p_index));
+    }
+
+    /** SLOT OF THE FIRST LIVE ELEMENT **/
+    auto first() const noexcept(true) -> std::size_t
+    {
+        return capacity - m_count;
+    }
+
+private:
+    alignas(T) std::byte m_storage[capacity * sizeof(T)];
+
+    unrolled_node* m_next  {};
+    std::uint32_t  m_count {};
+};
+
+/** END NODE **/
+
+
+/** START ITERATOR **/
+
+template <class T> class unrolled_iterator final
+{
+
+public: /** TYPE ALIAS **/
+    using node_type = unrolled_node<T>;
+
+public: /** TYPE ALIAS **/
+    using value_type        = T;
+    using reference         = typename std::add_lvalue_reference<T>::type;
+    using pointer           = typename std::add_pointer<T>::type;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+
+public: /** CONSTRUCTORS **/
+    unrolled_iterator() noexcept(true) = default;
+
+    /** PARAM CTOR **/
+    unrolled_iterator(node_type* p_node, std::size_t p_index) noexcept(true)
+        : m_node(p_node), m_index(p_index)
+    {}
+
+
+public:
+    /** DEREFERENCE OP **/
+    auto operator*() const noexcept(true) -> reference { return *m_node->at(m_index); }
+
+    /** ARROW OP **/
+    auto operator->() const noexcept(true) -> pointer { return m_node->at(m_index); }
+
+
+    /** (POST & PRE ) INCREMENT OP **/
+    auto operator++() noexcept(true) -> unrolled_iterator &
+    {
+        if (++m_index == node_type::capacity)
+        {
+            m_node  = m_node->m_next;
+            m_index = m_node ? m_node->first() : 0ul;
+        }
+
+        return *this;
+    }
+
+    auto operator++(int) noexcept(true) -> unrolled_iterator
+    {
+        auto copy = auto{ *this };
+        ++*this;
+
+        return copy;
+    }
+
+
+    /** COMPAR OP **/
+    [[nodiscard]] friend auto operator==(unrolled_iterator const &p_lhs,
+                                         unrolled_iterator const &p_rhs) noexcept(true)
+        -> bool
+    {
+        return (p_lhs.m_node == p_rhs.m_node) and (p_lhs.m_index == p_rhs.m_index);
+    }
+
+
+private:
+    node_type*  m_node  {};
+    std::size_t m_index {};
+};
+
+/** END ITERATOR **/
+
+
+
+/** START UNROLLED FORWARD LIST **/
+
+/**
+ * Singly linked sequence with several elements per node ( an unrolled
+ * list ), so a walk pays one pointer chase per node instead of one per
+ * element and the elements of a node share its cache lines.
+ *
+ * push_front / pop_front stay O(1); inserting or erasing at a position
+ * walks the nodes, then shifts at most one node's worth of elements,
+ * splitting a full node in two when needed.
+ *
+ * find / count / contains compare a node at a time; for the arithmetic
+ * types the comparisons run over fixed 16 byte chunks, written so the
+ * compiler turns each chunk into a single vector compare.
+ * **/
+template <class T, class Allocator> class unrolled_forward_list final
+{
+
+public: /** TYPE ALIAS **/
+    using node_type = unrolled_node<T>;
+
+private: /** TYPE ALIAS **/
+    using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+    using alloc_traits        = std::allocator_traits<Allocator>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using allocator_type  = Allocator;
+
+    using iterator          = unrolled_iterator<T>;
+    using iterator_category = std::forward_iterator_tag;
+
+    static constexpr size_type node_capacity = node_type::capacity;
+
+
+public: /** CONSTRUCTORS **/
+
+    /** DEFAULT CTOR **/
+    unrolled_forward_list() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** ALLOCATOR CTOR **/
+    explicit unrolled_forward_list(Allocator const&) noexcept(true);
+
+    /** COPY CTOR **/
+    unrolled_forward_list(unrolled_forward_list const&) noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                                                                 std::is_nothrow_default_constructible<Allocator>::value);
+
+    /** COPY CTOR ( allocator-extended ) **/
+    unrolled_forward_list(unrolled_forward_list const&, Allocator const&) noexcept(std::is_nothrow_copy_constructible<T>::value);
+
+    /** MOVE CTOR **/
+    unrolled_forward_list(unrolled_forward_list&&) noexcept(true);
+
+    /**
+    * INITIALIZER_LIST CTOR
+    * (Construct with the contents of the initializer list)
+    * **/
+    unrolled_forward_list(std::initializer_list<T>, Allocator const& = Allocator()) noexcept(std::is_nothrow_copy_constructible<T>::value);
+
+    /**
+    * RANGE CTOR
+    * (Construct with the contents of the range)
+    * **/
+    template <std::ranges::range R>
+    unrolled_forward_list(R&&, Allocator const& = Allocator()) noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(not std::is_same<std::remove_cvref_t<R>, unrolled_forward_list>::value &&
+                 std::is_constructible<T, std::ranges::range_value_t<R>>::value);
+
+    /**
+    * RANGE CTOR
+    * (Construct with the contents of the range [ begin, end ])
+    * **/
+    template <std::input_iterator I, std::sentinel_for<I> S>
+    unrolled_forward_list(I, S, Allocator const& = Allocator()) noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+        requires(std::is_constructible<T, std::iter_value_t<I>>::value);
+
+
+    /**
+    * ASSIGNMENT OP
+    * ( copy-swap idiom )
+    * **/
+    auto operator=(unrolled_forward_list) noexcept(std::is_nothrow_copy_constructible<T>::value) -> unrolled_forward_list &;
+
+
+
+public:
+    template <class U>
+    void push_front(U&&)
+        noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    /** ( the new element becomes element `pos` ) **/
+    template <class U>
+    void push_before(U&&, std::integral auto)
+        noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    /** ( the new element becomes element `pos + 1` ) **/
+    template <class U>
+    void push_after(U&&, std::integral auto)
+        noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+    /** ( like push_before, but pos == size() appends ) **/
+    template <class U>
+    void push_at(U&&, std::integral auto)
+        noexcept(std::is_nothrow_constructible<T, U>::value)
+        requires(std::is_constructible<T, U>::value);
+
+
+    template <class... ARGS>
+    void emplace_front(ARGS&& ...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+    template <class... ARGS>
+    void emplace_before(std::integral auto, ARGS&& ...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+    template <class... ARGS>
+    void emplace_after(std::integral auto, ARGS&& ...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+    template <class... ARGS>
+    void emplace_at(std::integral auto, ARGS&& ...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+
+
+public:
+    void pop_front() noexcept(std::is_nothrow_destructible<T>::value);
+    void pop_at(std::integral auto) noexcept(std::is_nothrow_destructible<T>::value);
+
+
+
+public:
+    [[nodiscard]] auto front() const noexcept(true) -> std::optional<value_type>;
+    [[nodiscard]] auto front()       noexcept(true) -> std::optional<value_type>;
+
+
+
+public: /** SEARCH ( a node at a time, vectorized for the arithmetic types ) **/
+    /** FIRST ELEMENT EQUAL TO `value`, end() WHEN THERE IS NONE **/
+    [[nodiscard]] auto find(const_reference) const noexcept(true) -> iterator;
+
+    [[nodiscard]] auto count(const_reference) const noexcept(true) -> size_type;
+
+    [[nodiscard]] auto contains(const_reference) const noexcept(true) -> bool;
+
+
+
+public:
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+
+public:
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+
+public: /** NODE POOL ( only with a pooling allocator, see node_pool.hxx ) **/
+    /** keep enough free nodes around for `count` elements in total **/
+    void reserve(size_type /* count */) requires(node_pooling<node_allocator_type>);
+
+    void shrink_to_fit() noexcept(true) requires(node_pooling<node_allocator_type>);
+
+
+public:
+    auto begin() const noexcept(true) -> iterator;
+    auto begin()       noexcept(true) -> iterator;
+
+    auto end() const noexcept(true) -> iterator;
+    auto end()       noexcept(true) -> iterator;
+
+
+public:
+    ~unrolled_forward_list() noexcept(std::is_nothrow_destructible<T>::value);
+
+
+public:
+    friend void swap(unrolled_forward_list &p_lhs, unrolled_forward_list &p_rhs) noexcept(true)
+    {
+        using std::swap;
+
+        swap(p_lhs.m_head, p_rhs.m_head);
+        swap(p_lhs.m_size, p_rhs.m_size);
+
+        swap_allocators(p_lhs.m_alloc, p_rhs.m_alloc);
+    }
+
+
+    void debug() const noexcept(true)
+    {
+        for (node_type const* v_node = m_head; v_node; v_node = v_node->m_next)
+        {
+            std::cout << '[';
+
+            for (size_type i = v_node->first(); i < node_capacity; ++i) std::cout << ' ' << *v_node->at(i);
+
+            std::cout << " ] ";
+        }
+
+        std::cout << std::endl;
+    }
+
+
+private:
+    /** THE NODE HOLDING ELEMENT `pos`, THE NODE BEFORE IT ( nullptr FOR THE HEAD ) AND THE SLOT **/
+    struct place final
+    {
+        node_type* m_prev;
+        node_type* m_node;
+        size_type  m_slot;
+    };
+
+private:
+    /** WHERE ELEMENT `pos` LIVES, `pos` MUST BE IN RANGE **/
+    [[nodiscard]] auto locate(size_type /* pos */) const noexcept(true) -> place;
+
+    /** RAW SLOT THAT BECOMES ELEMENT `pos`, nullptr WHEN OUT OF MEMORY **/
+    [[nodiscard]] auto open_slot(size_type /* pos */) noexcept(true) -> T*;
+
+    /** DROP THE ( ALREADY DESTROYED ) ELEMENT `pos`, FREEING ITS NODE IF IT EMPTIES **/
+    void close_slot(size_type /* pos */) noexcept(true);
+
+    /** MOVE THE BACK HALF OF THE FULL `node` INTO `spare`, LINKED RIGHT AFTER IT **/
+    void split(node_type* /* node */, node_type* /* spare */) noexcept(true);
+
+    /** MOVE THE ELEMENT AT `from` INTO THE RAW SLOT `to` ( T's move is taken not to throw ) **/
+    void relocate(T* /* from */, T* /* to */) noexcept(true);
+
+    /** SLOT OF THE FIRST MATCH IN `node`, node_capacity WHEN THERE IS NONE **/
+    [[nodiscard]] static auto scan_find(node_type const* /* node */, const_reference) noexcept(true) -> size_type;
+
+    [[nodiscard]] static auto scan_count(node_type const* /* node */, const_reference) noexcept(true) -> size_type;
+
+    /** MATCHES IN THE 16 BYTE CHUNK AT `chunk` ( arithmetic types only ) **/
+    [[nodiscard]] static auto chunk_hits(const_pointer /* chunk */, const_reference) noexcept(true) -> unsigned;
+
+    /** BUILD `args` AND MOVE IT INTO A SLOT OPENED AT `pos`, A NO-OP PAST THE END **/
+    template <class... ARGS>
+    void insert_at(size_type /* pos */, ARGS&&...) noexcept(std::is_nothrow_constructible<T, ARGS...>::value);
+
+private:
+    [[no_unique_address]] node_allocator_type m_alloc;
+
+    node_type* m_head {};
+    size_type  m_size {0ul};
+};
+
+/** END UNROLLED FORWARD LIST **/
+
+
+/** **/
+//  //
+/** **/
+
+
+template <class T, class Allocator>
+template <std::input_iterator I, std::sentinel_for<I> S>
+unrolled_forward_list<T, Allocator>::unrolled_forward_list(I p_first, S p_last, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+        requires(std::is_constructible<T, std::iter_value_t<I>>::value)
+    : unrolled_forward_list(p_alloc)
+{
+    Allocator   v_alloc(m_alloc);
+    node_type** v_link = &m_head;
+
+    // fill whole nodes front to back, then slide each to the end of its slots
+    while (p_first != p_last)
+    {
+        node_type* v_node = allocate_node<node_type>(m_alloc);
+
+        if (v_node == nullptr) return;
+
+        auto v_fill = [&]() -> void
+        {
+            for (; p_first != p_last and v_node->m_count < node_capacity; ++p_first)
+            {
+                alloc_traits::construct(v_alloc, v_node->slot(v_node->m_count), *p_first);
+
+                v_node->m_count = v_node->m_count + 1u;
+                m_size          = m_size + 1ul;
+            }
+        };
+
+        auto v_hang = [&]() -> void
+        {
+            const size_type v_shift = node_capacity - v_node->m_count;
+
+            if (v_shift != 0ul)
+            {
+                for (size_type i = v_node->m_count; i-- > 0ul; ) relocate(v_node->at(i), v_node->slot(i + v_shift));
+            }
+
+            *v_link = v_node;
+            v_link  = &v_node->m_next;
+        };
+
+        if constexpr (std::is_nothrow_constructible<T, std::iter_value_t<I>>::value)
+        {
+            v_fill();
+        }
+        else {
+            try {
+                v_fill();
+            }
+            catch (...) {
+                if (v_node->m_count == 0u) deallocate_node(m_alloc, v_node);
+                else                       v_hang();
+                throw;
+            }
+        }
+
+        v_hang();
+    }
+}
+
+
+template <class T, class Allocator>
+template <std::ranges::range R>
+unrolled_forward_list<T, Allocator>::unrolled_forward_list(R&& p_range, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_constructible<T, std::ranges::range_value_t<R>>::value)
+        requires(not std::is_same<std::remove_cvref_t<R>, unrolled_forward_list>::value &&
+                 std::is_constructible<T, std::ranges::range_value_t<R>>::value)
+    : unrolled_forward_list(std::ranges::begin(p_range), std::ranges::end(p_range), p_alloc)
+{}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void unrolled_forward_list<T, Allocator>::insert_at(size_type p_pos, ARGS&&... p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    if (p_pos > m_size) return;
+
+    // built before anything shifts: the arguments may refer to an element of this list
+    T v_value(std::forward<ARGS>(p_args)...);
+
+    T* v_slot = open_slot(p_pos);
+
+    if (v_slot == nullptr) return;
+
+    Allocator v_alloc(m_alloc);
+
+    alloc_traits::construct(v_alloc, v_slot, std::move(v_value));
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void unrolled_forward_list<T, Allocator>::push_front(U&& p_data)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    insert_at(0ul, std::forward<U>(p_data));
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void unrolled_forward_list<T, Allocator>::push_before(U&& p_data, std::integral auto p_pos)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    if ( std::cmp_less(p_pos, 0) || std::cmp_greater_equal(p_pos, m_size) ) return;
+
+    insert_at(static_cast<size_type>(p_pos), std::forward<U>(p_data));
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void unrolled_forward_list<T, Allocator>::push_after(U&& p_data, std::integral auto p_pos)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    if ( std::cmp_less(p_pos, 0) || std::cmp_greater_equal(p_pos, m_size) ) return;
+
+    insert_at(static_cast<size_type>(p_pos) + 1ul, std::forward<U>(p_data));
+}
+
+
+template <class T, class Allocator>
+template <class U>
+void unrolled_forward_list<T, Allocator>::push_at(U&& p_data, std::integral auto p_pos)
+    noexcept(std::is_nothrow_constructible<T, U>::value)
+    requires(std::is_constructible<T, U>::value)
+{
+    if ( std::cmp_less(p_pos, 0) ) return;
+
+    insert_at(static_cast<size_type>(p_pos), std::forward<U>(p_data));
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void unrolled_forward_list<T, Allocator>::emplace_front(ARGS&& ...p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    insert_at(0ul, std::forward<ARGS>(p_args)...);
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void unrolled_forward_list<T, Allocator>::emplace_before(std::integral auto p_pos, ARGS&& ...p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    if ( std::cmp_less(p_pos, 0) || std::cmp_greater_equal(p_pos, m_size) ) return;
+
+    insert_at(static_cast<size_type>(p_pos), std::forward<ARGS>(p_args)...);
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void unrolled_forward_list<T, Allocator>::emplace_after(std::integral auto p_pos, ARGS&& ...p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    if ( std::cmp_less(p_pos, 0) || std::cmp_greater_equal(p_pos, m_size) ) return;
+
+    insert_at(static_cast<size_type>(p_pos) + 1ul, std::forward<ARGS>(p_args)...);
+}
+
+
+template <class T, class Allocator>
+template <class... ARGS>
+void unrolled_forward_list<T, Allocator>::emplace_at(std::integral auto p_pos, ARGS&& ...p_args)
+    noexcept(std::is_nothrow_constructible<T, ARGS...>::value)
+{
+    if ( std::cmp_less(p_pos, 0) ) return;
+
+    insert_at(static_cast<size_type>(p_pos), std::forward<ARGS>(p_args)...);
+}
+
+
+template <class T, class Allocator>
+void unrolled_forward_list<T, Allocator>::pop_at(std::integral auto p_pos)
+    noexcept(std::is_nothrow_destructible<T>::value)
+{
+    if ( std::cmp_less(p_pos, 0) || std::cmp_greater_equal(p_pos, m_size) ) return;
+
+    const place v_place = locate(static_cast<size_type>(p_pos));
+
+    Allocator v_alloc(m_alloc);
+
+    alloc_traits::destroy(v_alloc, v_place.m_node->at(v_place.m_slot));
+
+    close_slot(static_cast<size_type>(p_pos));
+}
+
+
+
+/** USER DEFINED TYPE DEDUCTION **/
+template <std::ranges::range R>  unrolled_forward_list( R ) -> unrolled_forward_list<std::ranges::range_value_t<R>>;
+template <std::input_iterator I, std::sentinel_for<I> S> unrolled_forward_list( I, S ) -> unrolled_forward_list<std::iter_value_t<I>>;
+
+
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <class T>
+    using unrolled_forward_list = ::unrolled_forward_list<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+/** NODE POOL ALIAS **/
+namespace pooled
+{
+    template <class T>
+    using unrolled_forward_list = ::unrolled_forward_list<T, pool_allocator<T>>;
+}
+
+
+
+extern template class unrolled_forward_list<int>;
+extern template class unrolled_forward_list<char>;
+extern template class unrolled_forward_list<long>;
+extern template class unrolled_forward_list<short>;
+extern template class unrolled_forward_list<unsigned int>;
+extern template class unrolled_forward_list<unsigned char>;
+extern template class unrolled_forward_list<unsigned long>;
+extern template class unrolled_forward_list<unsigned short>;
+extern template class unrolled_forward_list<float>;
+extern template class unrolled_forward_list<double>;
+extern template class unrolled_forward_list<std::string>;
+
+#endif
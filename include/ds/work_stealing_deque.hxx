@@ -0,0 +1,181 @@
+#ifndef WORK_STEALING_DEQUE_HXX
+#define WORK_STEALING_DEQUE_HXX
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <type_traits>
+
+#include <ds/cache_line.hxx>
+#include <ds/container_stats.hxx>
+
+
+/** START CONSTRAINTS **/
+
+/** thieves read a slot before they know they won it, so elements are copied bit for bit **/
+template <class T>
+concept stealable = std::is_trivially_copyable<T>::value;
+
+/** END CONSTRAINTS **/
+
+
+template <stealable T, class = std::allocator<T>> class work_stealing_deque;
+
+
+/** START ARRAY **/
+
+template <class T> class work_stealing_array final
+{
+
+public:
+    template <stealable, class> friend class work_stealing_deque;
+
+private:
+    auto at(std::ptrdiff_t p_index) noexcept(true) -> std::atomic<T>&
+    {
+        return m_slots[static_cast<std::size_t>(p_index) & (m_capacity - 1ul)];
+    }
+
+private:
+    std::atomic<T>*      m_slots {};
+    std::size_t          m_capacity {};
+
+    /** the array this one replaced, thieves may still be reading it **/
+    work_stealing_array* m_prev {};
+};
+
+/** END ARRAY **/
+
+
+
+/** START WORK STEALING DEQUE **/
+
+/**
+ * Chase-Lev work-stealing deque ( in the C11 formulation of Lê, Pop,
+ * Cohen and Zappa Nardelli ).
+ *
+ * One owner thread pushes and pops at the bottom, LIFO, without any
+ * read-modify-write unless the deque is down to its last element. Any
+ * other thread may steal from the top, FIFO, with one CAS.
+ *
+ * The ring doubles when the owner runs out of room. A thief may still be
+ * reading the old ring, so replaced rings are kept until the deque dies;
+ * they add up to less than the live one.
+ *
+ * push / pop may only be called from the owner, steal from anywhere.
+ * **/
+template <stealable T, class Allocator> class work_stealing_deque final
+{
+
+public: /** TYPE ALIAS **/
+    using array_type = work_stealing_array<T>;
+
+private: /** TYPE ALIAS **/
+    using array_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<array_type>;
+    using slot_allocator_type  = typename std::allocator_traits<Allocator>::template rebind_alloc<std::atomic<T>>;
+    using array_traits         = std::allocator_traits<array_allocator_type>;
+    using slot_traits          = std::allocator_traits<slot_allocator_type>;
+
+public: /** TYPE ALIAS **/
+    using value_type      = T;
+    using reference       = typename std::add_lvalue_reference<T>::type;
+    using const_reference = typename std::add_lvalue_reference<typename std::add_const<T>::type>::type;
+    using pointer         = typename std::add_pointer<T>::type;
+    using const_pointer   = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using size_type       = std::size_t;
+    using allocator_type  = Allocator;
+
+
+private:
+    static constexpr size_type initial_capacity = 64ul;
+
+
+public: /** CONSTRUCTORS **/
+
+    /**
+    * CAPACITY CTOR
+    * ( rounded up to a power of two; the first push retries when out of memory )
+    * **/
+    explicit work_stealing_deque(size_type = initial_capacity, Allocator const& = Allocator()) noexcept(true);
+
+    work_stealing_deque(work_stealing_deque const&) = delete;
+
+    auto operator=(work_stealing_deque const&) -> work_stealing_deque& = delete;
+
+
+public: /** OWNER **/
+    /** false only when the ring was full and could not grow **/
+    [[nodiscard]] auto push(T) noexcept(true) -> bool;
+
+    /** newest element first **/
+    [[nodiscard]] auto pop() noexcept(true) -> std::optional<value_type>;
+
+
+public: /** ANY THREAD **/
+    /** oldest element first; empty as well when another thief won the race **/
+    [[nodiscard]] auto steal() noexcept(true) -> std::optional<value_type>;
+
+
+public: /** SNAPSHOTS ( exact only from the owner while nobody steals ) **/
+    [[nodiscard]] auto empty() const noexcept(true) -> bool;
+
+    [[nodiscard]] auto size() const noexcept(true) -> size_type;
+
+    [[nodiscard]] auto capacity() const noexcept(true) -> size_type;
+
+
+public:
+    [[nodiscard]] auto get_allocator() const noexcept(true) -> allocator_type;
+
+
+public:
+    ~work_stealing_deque() noexcept(true);
+
+
+private:
+    /** A RING OF `capacity` SLOTS, nullptr WHEN OUT OF MEMORY **/
+    [[nodiscard]] auto make_array(size_type /* capacity */) noexcept(true) -> array_type*;
+
+    /** COPY [ top, bottom ) INTO A RING TWICE AS LARGE AND PUBLISH IT **/
+    [[nodiscard]] auto grow(array_type* /* array */, std::ptrdiff_t /* top */, std::ptrdiff_t /* bottom */) noexcept(true) -> array_type*;
+
+
+private:
+    /** thieves **/
+    alignas(cache_line_size) std::atomic<std::ptrdiff_t> m_top {};
+
+    /** owner **/
+    alignas(cache_line_size) std::atomic<std::ptrdiff_t> m_bottom {};
+    std::atomic<array_type*> m_array {};
+
+    [[no_unique_address]] array_allocator_type m_alloc;
+};
+
+/** END WORK STEALING DEQUE **/
+
+
+/** POLYMORPHIC ALLOCATOR ALIAS **/
+namespace pmr
+{
+    template <stealable T>
+    using work_stealing_deque = ::work_stealing_deque<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+
+extern template class work_stealing_deque<int>;
+extern template class work_stealing_deque<char>;
+extern template class work_stealing_deque<long>;
+extern template class work_stealing_deque<short>;
+extern template class work_stealing_deque<unsigned int>;
+extern template class work_stealing_deque<unsigned char>;
+extern template class work_stealing_deque<unsigned long>;
+extern template class work_stealing_deque<unsigned short>;
+extern template class work_stealing_deque<float>;
+extern template class work_stealing_deque<double>;
+extern template class work_stealing_deque<void*>;
+
+#endif
@@ -0,0 +1,681 @@
+//  --------------------------------------------
+//  --------------------------------------------
+        #include <ds/b_tree.hxx>
+//  --------------------------------------------
+//  --------------------------------------------
+
+
+// start b_tree
+
+
+
+//
+template <b_tree_key T, class Allocator>
+b_tree<T, Allocator>::b_tree() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+    : b_tree(Allocator())
+{}
+
+
+//
+template <b_tree_key T, class Allocator>
+b_tree<T, Allocator>::b_tree(Allocator const& p_alloc) noexcept(true)
+    : m_alloc(p_alloc)
+{
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+b_tree<T, Allocator>::b_tree(std::initializer_list<T> p_list, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+    : b_tree(std::ranges::begin(p_list), std::ranges::end(p_list), p_alloc) {
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+b_tree<T, Allocator>::b_tree(b_tree const& p_outer)
+        noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                 std::is_nothrow_default_constructible<Allocator>::value)
+    : b_tree(p_outer, alloc_traits::select_on_container_copy_construction(p_outer.get_allocator()))
+{
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+b_tree<T, Allocator>::b_tree(b_tree const& p_outer, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+    : b_tree(p_alloc)
+{
+    m_root = clone(p_outer.m_root);
+    m_size = (m_root != nullptr) ? p_outer.m_size : 0ul;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+b_tree<T, Allocator>::b_tree(b_tree&& p_outer) noexcept(true)
+    : b_tree(p_outer.get_allocator())
+{
+    swap(*this, p_outer);
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+auto b_tree<T, Allocator>::operator=(b_tree p_rhs) noexcept(
+    std::is_nothrow_copy_constructible<T>::value) -> b_tree&
+{
+    // nodes may only change hands between equal allocators
+    if (alloc_traits::propagate_on_container_swap::value or (get_allocator() == p_rhs.get_allocator()))
+    {
+        swap(*this, p_rhs);
+    }
+    else {
+        b_tree v_copy(p_rhs, get_allocator());
+
+        swap(*this, v_copy);
+    }
+
+    return *this;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+auto b_tree<T, Allocator>::search(T const& p_key) const noexcept(true)
+    -> std::optional<typename b_tree::value_type>
+{
+    node_type* v_current = m_root;
+
+    while (v_current != nullptr)
+    {
+        size_type v_index = lower_index(v_current, p_key);
+
+        if ((v_index < v_current->m_count) && (v_current->m_keys[v_index] == p_key))
+        {
+            return v_current->m_keys[v_index];
+        }
+
+        if (v_current->m_leaf) break;
+
+        v_current = children(v_current)[v_index];
+    }
+
+    return std::nullopt;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+void b_tree<T, Allocator>::remove(T const& p_key) noexcept(std::is_nothrow_destructible<T>::value)
+{
+    if (not m_root) return;
+
+    // single top-down pass: every child entered already holds
+    // at least min_degree keys, so a key can always be dropped from it
+    node_type* v_current = m_root;
+
+    while (true)
+    {
+        size_type v_index = lower_index(v_current, p_key);
+
+        bool v_found = (v_index < v_current->m_count) && (v_current->m_keys[v_index] == p_key);
+
+        if (v_current->m_leaf)
+        {
+            if (v_found)
+            {
+                auto v_keys = v_current->m_keys.begin();
+
+                std::move(v_keys + v_index + 1, v_keys + v_current->m_count, v_keys + v_index);
+
+                v_current->m_count = v_current->m_count - 1u;
+
+                m_size = m_size - 1ul;
+            }
+            break;
+        }
+
+        auto& v_children = children(v_current);
+
+        if (v_found)
+        {
+            if (v_children[v_index]->m_count >= min_degree)
+            {
+                v_current->m_keys[v_index] = take_max(v_children[v_index]);
+
+                m_size = m_size - 1ul;
+                break;
+            }
+
+            if (v_children[v_index + 1]->m_count >= min_degree)
+            {
+                v_current->m_keys[v_index] = take_min(v_children[v_index + 1]);
+
+                m_size = m_size - 1ul;
+                break;
+            }
+
+            // both neighbours are minimal: pull the key down into the merged child
+            merge(v_current, v_index);
+
+            v_current = v_children[v_index];
+            continue;
+        }
+
+        if (v_children[v_index]->m_count < min_degree)
+        {
+            v_index = fill(v_current, v_index);
+        }
+
+        v_current = v_children[v_index];
+    }
+
+    if (m_root->m_count == 0u)
+    {
+        node_type* v_old = m_root;
+
+        m_root = m_root->m_leaf ? nullptr : children(m_root)[0];
+
+        v_old = (free_node(v_old), nullptr);
+    }
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+void b_tree<T, Allocator>::clear() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    destroy(m_root);
+
+    m_root = nullptr;
+    m_size = 0ul;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+void b_tree<T, Allocator>::print_inorder() const noexcept(true)
+{
+    if (not m_root) return;
+
+    print(m_root);
+
+    std::cout << std::endl;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+[[nodiscard]] auto b_tree<T, Allocator>::empty() const noexcept(true) -> bool
+{
+    return (not m_root);
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+[[nodiscard]] auto b_tree<T, Allocator>::size() const noexcept(true)
+    -> typename b_tree::size_type
+{
+    return m_size;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+[[nodiscard]] auto b_tree<T, Allocator>::max() const noexcept(true)
+    -> std::optional<typename b_tree::value_type>
+{
+    if (auto v_current = m_root)
+    {
+        while (not v_current->m_leaf)
+            v_current = children(v_current)[v_current->m_count];
+
+        return v_current->m_keys[v_current->m_count - 1u];
+    }
+
+    return std::nullopt;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+[[nodiscard]] auto b_tree<T, Allocator>::min() const noexcept(true)
+    -> std::optional<typename b_tree::value_type>
+{
+    if (auto v_current = m_root)
+    {
+        while (not v_current->m_leaf)
+            v_current = children(v_current)[0];
+
+        return v_current->m_keys[0];
+    }
+
+    return std::nullopt;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+auto b_tree<T, Allocator>::get_allocator() const noexcept(true) -> allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+b_tree<T, Allocator>::~b_tree() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    clear();
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+auto b_tree<T, Allocator>::make_node(bool p_leaf)
+    noexcept(std::is_nothrow_default_constructible<T>::value) -> node_type*
+{
+    if (p_leaf) return allocate_node<node_type>(m_alloc, true);
+
+    inner_allocator_type v_alloc(m_alloc);
+
+    return allocate_node<inner_type>(v_alloc);
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+void b_tree<T, Allocator>::free_node(node_type* p_node) noexcept(std::is_nothrow_destructible<T>::value)
+{
+    if (p_node->m_leaf)
+    {
+        deallocate_node(m_alloc, p_node);
+        return;
+    }
+
+    inner_allocator_type v_alloc(m_alloc);
+
+    deallocate_node(v_alloc, static_cast<inner_type*>(p_node));
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+void b_tree<T, Allocator>::destroy(node_type* p_node) noexcept(std::is_nothrow_destructible<T>::value)
+{
+    if (not p_node) return;
+
+    if (not p_node->m_leaf)
+    {
+        auto& v_children = children(p_node);
+
+        for (size_type i = 0ul; i <= p_node->m_count; ++i)
+        {
+            destroy(v_children[i]);
+        }
+    }
+
+    p_node = (free_node(p_node), nullptr);
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+auto b_tree<T, Allocator>::clone(node_type const* p_node)
+    noexcept(std::is_nothrow_copy_constructible<T>::value) -> node_type*
+{
+    if (not p_node) return nullptr;
+
+    node_type* v_copy = make_node(p_node->m_leaf);
+
+    if (not v_copy) return nullptr;
+
+    std::copy_n(p_node->m_keys.begin(), p_node->m_count, v_copy->m_keys.begin());
+
+    v_copy->m_count = p_node->m_count;
+
+    if (p_node->m_leaf) return v_copy;
+
+    auto& v_from = static_cast<inner_type const*>(p_node)->m_children;
+    auto& v_to   = children(v_copy);
+
+    for (size_type i = 0ul; i <= p_node->m_count; ++i)
+    {
+        if (not (v_to[i] = clone(v_from[i])))
+        {
+            // keep the copy well formed: drop the partial subtree
+            v_copy->m_count = static_cast<std::uint16_t>(i);
+
+            destroy(v_copy);
+            return nullptr;
+        }
+    }
+
+    return v_copy;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+void b_tree<T, Allocator>::print(node_type const* p_node) noexcept(true)
+{
+    for (size_type i = 0ul; i < p_node->m_count; ++i)
+    {
+        if (not p_node->m_leaf)
+            print(static_cast<inner_type const*>(p_node)->m_children[i]);
+
+        std::cout << p_node->m_keys[i] << ' ';
+    }
+
+    if (not p_node->m_leaf)
+        print(static_cast<inner_type const*>(p_node)->m_children[p_node->m_count]);
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+void b_tree<T, Allocator>::attach(T&& p_data) noexcept(std::is_nothrow_move_assignable<T>::value)
+{
+    if (not m_root)
+    {
+        if (not (m_root = make_node(true))) return;
+    }
+
+    if (m_root->m_count == max_keys)
+    {
+        // grow in height: the old root becomes the first child of a new one
+        node_type* v_root = make_node(false);
+
+        if (not v_root) return;
+
+        children(v_root)[0] = m_root;
+
+        if (not split_child(v_root, 0ul))
+        {
+            v_root = (free_node(v_root), nullptr);
+            return;
+        }
+
+        m_root = v_root;
+    }
+
+    // single top-down pass: full children are split before entering them
+    node_type* v_current = m_root;
+
+    while (not v_current->m_leaf)
+    {
+        size_type v_index = upper_index(v_current, p_data);
+
+        auto& v_children = children(v_current);
+
+        if (v_children[v_index]->m_count == max_keys)
+        {
+            if (not split_child(v_current, v_index)) return;
+
+            if (not (p_data < v_current->m_keys[v_index]))
+                v_index = v_index + 1ul;
+        }
+
+        v_current = v_children[v_index];
+    }
+
+    size_type v_index = upper_index(v_current, p_data);
+
+    auto v_keys = v_current->m_keys.begin();
+
+    std::move_backward(v_keys + v_index, v_keys + v_current->m_count, v_keys + v_current->m_count + 1);
+
+    v_current->m_keys[v_index] = std::move(p_data);
+    v_current->m_count         = v_current->m_count + 1u;
+
+    m_size = m_size + 1ul;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+auto b_tree<T, Allocator>::split_child(node_type* p_parent, size_type p_index) noexcept(true) -> bool
+{
+    auto& v_siblings = children(p_parent);
+
+    node_type* v_full = v_siblings[p_index];
+    node_type* v_half = make_node(v_full->m_leaf);
+
+    if (not v_half) return false;
+
+    // upper min_degree - 1 keys (and min_degree children) move to the new node
+    auto v_keys = v_full->m_keys.begin();
+
+    std::move(v_keys + min_degree, v_keys + max_keys, v_half->m_keys.begin());
+
+    if (not v_full->m_leaf)
+    {
+        auto& v_from = children(v_full);
+
+        std::copy(v_from.begin() + min_degree, v_from.end(), children(v_half).begin());
+    }
+
+    v_half->m_count = static_cast<std::uint16_t>(min_degree - 1ul);
+    v_full->m_count = static_cast<std::uint16_t>(min_degree - 1ul);
+
+    // median key moves up into the parent
+    auto v_parent_keys = p_parent->m_keys.begin();
+
+    std::move_backward(v_parent_keys + p_index, v_parent_keys + p_parent->m_count,
+                       v_parent_keys + p_parent->m_count + 1);
+
+    std::copy_backward(v_siblings.begin() + p_index + 1, v_siblings.begin() + p_parent->m_count + 1,
+                       v_siblings.begin() + p_parent->m_count + 2);
+
+    p_parent->m_keys[p_index] = std::move(v_full->m_keys[min_degree - 1ul]);
+    v_siblings[p_index + 1]   = v_half;
+    p_parent->m_count         = p_parent->m_count + 1u;
+
+    return true;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+auto b_tree<T, Allocator>::fill(node_type* p_parent, size_type p_index) noexcept(true) -> size_type
+{
+    auto& v_children = children(p_parent);
+
+    if ((p_index > 0ul) && (v_children[p_index - 1]->m_count >= min_degree))
+    {
+        borrow_from_prev(p_parent, p_index);
+        return p_index;
+    }
+
+    if ((p_index < p_parent->m_count) && (v_children[p_index + 1]->m_count >= min_degree))
+    {
+        borrow_from_next(p_parent, p_index);
+        return p_index;
+    }
+
+    if (p_index < p_parent->m_count)
+    {
+        merge(p_parent, p_index);
+        return p_index;
+    }
+
+    merge(p_parent, p_index - 1ul);
+    return p_index - 1ul;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+void b_tree<T, Allocator>::borrow_from_prev(node_type* p_parent, size_type p_index) noexcept(true)
+{
+    node_type* v_child = children(p_parent)[p_index];
+    node_type* v_prev  = children(p_parent)[p_index - 1];
+
+    auto v_keys = v_child->m_keys.begin();
+
+    std::move_backward(v_keys, v_keys + v_child->m_count, v_keys + v_child->m_count + 1);
+
+    v_child->m_keys[0] = std::move(p_parent->m_keys[p_index - 1]);
+
+    if (not v_child->m_leaf)
+    {
+        auto& v_to = children(v_child);
+
+        std::copy_backward(v_to.begin(), v_to.begin() + v_child->m_count + 1,
+                           v_to.begin() + v_child->m_count + 2);
+
+        v_to[0] = children(v_prev)[v_prev->m_count];
+    }
+
+    p_parent->m_keys[p_index - 1] = std::move(v_prev->m_keys[v_prev->m_count - 1u]);
+
+    v_child->m_count = v_child->m_count + 1u;
+    v_prev->m_count  = v_prev->m_count - 1u;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+void b_tree<T, Allocator>::borrow_from_next(node_type* p_parent, size_type p_index) noexcept(true)
+{
+    node_type* v_child = children(p_parent)[p_index];
+    node_type* v_next  = children(p_parent)[p_index + 1];
+
+    v_child->m_keys[v_child->m_count] = std::move(p_parent->m_keys[p_index]);
+
+    if (not v_child->m_leaf)
+    {
+        auto& v_from = children(v_next);
+
+        children(v_child)[v_child->m_count + 1u] = v_from[0];
+
+        std::copy(v_from.begin() + 1, v_from.begin() + v_next->m_count + 1, v_from.begin());
+    }
+
+    p_parent->m_keys[p_index] = std::move(v_next->m_keys[0]);
+
+    auto v_keys = v_next->m_keys.begin();
+
+    std::move(v_keys + 1, v_keys + v_next->m_count, v_keys);
+
+    v_child->m_count = v_child->m_count + 1u;
+    v_next->m_count  = v_next->m_count - 1u;
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+void b_tree<T, Allocator>::merge(node_type* p_parent, size_type p_index) noexcept(true)
+{
+    auto& v_siblings = children(p_parent);
+
+    node_type* v_child = v_siblings[p_index];
+    node_type* v_next  = v_siblings[p_index + 1];
+
+    auto v_keys = v_child->m_keys.begin() + v_child->m_count;
+
+    *v_keys = std::move(p_parent->m_keys[p_index]);
+
+    std::move(v_next->m_keys.begin(), v_next->m_keys.begin() + v_next->m_count, v_keys + 1);
+
+    if (not v_child->m_leaf)
+    {
+        auto& v_from = children(v_next);
+
+        std::copy(v_from.begin(), v_from.begin() + v_next->m_count + 1,
+                  children(v_child).begin() + v_child->m_count + 1);
+    }
+
+    v_child->m_count = static_cast<std::uint16_t>(v_child->m_count + v_next->m_count + 1u);
+
+    // close the gap in the parent
+    auto v_parent_keys = p_parent->m_keys.begin();
+
+    std::move(v_parent_keys + p_index + 1, v_parent_keys + p_parent->m_count, v_parent_keys + p_index);
+
+    std::copy(v_siblings.begin() + p_index + 2, v_siblings.begin() + p_parent->m_count + 1,
+              v_siblings.begin() + p_index + 1);
+
+    p_parent->m_count = p_parent->m_count - 1u;
+
+    v_next = (free_node(v_next), nullptr);
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+auto b_tree<T, Allocator>::take_max(node_type* p_node) noexcept(true) -> value_type
+{
+    while (not p_node->m_leaf)
+    {
+        size_type v_index = p_node->m_count;
+
+        if (children(p_node)[v_index]->m_count < min_degree)
+        {
+            v_index = fill(p_node, v_index);
+        }
+
+        p_node = children(p_node)[v_index];
+    }
+
+    p_node->m_count = p_node->m_count - 1u;
+
+    return std::move(p_node->m_keys[p_node->m_count]);
+}
+
+
+//
+template <b_tree_key T, class Allocator>
+auto b_tree<T, Allocator>::take_min(node_type* p_node) noexcept(true) -> value_type
+{
+    while (not p_node->m_leaf)
+    {
+        if (children(p_node)[0]->m_count < min_degree)
+        {
+            fill(p_node, 0ul);
+        }
+
+        p_node = children(p_node)[0];
+    }
+
+    value_type v_min = std::move(p_node->m_keys[0]);
+
+    auto v_keys = p_node->m_keys.begin();
+
+    std::move(v_keys + 1, v_keys + p_node->m_count, v_keys);
+
+    p_node->m_count = p_node->m_count - 1u;
+
+    return v_min;
+}
+
+
+
+//
+template class b_tree<int>;
+template class b_tree<char>;
+template class b_tree<long>;
+template class b_tree<short>;
+template class b_tree<unsigned int>;
+template class b_tree<unsigned char>;
+template class b_tree<unsigned long>;
+template class b_tree<unsigned short>;
+template class b_tree<float>;
+template class b_tree<double>;
+template class b_tree<std::string>;
+
+//
+template class b_tree<int, std::pmr::polymorphic_allocator<int>>;
+template class b_tree<char, std::pmr::polymorphic_allocator<char>>;
+template class b_tree<long, std::pmr::polymorphic_allocator<long>>;
+template class b_tree<short, std::pmr::polymorphic_allocator<short>>;
+template class b_tree<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class b_tree<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class b_tree<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class b_tree<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class b_tree<float, std::pmr::polymorphic_allocator<float>>;
+template class b_tree<double, std::pmr::polymorphic_allocator<double>>;
@@ -13,70 +13,85 @@
 
 
 //
-template <std::totally_ordered T>
-binary_search_tree<T>::binary_search_tree() noexcept(true) = default;
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+binary_search_tree<T, Balance, Allocator>::binary_search_tree() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+    : binary_search_tree(Allocator())
+{
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+binary_search_tree<T, Balance, Allocator>::binary_search_tree(Allocator const& p_alloc) noexcept(true)
+    : m_alloc(p_alloc)
+{
+}
 
 
 //
-template <std::totally_ordered T>
-binary_search_tree<T>::binary_search_tree( std::initializer_list<T> p_list)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+binary_search_tree<T, Balance, Allocator>::binary_search_tree( std::initializer_list<T> p_list, Allocator const& p_alloc)
         noexcept(std::is_nothrow_copy_constructible<T>::value)
-    : binary_search_tree(std::ranges::begin(p_list), std::ranges::end(p_list)) {
+    : binary_search_tree(std::ranges::begin(p_list), std::ranges::end(p_list), p_alloc) {
 }
 
 
 //
-template <std::totally_ordered T>
-binary_search_tree<T>::binary_search_tree(binary_search_tree const& p_outer)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+binary_search_tree<T, Balance, Allocator>::binary_search_tree(binary_search_tree const& p_outer)
+        noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                 std::is_nothrow_default_constructible<Allocator>::value)
+    : binary_search_tree(p_outer, alloc_traits::select_on_container_copy_construction(p_outer.get_allocator()))
+{
+}
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+binary_search_tree<T, Balance, Allocator>::binary_search_tree(binary_search_tree const& p_outer, Allocator const& p_alloc)
         noexcept(std::is_nothrow_copy_constructible<T>::value)
-    : binary_search_tree()
+    : binary_search_tree(p_alloc)
 {
     m_root = clone(p_outer.m_root);
     m_size = p_outer.m_size;
 }
 
 //
-template <std::totally_ordered T>
-binary_search_tree<T>::binary_search_tree(
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+binary_search_tree<T, Balance, Allocator>::binary_search_tree(
     binary_search_tree &&p_outer) noexcept(true)
-    : binary_search_tree()
+    : binary_search_tree(p_outer.get_allocator())
 {
     swap(*this, p_outer);
 }
 
 //
-template <std::totally_ordered T>
-auto binary_search_tree<T>::operator=(binary_search_tree p_rhs) noexcept(
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::operator=(binary_search_tree p_rhs) noexcept(
     std::is_nothrow_copy_constructible<T>::value) -> binary_search_tree &
 {
-    swap(*this, p_rhs);
+    // nodes may only change hands between equal allocators
+    if (alloc_traits::propagate_on_container_swap::value or (get_allocator() == p_rhs.get_allocator()))
+    {
+        swap(*this, p_rhs);
+    }
+    else {
+        binary_search_tree v_copy(p_rhs, get_allocator());
+
+        swap(*this, v_copy);
+    }
 
     return *this;
 }
 
 
 //
-template <std::totally_ordered T>
-auto binary_search_tree<T>::search(T const &p_key) const noexcept(true)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::search(T const &p_key) const noexcept(true)
     -> std::optional<typename binary_search_tree::value_type>
 {
-    if (auto v_current = m_root)
+    if (auto v_found = find(p_key); v_found != end())
     {
-        while (v_current != nullptr && (p_key != v_current->m_data))
-        {
-            if (p_key == v_current->m_data)
-            {
-                return v_current->m_data;
-            }
-            else if (p_key < v_current->m_data) {
-                v_current = v_current->m_left;
-            }
-            else {
-                v_current = v_current->m_right;
-            }
-        }
-
-        return std::nullopt;
+        return *v_found;
     }
 
     return std::nullopt;
@@ -84,136 +99,235 @@ auto binary_search_tree<T>::search(T const &p_key) const noexcept(true)
 
 
 //
-template <std::totally_ordered T>
-void binary_search_tree<T>::remove(T const &p_key) noexcept(std::is_nothrow_destructible<T>::value)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::lower_bound(T const &p_key) const noexcept(true)
+    -> typename binary_search_tree::const_iterator
 {
-    if (auto v_current = m_root)
+    node_type *v_current = m_root, *v_bound = nullptr;
+
+    while (v_current != nullptr)
     {
-        while (v_current != nullptr)
+        if (v_current->m_data < p_key)
         {
-            if (p_key < v_current->m_data)
-            {
-                v_current = v_current->m_left;
-            } 
-            else if (p_key > v_current->m_data) {
-                v_current = v_current->m_right;
-            }
-            else break;
+            v_current = v_current->m_right;
+        }
+        else {
+            v_bound   = v_current;
+            v_current = v_current->m_left;
         }
+    }
+
+    return const_iterator{v_bound, &m_root};
+}
 
-        if (not v_current)
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::upper_bound(T const &p_key) const noexcept(true)
+    -> typename binary_search_tree::const_iterator
+{
+    node_type *v_current = m_root, *v_bound = nullptr;
+
+    while (v_current != nullptr)
+    {
+        if (p_key < v_current->m_data)
         {
-            return;
+            v_bound   = v_current;
+            v_current = v_current->m_left;
+        }
+        else {
+            v_current = v_current->m_right;
         }
+    }
 
-        node_type* v_parent = v_current->m_parent;
+    return const_iterator{v_bound, &m_root};
+}
 
-        if ((not v_current->m_left) && (not v_current->m_right))
-        {
-            if (v_parent->m_left == v_current)
-            {
-                v_parent->m_left = nullptr;
-            }
-            else {
-                v_parent->m_right = nullptr;
-            }
 
-            v_current = (delete v_current, nullptr);
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::equal_range(T const &p_key) const noexcept(true)
+    -> typename binary_search_tree::range_type
+{
+    return range_type{lower_bound(p_key), upper_bound(p_key)};
+}
 
-            m_size = m_size - 1ul;
 
-            return;
-        }
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::range(T const &p_lo, T const &p_hi) const noexcept(true)
+    -> typename binary_search_tree::range_type
+{
+    if (not (p_lo < p_hi))
+    {
+        return range_type{end(), end()};
+    }
 
-        if ((not v_current->m_left) || (not v_current->m_right))
-        {
-            if (v_current->m_left != nullptr)
-            {
-                v_parent->m_left            = v_current->m_left;
-                v_current->m_left->m_parent = v_parent;
-            }
-            else {
-                v_parent->m_right           = v_current->m_right;
-                v_parent->m_right->m_parent = v_parent;
-            }
+    return range_type{lower_bound(p_lo), lower_bound(p_hi)};
+}
 
-            v_current = (delete v_current, nullptr);
 
-            m_size = m_size - 1ul;
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::rank(T const &p_key) const noexcept(true)
+    -> typename binary_search_tree::size_type
+{
+    node_type* v_current = m_root;
+    size_type  v_rank    = 0ul;
 
-            return;
+    while (v_current != nullptr)
+    {
+        if (v_current->m_data < p_key)
+        {
+            // the whole left subtree and this node precede the key
+            v_rank    = v_rank + subtree_size(v_current->m_left) + 1ul;
+            v_current = v_current->m_right;
+        }
+        else {
+            v_current = v_current->m_left;
         }
+    }
 
-        if ((v_current->m_left != nullptr) && (v_current->m_right != nullptr))
-        {
-            node_type* v_temp = v_current->m_right;
+    return v_rank;
+}
 
-            v_parent = nullptr;
 
-            while (v_temp->m_left != nullptr)
-            {
-                v_parent = v_temp;
-                v_temp = v_temp->m_left;
-            }
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::select(size_type p_k) const noexcept(true)
+    -> typename binary_search_tree::const_iterator
+{
+    node_type* v_current = m_root;
 
-            if (v_parent != nullptr)
-            {
-                v_parent->m_left = v_temp->m_right;
-            }
-            else {
-                v_current->m_right = v_temp->m_right;
+    while (v_current != nullptr)
+    {
+        size_type v_left = subtree_size(v_current->m_left);
+
+        if (p_k < v_left)
+        {
+            v_current = v_current->m_left;
+        }
+        else if (p_k > v_left) {
+            p_k       = p_k - v_left - 1ul;
+            v_current = v_current->m_right;
+        }
+        else break;
+    }
+
+    return const_iterator{v_current, &m_root};
+}
 
-                if (v_temp->m_right)
-                {
-                    v_temp->m_right->m_parent = v_current;
-                }
-                else {
-                    v_temp->m_parent = v_current;
-                }
-            }
 
-            v_current->m_data = v_temp->m_data;
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::nth(size_type p_k) const noexcept(true)
+    -> typename binary_search_tree::const_iterator
+{
+    return select(p_k);
+}
 
-            v_temp = (delete v_temp, nullptr);
 
-            m_size = m_size - 1ul;
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::begin() const noexcept(true)
+    -> typename binary_search_tree::const_iterator
+{
+    node_type* v_current = m_root;
 
-            return;
-        }
+    if (v_current != nullptr)
+    {
+        while (v_current->m_left != nullptr)
+            v_current = v_current->m_left;
     }
+
+    return const_iterator{v_current, &m_root};
 }
 
 
 //
-template <std::totally_ordered T>
-void binary_search_tree<T>::clear() noexcept(std::is_nothrow_destructible<T>::value)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::end() const noexcept(true)
+    -> typename binary_search_tree::const_iterator
 {
-    node_type *v_current = m_root, *v_temp = nullptr;
+    return const_iterator{nullptr, &m_root};
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::cbegin() const noexcept(true)
+    -> typename binary_search_tree::const_iterator
+{
+    return begin();
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::cend() const noexcept(true)
+    -> typename binary_search_tree::const_iterator
+{
+    return end();
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::rbegin() const noexcept(true)
+    -> typename binary_search_tree::const_reverse_iterator
+{
+    return const_reverse_iterator{end()};
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::rend() const noexcept(true)
+    -> typename binary_search_tree::const_reverse_iterator
+{
+    return const_reverse_iterator{begin()};
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::remove(T const &p_key) noexcept(std::is_nothrow_destructible<T>::value)
+{
+    node_type* v_current = m_root;
 
     while (v_current != nullptr)
     {
-        if (not v_current->m_left)
+        if (p_key < v_current->m_data)
         {
-            v_temp = v_current->m_right;
-            
-            v_current = (delete v_current, nullptr);
+            v_current = v_current->m_left;
         }
-        else {
-            v_temp            = v_current->m_left;
-            v_current->m_left = v_temp->m_right;
-            v_temp->m_right   = v_current;
+        else if (p_key > v_current->m_data) {
+            v_current = v_current->m_right;
         }
+        else break;
+    }
 
-        v_current = v_temp;
+    if (v_current != nullptr)
+    {
+        erase(v_current);
     }
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::clear() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    destroy(m_alloc, m_root);
 
     m_root = nullptr;
+    m_size = 0ul;
 }
 
 
 //
-template <std::totally_ordered T>
-void binary_search_tree<T>::print_inorder() const noexcept(true)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::print_inorder() const noexcept(true)
 {
     if (not m_root) return;
 
@@ -263,8 +377,8 @@ void binary_search_tree<T>::print_inorder() const noexcept(true)
 
 
 //
-template <std::totally_ordered T>
-void binary_search_tree<T>::print_preorder() const noexcept(true)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::print_preorder() const noexcept(true)
 {
     if (not m_root) return;
 
@@ -313,15 +427,15 @@ void binary_search_tree<T>::print_preorder() const noexcept(true)
 
 
 //
-template <std::totally_ordered T>
-void binary_search_tree<T>::print_postorder() const noexcept(true)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::print_postorder() const noexcept(true)
 {
     if (not m_root) return;
 
-    // Create a dummy node
-    node_type *v_dummy = new(std::nothrow) node_type();
+    // Create a dummy node ( it never outlives the walk, keep it off the heap )
+    node_type v_anchor;
 
-    if ( v_dummy == nullptr ) return;
+    node_type *v_dummy = &v_anchor;
 
     v_dummy->m_left = m_root;
     
@@ -397,8 +511,8 @@ void binary_search_tree<T>::print_postorder() const noexcept(true)
 
 
 //
-template <std::totally_ordered T>
-[[nodiscard]] constexpr auto binary_search_tree<T>::size() const noexcept(true)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+[[nodiscard]] constexpr auto binary_search_tree<T, Balance, Allocator>::size() const noexcept(true)
     -> typename binary_search_tree::size_type
 {
     return m_size;
@@ -406,16 +520,16 @@ template <std::totally_ordered T>
 
 
 //
-template <std::totally_ordered T>
-[[nodiscard]] constexpr auto binary_search_tree<T>::empty() const noexcept(true) -> bool
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+[[nodiscard]] constexpr auto binary_search_tree<T, Balance, Allocator>::empty() const noexcept(true) -> bool
 {
     return (not m_root);
 }
 
 
 //
-template <std::totally_ordered T>
-[[nodiscard]] auto binary_search_tree<T>::max() const noexcept(true)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+[[nodiscard]] auto binary_search_tree<T, Balance, Allocator>::max() const noexcept(true)
     -> std::optional<typename binary_search_tree::value_type>
 {
     if (auto v_current = m_root)
@@ -431,8 +545,8 @@ template <std::totally_ordered T>
 
 
 //
-template <std::totally_ordered T>
-[[nodiscard]] auto binary_search_tree<T>::min() const noexcept(true)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+[[nodiscard]] auto binary_search_tree<T, Balance, Allocator>::min() const noexcept(true)
     -> std::optional<typename binary_search_tree::value_type>
 {
     if (auto v_current = m_root)
@@ -448,23 +562,868 @@ template <std::totally_ordered T>
 
 
 //
-template <std::totally_ordered T>
-binary_search_tree<T>::~binary_search_tree() noexcept(std::is_nothrow_destructible<T>::value)
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::get_allocator() const noexcept(true)
+    -> typename binary_search_tree::allocator_type
 {
-    clear();
+    return allocator_type(m_alloc);
 }
 
 
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::profile() const -> tree_profile
+{
+    tree_profile v_profile {};
+
+    node_type* v_current = m_root;
+    size_type  v_depth   = 0ul;
+
+    // pre-order over the parent links: down to the left first, then
+    // up until a right subtree not yet visited
+    while (v_current != nullptr)
+    {
+        if (v_profile.m_levels.size() == v_depth) v_profile.m_levels.push_back(0ul);
+
+        v_profile.m_levels[v_depth] = v_profile.m_levels[v_depth] + 1ul;
+
+        if (v_current->m_left)
+        {
+            v_current = v_current->m_left;
+            v_depth   = v_depth + 1ul;
+        }
+        else if (v_current->m_right) {
+            v_current = v_current->m_right;
+            v_depth   = v_depth + 1ul;
+        }
+        else {
+            node_type* v_child = v_current;
+
+            v_current = v_current->m_parent;
+            v_depth   = v_depth - 1ul;
+
+            while (v_current != nullptr && (v_current->m_right == v_child || v_current->m_right == nullptr))
+            {
+                v_child   = v_current;
+                v_current = v_current->m_parent;
+                v_depth   = v_depth - 1ul;
+            }
+
+            if (v_current != nullptr)
+            {
+                v_current = v_current->m_right;
+                v_depth   = v_depth + 1ul;
+            }
+        }
+    }
+
+    return v_profile;
+}
+
 
 //
-template class binary_search_tree<int>;
-template class binary_search_tree<char>;
-template class binary_search_tree<long>;
-template class binary_search_tree<short>;
-template class binary_search_tree<unsigned int>;
-template class binary_search_tree<unsigned char>;
-template class binary_search_tree<unsigned long>;
-template class binary_search_tree<unsigned short>;
-template class binary_search_tree<float>;
-template class binary_search_tree<double>;
-  
\ No newline at end of file
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::assemble(node_type*& p_chain, size_type p_count,
+                                                         size_type p_depth, size_type p_red_depth)
+    noexcept(true) -> node_type*
+{
+    if (p_count == 0ul) return nullptr;
+
+    size_type v_left = (p_count - 1ul) / 2ul;
+
+    node_type* v_left_root = assemble(p_chain, v_left, p_depth + 1ul, p_red_depth);
+
+    // the chain head is now the in-order successor of the left subtree
+    node_type* v_root = p_chain;
+
+    p_chain = p_chain->m_right;
+
+    v_root->m_left  = v_left_root;
+    v_root->m_right = assemble(p_chain, p_count - 1ul - v_left, p_depth + 1ul, p_red_depth);
+    v_root->m_red   = std::is_same<Balance, red_black>::value && (p_depth == p_red_depth);
+    v_root->m_count = p_count;
+
+    if (v_root->m_left != nullptr)
+        v_root->m_left->m_parent = v_root;
+
+    if (v_root->m_right != nullptr)
+        v_root->m_right->m_parent = v_root;
+
+    return v_root;
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::attach(node_type* p_node) noexcept(true)
+{
+    node_type *v_current = m_root, *v_parent = nullptr;
+
+    while (v_current != nullptr)
+    {
+        v_parent = v_current;
+
+        // every node on the path gains one descendant
+        v_current->m_count = v_current->m_count + 1ul;
+
+        if (p_node->m_data <= v_current->m_data)
+        {
+            v_current = v_current->m_left;
+        }
+        else {
+            v_current = v_current->m_right;
+        }
+    }
+
+    p_node->m_parent = v_parent;
+
+    if (not v_parent)
+    {
+        m_root = p_node;
+    }
+    else if (p_node->m_data <= v_parent->m_data) {
+        v_parent->m_left = p_node;
+    }
+    else {
+        v_parent->m_right = p_node;
+    }
+
+    m_size = m_size + 1ul;
+
+    if constexpr (std::is_same<Balance, red_black>::value)
+    {
+        p_node->m_red = true;
+
+        insert_fixup(m_root, p_node);
+    }
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::erase(node_type* p_node) noexcept(std::is_nothrow_destructible<T>::value)
+{
+    // colour of the node that actually leaves its position,
+    // and the child (possibly null) that takes that position
+    bool       v_removed_red = p_node->m_red;
+    node_type* v_child       = nullptr;
+    node_type* v_parent      = nullptr;
+
+    if (not p_node->m_left)
+    {
+        v_child  = p_node->m_right;
+        v_parent = p_node->m_parent;
+
+        transplant(m_root, p_node, p_node->m_right);
+    }
+    else if (not p_node->m_right) {
+        v_child  = p_node->m_left;
+        v_parent = p_node->m_parent;
+
+        transplant(m_root, p_node, p_node->m_left);
+    }
+    else {
+        // in-order successor takes the place of the removed node
+        node_type* v_next = p_node->m_right;
+
+        while (v_next->m_left != nullptr)
+            v_next = v_next->m_left;
+
+        v_removed_red = v_next->m_red;
+        v_child       = v_next->m_right;
+
+        if (v_next->m_parent == p_node)
+        {
+            v_parent = v_next;
+        }
+        else {
+            v_parent = v_next->m_parent;
+
+            transplant(m_root, v_next, v_next->m_right);
+
+            v_next->m_right           = p_node->m_right;
+            v_next->m_right->m_parent = v_next;
+        }
+
+        transplant(m_root, p_node, v_next);
+
+        v_next->m_left           = p_node->m_left;
+        v_next->m_left->m_parent = v_next;
+        v_next->m_red            = p_node->m_red;
+        v_next->m_count          = p_node->m_count;
+    }
+
+    // every node from the vacated position up to the root lost one
+    // descendant; fix the sizes before any rotation reads them
+    for (node_type* v_up = v_parent; v_up != nullptr; v_up = v_up->m_parent)
+    {
+        v_up->m_count = v_up->m_count - 1ul;
+    }
+
+    p_node = (deallocate_node(m_alloc, p_node), nullptr);
+
+    m_size = m_size - 1ul;
+
+    if constexpr (std::is_same<Balance, red_black>::value)
+    {
+        if (not v_removed_red)
+        {
+            erase_fixup(m_root, v_child, v_parent);
+        }
+    }
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::transplant(node_type*& p_root, node_type* p_node,
+                                                           node_type* p_with) noexcept(true)
+{
+    if (not p_node->m_parent)
+    {
+        p_root = p_with;
+    }
+    else if (p_node == p_node->m_parent->m_left) {
+        p_node->m_parent->m_left = p_with;
+    }
+    else {
+        p_node->m_parent->m_right = p_with;
+    }
+
+    if (p_with != nullptr)
+    {
+        p_with->m_parent = p_node->m_parent;
+    }
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::rotate_left(node_type*& p_root, node_type* p_node) noexcept(true)
+{
+    node_type* v_pivot = p_node->m_right;
+
+    p_node->m_right = v_pivot->m_left;
+
+    if (v_pivot->m_left != nullptr)
+    {
+        v_pivot->m_left->m_parent = p_node;
+    }
+
+    transplant(p_root, p_node, v_pivot);
+
+    v_pivot->m_left  = p_node;
+    p_node->m_parent = v_pivot;
+
+    v_pivot->m_count = p_node->m_count;
+    resize(p_node);
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::rotate_right(node_type*& p_root, node_type* p_node) noexcept(true)
+{
+    node_type* v_pivot = p_node->m_left;
+
+    p_node->m_left = v_pivot->m_right;
+
+    if (v_pivot->m_right != nullptr)
+    {
+        v_pivot->m_right->m_parent = p_node;
+    }
+
+    transplant(p_root, p_node, v_pivot);
+
+    v_pivot->m_right = p_node;
+    p_node->m_parent = v_pivot;
+
+    v_pivot->m_count = p_node->m_count;
+    resize(p_node);
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::insert_fixup(node_type*& p_root, node_type* p_node) noexcept(true)
+{
+    // p_node is red; walk up while its parent is red too
+    while (is_red(p_node->m_parent))
+    {
+        node_type* v_parent = p_node->m_parent;
+        node_type* v_grand  = v_parent->m_parent;
+
+        if (v_parent == v_grand->m_left)
+        {
+            node_type* v_uncle = v_grand->m_right;
+
+            if (is_red(v_uncle))
+            {
+                v_parent->m_red = false;
+                v_uncle->m_red  = false;
+                v_grand->m_red  = true;
+
+                p_node = v_grand;
+            }
+            else {
+                if (p_node == v_parent->m_right)
+                {
+                    p_node = v_parent;
+                    rotate_left(p_root, p_node);
+                    v_parent = p_node->m_parent;
+                }
+
+                v_parent->m_red = false;
+                v_grand->m_red  = true;
+
+                rotate_right(p_root, v_grand);
+            }
+        }
+        else {
+            node_type* v_uncle = v_grand->m_left;
+
+            if (is_red(v_uncle))
+            {
+                v_parent->m_red = false;
+                v_uncle->m_red  = false;
+                v_grand->m_red  = true;
+
+                p_node = v_grand;
+            }
+            else {
+                if (p_node == v_parent->m_left)
+                {
+                    p_node = v_parent;
+                    rotate_right(p_root, p_node);
+                    v_parent = p_node->m_parent;
+                }
+
+                v_parent->m_red = false;
+                v_grand->m_red  = true;
+
+                rotate_left(p_root, v_grand);
+            }
+        }
+    }
+
+    p_root->m_red = false;
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::erase_fixup(node_type*& p_root, node_type* p_node,
+                                                            node_type* p_parent) noexcept(true)
+{
+    // p_node carries an extra black; it may be null, hence the explicit parent
+    while ((p_node != p_root) && (not is_red(p_node)))
+    {
+        if (p_node == p_parent->m_left)
+        {
+            node_type* v_sibling = p_parent->m_right;
+
+            if (is_red(v_sibling))
+            {
+                v_sibling->m_red = false;
+                p_parent->m_red  = true;
+
+                rotate_left(p_root, p_parent);
+                v_sibling = p_parent->m_right;
+            }
+
+            if ((not is_red(v_sibling->m_left)) && (not is_red(v_sibling->m_right)))
+            {
+                v_sibling->m_red = true;
+
+                p_node   = p_parent;
+                p_parent = p_node->m_parent;
+            }
+            else {
+                if (not is_red(v_sibling->m_right))
+                {
+                    v_sibling->m_left->m_red = false;
+                    v_sibling->m_red         = true;
+
+                    rotate_right(p_root, v_sibling);
+                    v_sibling = p_parent->m_right;
+                }
+
+                v_sibling->m_red          = p_parent->m_red;
+                p_parent->m_red           = false;
+                v_sibling->m_right->m_red = false;
+
+                rotate_left(p_root, p_parent);
+
+                p_node = p_root;
+            }
+        }
+        else {
+            node_type* v_sibling = p_parent->m_left;
+
+            if (is_red(v_sibling))
+            {
+                v_sibling->m_red = false;
+                p_parent->m_red  = true;
+
+                rotate_right(p_root, p_parent);
+                v_sibling = p_parent->m_left;
+            }
+
+            if ((not is_red(v_sibling->m_left)) && (not is_red(v_sibling->m_right)))
+            {
+                v_sibling->m_red = true;
+
+                p_node   = p_parent;
+                p_parent = p_node->m_parent;
+            }
+            else {
+                if (not is_red(v_sibling->m_left))
+                {
+                    v_sibling->m_right->m_red = false;
+                    v_sibling->m_red          = true;
+
+                    rotate_left(p_root, v_sibling);
+                    v_sibling = p_parent->m_left;
+                }
+
+                v_sibling->m_red         = p_parent->m_red;
+                p_parent->m_red          = false;
+                v_sibling->m_left->m_red = false;
+
+                rotate_right(p_root, p_parent);
+
+                p_node = p_root;
+            }
+        }
+    }
+
+    if (p_node != nullptr)
+    {
+        p_node->m_red = false;
+    }
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::split(T const& p_key) noexcept(true)
+    -> std::pair<binary_search_tree, binary_search_tree>
+    requires(std::same_as<Balance, red_black>)
+{
+    auto [v_less, v_rest] = split_by(release(), [&p_key](T const& p_data) { return p_data < p_key; });
+
+    return {adopt(v_less, m_alloc), adopt(v_rest, m_alloc)};
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::join(binary_search_tree p_left, T p_key, binary_search_tree p_right)
+    noexcept(std::is_nothrow_move_constructible<T>::value) -> binary_search_tree
+    requires(std::same_as<Balance, red_black>)
+{
+    node_type* v_node  = allocate_node<node_type>(p_left.m_alloc, std::move(p_key));
+    node_type* v_right = p_left.transfer(p_right);
+    node_type* v_left  = p_left.release();
+
+    return adopt((v_node != nullptr) ? concat(v_left, v_node, v_right) : concat(v_left, v_right),
+                 p_left.m_alloc);
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::detach(node_type* p_node) noexcept(true) -> node_type*
+{
+    if (p_node != nullptr)
+    {
+        p_node->m_parent = nullptr;
+        p_node->m_red    = false;
+    }
+
+    return p_node;
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::black_height(node_type const* p_root) noexcept(true) -> size_type
+{
+    size_type v_height = 0ul;
+
+    for (; p_root != nullptr; p_root = p_root->m_left)
+    {
+        if (not p_root->m_red) v_height = v_height + 1ul;
+    }
+
+    return v_height;
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::concat(node_type* p_left, node_type* p_node, node_type* p_right)
+    noexcept(true) -> node_type*
+    requires(std::same_as<Balance, red_black>)
+{
+    auto v_link = [](node_type* p_parent, node_type* p_lhs, node_type* p_rhs)
+    {
+        p_parent->m_left  = p_lhs;
+        p_parent->m_right = p_rhs;
+
+        if (p_lhs != nullptr) p_lhs->m_parent = p_parent;
+        if (p_rhs != nullptr) p_rhs->m_parent = p_parent;
+
+        resize(p_parent);
+    };
+
+    p_node->m_parent = nullptr;
+    p_node->m_red    = false;
+
+    size_type v_left_height  = black_height(p_left);
+    size_type v_right_height = black_height(p_right);
+
+    if (v_left_height > v_right_height)
+    {
+        // go down the right spine of the taller side to the first black
+        // node as high ( in black nodes ) as the other side; the joining
+        // node takes its place, red, so black heights are unchanged
+        size_type  v_height = v_left_height;
+        size_type  v_gain   = subtree_size(p_right) + 1ul;
+        node_type *v_current = p_left, *v_parent = nullptr;
+
+        while (is_red(v_current) || (v_height != v_right_height))
+        {
+            if (not is_red(v_current)) v_height = v_height - 1ul;
+
+            v_current->m_count = v_current->m_count + v_gain;
+
+            v_parent  = v_current;
+            v_current = v_current->m_right;
+        }
+
+        v_link(p_node, v_current, p_right);
+
+        p_node->m_red     = true;
+        p_node->m_parent  = v_parent;
+        v_parent->m_right = p_node;
+
+        insert_fixup(p_left, p_node);
+
+        return p_left;
+    }
+
+    if (v_left_height < v_right_height)
+    {
+        size_type  v_height = v_right_height;
+        size_type  v_gain   = subtree_size(p_left) + 1ul;
+        node_type *v_current = p_right, *v_parent = nullptr;
+
+        while (is_red(v_current) || (v_height != v_left_height))
+        {
+            if (not is_red(v_current)) v_height = v_height - 1ul;
+
+            v_current->m_count = v_current->m_count + v_gain;
+
+            v_parent  = v_current;
+            v_current = v_current->m_left;
+        }
+
+        v_link(p_node, p_left, v_current);
+
+        p_node->m_red    = true;
+        p_node->m_parent = v_parent;
+        v_parent->m_left = p_node;
+
+        insert_fixup(p_right, p_node);
+
+        return p_right;
+    }
+
+    // equal black heights: node becomes the root
+    v_link(p_node, p_left, p_right);
+
+    return p_node;
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::concat(node_type* p_left, node_type* p_right) noexcept(true) -> node_type*
+    requires(std::same_as<Balance, red_black>)
+{
+    if (not p_left)  return p_right;
+    if (not p_right) return p_left;
+
+    auto [v_rest, v_last] = split_last(p_left);
+
+    return concat(v_rest, v_last, p_right);
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::split_last(node_type* p_root) noexcept(true)
+    -> std::pair<node_type*, node_type*>
+    requires(std::same_as<Balance, red_black>)
+{
+    node_type* v_left  = detach(p_root->m_left);
+    node_type* v_right = detach(p_root->m_right);
+
+    if (not v_right) return {v_left, p_root};
+
+    auto [v_rest, v_last] = split_last(v_right);
+
+    return {concat(v_left, p_root, v_rest), v_last};
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::split3(node_type* p_root, T const& p_key) noexcept(true)
+    -> std::tuple<node_type*, node_type*, node_type*>
+    requires(std::same_as<Balance, red_black>)
+{
+    auto [v_less, v_rest] =
+        split_by(p_root, [&p_key](T const& p_data) { return p_data < p_key; });
+
+    auto [v_equal, v_greater] =
+        split_by(v_rest, [&p_key](T const& p_data) { return not (p_key < p_data); });
+
+    return {v_less, v_equal, v_greater};
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+void binary_search_tree<T, Balance, Allocator>::destroy(node_allocator_type& p_alloc, node_type* p_root)
+    noexcept(std::is_nothrow_destructible<T>::value)
+{
+    node_type *v_current = p_root, *v_temp = nullptr;
+
+    while (v_current != nullptr)
+    {
+        if (not v_current->m_left)
+        {
+            v_temp = v_current->m_right;
+            
+            v_current = (deallocate_node(p_alloc, v_current), nullptr);
+        }
+        else {
+            v_temp            = v_current->m_left;
+            v_current->m_left = v_temp->m_right;
+            v_temp->m_right   = v_current;
+        }
+
+        v_current = v_temp;
+    }
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::release() noexcept(true) -> node_type*
+{
+    node_type* v_root = m_root;
+
+    m_root = nullptr;
+    m_size = 0ul;
+
+    return v_root;
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::transfer(binary_search_tree& p_other)
+    noexcept(std::is_nothrow_copy_constructible<T>::value) -> node_type*
+{
+    if (m_alloc == p_other.m_alloc) return p_other.release();
+
+    // the copy is ours; the other tree frees its own nodes
+    return clone(p_other.m_root);
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::adopt(node_type* p_root, node_allocator_type const& p_alloc)
+    noexcept(true) -> binary_search_tree
+{
+    binary_search_tree v_tree {allocator_type(p_alloc)};
+
+    v_tree.m_root = p_root;
+    v_tree.m_size = subtree_size(p_root);
+
+    return v_tree;
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::unite(node_allocator_type& p_alloc, node_type* p_lhs,
+                                                      node_type* p_rhs, size_type p_depth)
+    noexcept(std::is_nothrow_destructible<T>::value) -> node_type*
+    requires(std::same_as<Balance, red_black>)
+{
+    if (not p_lhs) return p_rhs;
+    if (not p_rhs) return p_lhs;
+
+    // expose the root of one side and split the other around its key
+    node_type* v_left  = detach(p_rhs->m_left);
+    node_type* v_right = detach(p_rhs->m_right);
+
+    auto [v_less, v_equal, v_greater] = split3(p_lhs, p_rhs->m_data);
+
+    destroy(p_alloc, v_equal);
+
+    auto [v_low, v_high] = fork(
+        p_depth,
+        subtree_size(v_less) + subtree_size(v_left),
+        subtree_size(v_greater) + subtree_size(v_right),
+        [&] { return unite(p_alloc, v_less, v_left, p_depth + 1ul); },
+        [&] { return unite(p_alloc, v_greater, v_right, p_depth + 1ul); });
+
+    return concat(v_low, p_rhs, v_high);
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::intersect(node_allocator_type& p_alloc, node_type* p_lhs,
+                                                      node_type* p_rhs, size_type p_depth)
+    noexcept(std::is_nothrow_destructible<T>::value) -> node_type*
+    requires(std::same_as<Balance, red_black>)
+{
+    if ((not p_lhs) || (not p_rhs))
+    {
+        destroy(p_alloc, p_lhs);
+        destroy(p_alloc, p_rhs);
+
+        return nullptr;
+    }
+
+    node_type* v_left  = detach(p_rhs->m_left);
+    node_type* v_right = detach(p_rhs->m_right);
+
+    auto [v_less, v_equal, v_greater] = split3(p_lhs, p_rhs->m_data);
+
+    bool v_found = (v_equal != nullptr);
+
+    destroy(p_alloc, v_equal);
+
+    auto [v_low, v_high] = fork(
+        p_depth,
+        subtree_size(v_less) + subtree_size(v_left),
+        subtree_size(v_greater) + subtree_size(v_right),
+        [&] { return intersect(p_alloc, v_less, v_left, p_depth + 1ul); },
+        [&] { return intersect(p_alloc, v_greater, v_right, p_depth + 1ul); });
+
+    if (v_found) return concat(v_low, p_rhs, v_high);
+
+    p_rhs = (deallocate_node(p_alloc, p_rhs), nullptr);
+
+    return concat(v_low, v_high);
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+auto binary_search_tree<T, Balance, Allocator>::subtract(node_allocator_type& p_alloc, node_type* p_lhs,
+                                                      node_type* p_rhs, size_type p_depth)
+    noexcept(std::is_nothrow_destructible<T>::value) -> node_type*
+    requires(std::same_as<Balance, red_black>)
+{
+    if (not p_lhs)
+    {
+        destroy(p_alloc, p_rhs);
+
+        return nullptr;
+    }
+
+    if (not p_rhs) return p_lhs;
+
+    node_type* v_left  = detach(p_rhs->m_left);
+    node_type* v_right = detach(p_rhs->m_right);
+
+    auto [v_less, v_equal, v_greater] = split3(p_lhs, p_rhs->m_data);
+
+    destroy(p_alloc, v_equal);
+
+    p_rhs = (deallocate_node(p_alloc, p_rhs), nullptr);
+
+    auto [v_low, v_high] = fork(
+        p_depth,
+        subtree_size(v_less) + subtree_size(v_left),
+        subtree_size(v_greater) + subtree_size(v_right),
+        [&] { return subtract(p_alloc, v_less, v_left, p_depth + 1ul); },
+        [&] { return subtract(p_alloc, v_greater, v_right, p_depth + 1ul); });
+
+    return concat(v_low, v_high);
+}
+
+
+//
+template <std::totally_ordered T, balance_policy Balance, class Allocator>
+binary_search_tree<T, Balance, Allocator>::~binary_search_tree() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    clear();
+}
+
+
+
+//
+template class binary_search_tree<int>;
+template class binary_search_tree<char>;
+template class binary_search_tree<long>;
+template class binary_search_tree<short>;
+template class binary_search_tree<unsigned int>;
+template class binary_search_tree<unsigned char>;
+template class binary_search_tree<unsigned long>;
+template class binary_search_tree<unsigned short>;
+template class binary_search_tree<float>;
+template class binary_search_tree<double>;
+template class binary_search_tree<std::string>;
+
+//
+template class binary_search_tree<int, red_black>;
+template class binary_search_tree<char, red_black>;
+template class binary_search_tree<long, red_black>;
+template class binary_search_tree<short, red_black>;
+template class binary_search_tree<unsigned int, red_black>;
+template class binary_search_tree<unsigned char, red_black>;
+template class binary_search_tree<unsigned long, red_black>;
+template class binary_search_tree<unsigned short, red_black>;
+template class binary_search_tree<float, red_black>;
+template class binary_search_tree<double, red_black>;
+template class binary_search_tree<std::string, red_black>;
+
+//
+template class binary_search_tree<int, unbalanced, std::pmr::polymorphic_allocator<int>>;
+template class binary_search_tree<char, unbalanced, std::pmr::polymorphic_allocator<char>>;
+template class binary_search_tree<long, unbalanced, std::pmr::polymorphic_allocator<long>>;
+template class binary_search_tree<short, unbalanced, std::pmr::polymorphic_allocator<short>>;
+template class binary_search_tree<unsigned int, unbalanced, std::pmr::polymorphic_allocator<unsigned int>>;
+template class binary_search_tree<unsigned char, unbalanced, std::pmr::polymorphic_allocator<unsigned char>>;
+template class binary_search_tree<unsigned long, unbalanced, std::pmr::polymorphic_allocator<unsigned long>>;
+template class binary_search_tree<unsigned short, unbalanced, std::pmr::polymorphic_allocator<unsigned short>>;
+template class binary_search_tree<float, unbalanced, std::pmr::polymorphic_allocator<float>>;
+template class binary_search_tree<double, unbalanced, std::pmr::polymorphic_allocator<double>>;
+
+//
+template class binary_search_tree<int, red_black, std::pmr::polymorphic_allocator<int>>;
+template class binary_search_tree<char, red_black, std::pmr::polymorphic_allocator<char>>;
+template class binary_search_tree<long, red_black, std::pmr::polymorphic_allocator<long>>;
+template class binary_search_tree<short, red_black, std::pmr::polymorphic_allocator<short>>;
+template class binary_search_tree<unsigned int, red_black, std::pmr::polymorphic_allocator<unsigned int>>;
+template class binary_search_tree<unsigned char, red_black, std::pmr::polymorphic_allocator<unsigned char>>;
+template class binary_search_tree<unsigned long, red_black, std::pmr::polymorphic_allocator<unsigned long>>;
+template class binary_search_tree<unsigned short, red_black, std::pmr::polymorphic_allocator<unsigned short>>;
+template class binary_search_tree<float, red_black, std::pmr::polymorphic_allocator<float>>;
+template class binary_search_tree<double, red_black, std::pmr::polymorphic_allocator<double>>;
+
+
+/** ITERATION MODELS THE STANDARD RANGE CONCEPTS **/
+static_assert(std::bidirectional_iterator<InOrder<int>>);
+static_assert(std::ranges::bidirectional_range<binary_search_tree<int>>);
+static_assert(std::ranges::bidirectional_range<binary_search_tree<int, red_black>>);
@@ -0,0 +1,278 @@
+#include <ds/chunked_stack.hxx>
+
+#include <vector>
+
+// start chunked_stack
+//
+//
+template <class T, class Allocator>
+chunked_stack<T, Allocator>::chunked_stack() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+    : chunked_stack(Allocator())
+{}
+
+
+//
+template <class T, class Allocator>
+chunked_stack<T, Allocator>::chunked_stack(Allocator const &p_alloc) noexcept(true)
+    : m_alloc(p_alloc)
+{}
+
+
+//
+template <class T, class Allocator>
+chunked_stack<T, Allocator>::chunked_stack(chunked_stack const &p_outer)
+    noexcept(std::is_nothrow_copy_constructible<T>::value &&
+             std::is_nothrow_default_constructible<Allocator>::value)
+    : chunked_stack(p_outer, alloc_traits::select_on_container_copy_construction(p_outer.get_allocator()))
+{}
+
+
+//
+template <class T, class Allocator>
+chunked_stack<T, Allocator>::chunked_stack(chunked_stack const &p_outer, Allocator const &p_alloc)
+    noexcept(std::is_nothrow_copy_constructible<T>::value) : chunked_stack(p_alloc)
+{
+    // blocks only link downwards, replay them bottom first
+    std::vector<block_type const*> v_blocks;
+
+    for (block_type const* v_block = p_outer.m_top; v_block; v_block = v_block->m_prev)
+    {
+        v_blocks.push_back(v_block);
+    }
+
+    for (auto v_iter = v_blocks.rbegin(); v_iter != v_blocks.rend(); ++v_iter)
+    {
+        const size_type v_used = (*v_iter == p_outer.m_top) ? p_outer.m_used : block_capacity;
+
+        for (size_type i = 0ul; i < v_used; ++i)
+        {
+            push_front(*(*v_iter)->at(i));
+        }
+    }
+}
+
+
+//
+template <class T, class Allocator>
+chunked_stack<T, Allocator>::chunked_stack(chunked_stack &&p_outer) noexcept(true)
+    : chunked_stack(p_outer.get_allocator())
+{
+    swap(*this, p_outer);
+}
+
+
+//
+template <class T, class Allocator>
+auto chunked_stack<T, Allocator>::operator=(chunked_stack p_rhs)
+    noexcept(std::is_nothrow_copy_constructible<T>::value) -> chunked_stack &
+{
+    // blocks may only change hands between equal allocators
+    if (alloc_traits::propagate_on_container_swap::value or (get_allocator() == p_rhs.get_allocator()))
+    {
+        swap(*this, p_rhs);
+    }
+    else {
+        chunked_stack v_copy(p_rhs, get_allocator());
+
+        swap(*this, v_copy);
+    }
+
+    return *this;
+}
+
+
+//
+template <class T, class Allocator>
+void chunked_stack<T, Allocator>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    assert(not empty());
+
+    Allocator v_alloc(m_alloc);
+
+    m_used = m_used - 1ul;
+    alloc_traits::destroy(v_alloc, m_top->at(m_used));
+
+    m_size = m_size - 1ul;
+
+    if (m_used == 0ul) drop_top();
+}
+
+
+//
+template <class T, class Allocator>
+void chunked_stack<T, Allocator>::pop() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    pop_front();
+}
+
+
+//
+template <class T, class Allocator>
+auto chunked_stack<T, Allocator>::try_pop() noexcept(std::is_nothrow_move_constructible<T>::value)
+    -> std::optional<typename chunked_stack::value_type>
+{
+    if (empty()) return std::nullopt;
+
+    // one move out, the moved-from husk goes with the pop
+    std::optional<value_type> v_value {std::move(*m_top->at(m_used - 1ul))};
+
+    pop_front();
+
+    return v_value;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto chunked_stack<T, Allocator>::empty() const noexcept(true) -> bool
+{
+    return (m_size == 0ul);
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto chunked_stack<T, Allocator>::size() const noexcept(true)
+    -> typename chunked_stack::size_type
+{
+    return m_size;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto chunked_stack<T, Allocator>::peep() const noexcept(true)
+    -> std::optional<typename chunked_stack::value_type>
+{
+    return (not empty() ? std::optional{*m_top->at(m_used - 1ul)}
+                        : std::nullopt);
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto chunked_stack<T, Allocator>::peep() noexcept(true)
+    -> std::optional<typename chunked_stack::value_type>
+{
+    return (not empty() ? std::optional{*m_top->at(m_used - 1ul)}
+                        : std::nullopt);
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto chunked_stack<T, Allocator>::peep_ptr() const noexcept(true)
+    -> typename chunked_stack::const_pointer
+{
+    return not empty()  ? m_top->at(m_used - 1ul)
+                        : nullptr;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto chunked_stack<T, Allocator>::peep_ptr() noexcept(true)
+    -> typename chunked_stack::pointer
+{
+    return not empty()  ? m_top->at(m_used - 1ul)
+                        : nullptr;
+}
+
+
+//
+template <class T, class Allocator>
+auto chunked_stack<T, Allocator>::get_allocator() const noexcept(true)
+    -> typename chunked_stack::allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
+
+//
+template <class T, class Allocator>
+void chunked_stack<T, Allocator>::shrink_to_fit() noexcept(true)
+{
+    if (m_spare) m_spare = (deallocate_node(m_alloc, m_spare), nullptr);
+}
+
+
+//
+template <class T, class Allocator>
+auto chunked_stack<T, Allocator>::make_room() noexcept(true) -> T*
+{
+    if (m_top and (m_used < block_capacity)) return m_top->slot(m_used);
+
+    block_type* v_block = m_spare ? std::exchange(m_spare, nullptr)
+                                  : allocate_node<block_type>(m_alloc);
+
+    if (v_block == nullptr) return nullptr;
+
+    v_block->m_prev = m_top;
+
+    m_top  = v_block;
+    m_used = 0ul;
+
+    return m_top->slot(0ul);
+}
+
+
+//
+template <class T, class Allocator>
+void chunked_stack<T, Allocator>::drop_top() noexcept(true)
+{
+    block_type* v_block = m_top;
+
+    m_top  = m_top->m_prev;
+    m_used = m_top ? block_capacity : 0ul;
+
+    // one spare is enough to absorb push / pop at a block boundary
+    if (m_spare) m_spare = (deallocate_node(m_alloc, m_spare), nullptr);
+
+    m_spare = v_block;
+}
+
+
+//
+template <class T, class Allocator>
+chunked_stack<T, Allocator>::~chunked_stack() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    while (not empty())
+    {
+        pop_front();
+    }
+
+    shrink_to_fit();
+}
+//
+//
+// end chunked_stack
+
+
+
+//
+//
+template class chunked_stack<int>;
+template class chunked_stack<char>;
+template class chunked_stack<long>;
+template class chunked_stack<short>;
+template class chunked_stack<unsigned int>;
+template class chunked_stack<unsigned char>;
+template class chunked_stack<unsigned long>;
+template class chunked_stack<unsigned short>;
+template class chunked_stack<float>;
+template class chunked_stack<double>;
+template class chunked_stack<std::string>;
+
+//
+template class chunked_stack<int, std::pmr::polymorphic_allocator<int>>;
+template class chunked_stack<char, std::pmr::polymorphic_allocator<char>>;
+template class chunked_stack<long, std::pmr::polymorphic_allocator<long>>;
+template class chunked_stack<short, std::pmr::polymorphic_allocator<short>>;
+template class chunked_stack<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class chunked_stack<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class chunked_stack<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class chunked_stack<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class chunked_stack<float, std::pmr::polymorphic_allocator<float>>;
+template class chunked_stack<double, std::pmr::polymorphic_allocator<double>>;
+//
+//
@@ -0,0 +1,213 @@
+
+#include <ds/concurrent_stack.hxx>
+
+
+// start concurrent_stack
+//
+template <concurrent_stack_value T, class Allocator>
+concurrent_stack<T, Allocator>::concurrent_stack() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+    : concurrent_stack(Allocator())
+{}
+
+
+//
+template <concurrent_stack_value T, class Allocator>
+concurrent_stack<T, Allocator>::concurrent_stack(Allocator const& p_alloc) noexcept(true)
+    : m_alloc( p_alloc )
+{}
+
+
+//
+template <concurrent_stack_value T, class Allocator>
+auto concurrent_stack<T, Allocator>::try_pop() noexcept(true) -> std::optional<typename concurrent_stack::value_type>
+{
+    node_type* v_node = unlink(m_head);
+
+    if (v_node == nullptr) return std::nullopt;
+
+    Allocator v_alloc(m_alloc);
+
+    T* v_elem = v_node->data();
+
+    std::optional<value_type> v_value {std::move(*v_elem)};
+
+    alloc_traits::destroy(v_alloc, v_elem);
+
+    link(m_free, v_node, v_node);
+
+    return v_value;
+}
+
+
+//
+template <concurrent_stack_value T, class Allocator>
+[[nodiscard]] auto concurrent_stack<T, Allocator>::empty() const noexcept(true) -> bool
+{
+    return (m_head.load(std::memory_order_relaxed).m_ptr == nullptr);
+}
+
+
+//
+template <concurrent_stack_value T, class Allocator>
+auto concurrent_stack<T, Allocator>::get_allocator() const noexcept(true)
+    -> typename concurrent_stack::allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
+
+//
+template <concurrent_stack_value T, class Allocator>
+void concurrent_stack<T, Allocator>::reserve(size_type p_count) noexcept(true)
+{
+    node_type* v_first = nullptr;
+    node_type* v_last  = nullptr;
+
+    // chain them privately, publish with a single CAS
+    for (size_type i = 0ul; i < p_count; ++i)
+    {
+        node_type* v_node = allocate_node<node_type>(m_alloc);
+
+        if (v_node == nullptr) break;
+
+        v_node->m_next.store(v_first, std::memory_order_relaxed);
+
+        if (v_last == nullptr) v_last = v_node;
+
+        v_first = v_node;
+    }
+
+    if (v_first) link(m_free, v_first, v_last);
+}
+
+
+//
+template <concurrent_stack_value T, class Allocator>
+void concurrent_stack<T, Allocator>::shrink_to_fit() noexcept(true)
+{
+    node_type* v_node = unlink_all(m_free);
+
+    while (v_node)
+    {
+        node_type* v_next = v_node->m_next.load(std::memory_order_relaxed);
+
+        deallocate_node(m_alloc, v_node);
+
+        v_node = v_next;
+    }
+}
+
+
+//
+template <concurrent_stack_value T, class Allocator>
+auto concurrent_stack<T, Allocator>::acquire_node() noexcept(true) -> node_type*
+{
+    if (node_type* v_node = unlink(m_free)) return v_node;
+
+    return allocate_node<node_type>(m_alloc);
+}
+
+
+//
+template <concurrent_stack_value T, class Allocator>
+void concurrent_stack<T, Allocator>::link(std::atomic<tagged_ptr>& p_top, node_type* p_first, node_type* p_last) noexcept(true)
+{
+    tagged_ptr v_top = p_top.load(std::memory_order_relaxed);
+
+    do {
+        p_last->m_next.store(v_top.m_ptr, std::memory_order_relaxed);
+    }
+    while (not p_top.compare_exchange_weak(v_top, tagged_ptr {p_first, v_top.m_tag + 1u},
+                                           std::memory_order_release, std::memory_order_relaxed));
+}
+
+
+//
+template <concurrent_stack_value T, class Allocator>
+auto concurrent_stack<T, Allocator>::unlink(std::atomic<tagged_ptr>& p_top) noexcept(true) -> node_type*
+{
+    tagged_ptr v_top = p_top.load(std::memory_order_acquire);
+
+    while (v_top.m_ptr)
+    {
+        // may be stale if the node was taken meanwhile, the tag then fails the CAS
+        node_type* v_next = v_top.m_ptr->m_next.load(std::memory_order_relaxed);
+
+        if (p_top.compare_exchange_weak(v_top, tagged_ptr {v_next, v_top.m_tag + 1u},
+                                        std::memory_order_acquire, std::memory_order_acquire))
+        {
+            return v_top.m_ptr;
+        }
+    }
+
+    return nullptr;
+}
+
+
+//
+template <concurrent_stack_value T, class Allocator>
+auto concurrent_stack<T, Allocator>::unlink_all(std::atomic<tagged_ptr>& p_top) noexcept(true) -> node_type*
+{
+    tagged_ptr v_top = p_top.load(std::memory_order_relaxed);
+
+    while (v_top.m_ptr)
+    {
+        if (p_top.compare_exchange_weak(v_top, tagged_ptr {nullptr, v_top.m_tag + 1u},
+                                        std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+
+    return v_top.m_ptr;
+}
+
+
+//
+template <concurrent_stack_value T, class Allocator>
+concurrent_stack<T, Allocator>::~concurrent_stack() noexcept(true)
+{
+    Allocator v_alloc(m_alloc);
+
+    node_type* v_node = m_head.load(std::memory_order_acquire).m_ptr;
+
+    while (v_node)
+    {
+        node_type* v_next = v_node->m_next.load(std::memory_order_relaxed);
+
+        alloc_traits::destroy(v_alloc, v_node->data());
+        deallocate_node(m_alloc, v_node);
+
+        v_node = v_next;
+    }
+
+    shrink_to_fit();
+}
+//
+
+//
+template class concurrent_stack<int>;
+template class concurrent_stack<char>;
+template class concurrent_stack<long>;
+template class concurrent_stack<short>;
+template class concurrent_stack<unsigned int>;
+template class concurrent_stack<unsigned char>;
+template class concurrent_stack<unsigned long>;
+template class concurrent_stack<unsigned short>;
+template class concurrent_stack<float>;
+template class concurrent_stack<double>;
+template class concurrent_stack<std::string>;
+
+//
+template class concurrent_stack<int, std::pmr::polymorphic_allocator<int>>;
+template class concurrent_stack<char, std::pmr::polymorphic_allocator<char>>;
+template class concurrent_stack<long, std::pmr::polymorphic_allocator<long>>;
+template class concurrent_stack<short, std::pmr::polymorphic_allocator<short>>;
+template class concurrent_stack<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class concurrent_stack<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class concurrent_stack<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class concurrent_stack<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class concurrent_stack<float, std::pmr::polymorphic_allocator<float>>;
+template class concurrent_stack<double, std::pmr::polymorphic_allocator<double>>;
+//
+//
@@ -0,0 +1,184 @@
+//  --------------------------------------------
+//  --------------------------------------------
+        #include <ds/container_stats.hxx>
+//  --------------------------------------------
+//  --------------------------------------------
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+
+// start container_stats
+
+
+namespace
+{
+    struct listing
+    {
+        std::type_info const* m_type;
+        stats_counters*       m_counters;
+    };
+
+    /** built on first use, so a slot listed from any translation unit finds it ready **/
+    auto registry() -> std::vector<listing>&
+    {
+        static std::vector<listing> s_listings;
+
+        return s_listings;
+    }
+
+    auto registry_mutex() -> std::mutex&
+    {
+        static std::mutex s_mutex;
+
+        return s_mutex;
+    }
+
+    auto readable_name(std::type_info const& p_type) -> std::string
+    {
+#if defined(__GNUG__)
+        int v_status = 0;
+
+        std::unique_ptr<char, void (*)(void*)> v_name {
+            abi::__cxa_demangle(p_type.name(), nullptr, nullptr, &v_status), std::free};
+
+        if (v_status == 0 && v_name) return v_name.get();
+#endif
+        return p_type.name();
+    }
+
+    void write_string(std::ostream& p_out, std::string const& p_text)
+    {
+        p_out << '"';
+
+        for (char v_char : p_text)
+        {
+            if (v_char == '"' || v_char == '\\') p_out << '\\';
+
+            p_out << v_char;
+        }
+
+        p_out << '"';
+    }
+}
+
+
+//
+auto register_stats(std::type_info const& p_type, stats_counters& p_counters) -> bool
+{
+    std::lock_guard v_lock {registry_mutex()};
+
+    registry().push_back(listing {&p_type, &p_counters});
+
+    return true;
+}
+
+
+//
+auto snapshot_stats() -> std::vector<container_stats>
+{
+    std::vector<container_stats> v_stats;
+
+    if constexpr (not stats_enabled) return v_stats;
+
+    std::lock_guard v_lock {registry_mutex()};
+
+    v_stats.reserve(registry().size());
+
+    for (listing const& v_listing : registry())
+    {
+        stats_counters const& v_counters = *v_listing.m_counters;
+
+        container_stats v_entry {};
+
+        // frees first: a free is never counted ahead of its allocation, so live cannot wrap
+        v_entry.m_frees       = v_counters.m_frees.load(std::memory_order_relaxed);
+        v_entry.m_allocations = v_counters.m_allocations.load(std::memory_order_relaxed);
+        v_entry.m_failed      = v_counters.m_failed.load(std::memory_order_relaxed);
+        v_entry.m_peak        = v_counters.m_peak.load(std::memory_order_relaxed);
+        v_entry.m_searches    = v_counters.m_searches.load(std::memory_order_relaxed);
+        v_entry.m_depth       = v_counters.m_depth.load(std::memory_order_relaxed);
+        v_entry.m_live        = v_entry.m_allocations - std::min(v_entry.m_frees, v_entry.m_allocations);
+
+        for (std::size_t v_bucket = 0ul; v_bucket < stats_depth_buckets; ++v_bucket)
+        {
+            v_entry.m_depths[v_bucket] = v_counters.m_depths[v_bucket].load(std::memory_order_relaxed);
+        }
+
+        if (v_entry.m_allocations == 0ul && v_entry.m_failed == 0ul && v_entry.m_searches == 0ul) continue;
+
+        v_entry.m_name = readable_name(*v_listing.m_type);
+
+        v_stats.push_back(std::move(v_entry));
+    }
+
+    std::ranges::sort(v_stats, {}, &container_stats::m_name);
+
+    return v_stats;
+}
+
+
+//
+void reset_stats() noexcept(true)
+{
+    std::lock_guard v_lock {registry_mutex()};
+
+    for (listing const& v_listing : registry())
+    {
+        stats_counters& v_counters = *v_listing.m_counters;
+
+        // the live count survives as allocations, so frees of blocks held now still balance
+        std::uint64_t v_frees = v_counters.m_frees.exchange(0ul, std::memory_order_relaxed);
+        std::uint64_t v_held  = v_counters.m_allocations.fetch_sub(v_frees, std::memory_order_relaxed) - v_frees;
+
+        v_counters.m_peak.store(v_held, std::memory_order_relaxed);
+        v_counters.m_failed.store(0ul, std::memory_order_relaxed);
+        v_counters.m_searches.store(0ul, std::memory_order_relaxed);
+        v_counters.m_depth.store(0ul, std::memory_order_relaxed);
+
+        for (std::atomic<std::uint64_t>& v_bucket : v_counters.m_depths)
+        {
+            v_bucket.store(0ul, std::memory_order_relaxed);
+        }
+    }
+}
+
+
+//
+void write_stats(std::ostream& p_out, std::vector<container_stats> const& p_stats)
+{
+    p_out << '[';
+
+    for (std::size_t v_index = 0ul; v_index < p_stats.size(); ++v_index)
+    {
+        container_stats const& v_entry = p_stats[v_index];
+
+        p_out << (v_index == 0ul ? "\n  {" : ",\n  {") << "\"name\": ";
+        write_string(p_out, v_entry.m_name);
+
+        p_out << ", \"allocations\": "          << v_entry.m_allocations
+              << ", \"frees\": "                << v_entry.m_frees
+              << ", \"failed_allocations\": "   << v_entry.m_failed
+              << ", \"live\": "                 << v_entry.m_live
+              << ", \"peak\": "                 << v_entry.m_peak
+              << ", \"searches\": "             << v_entry.m_searches
+              << ", \"average_search_depth\": " << v_entry.average_search_depth()
+              << ", \"search_depth_log2_buckets\": [";
+
+        for (std::size_t v_bucket = 0ul; v_bucket < stats_depth_buckets; ++v_bucket)
+        {
+            p_out << (v_bucket == 0ul ? "" : ", ") << v_entry.m_depths[v_bucket];
+        }
+
+        p_out << "]}";
+    }
+
+    p_out << (p_stats.empty() ? "]\n" : "\n]\n");
+}
@@ -0,0 +1,178 @@
+#include <ds/epoch_domain.hxx>
+
+#include <new>
+#include <thread>
+
+
+// start epoch_domain
+//
+struct epoch_domain::slot_holder final
+{
+    slot m_slot;
+
+    slot_holder() noexcept(true)
+    {
+        epoch_domain::instance().enlist(&m_slot);
+    }
+
+    ~slot_holder() noexcept(true)
+    {
+        epoch_domain::instance().delist(&m_slot);
+    }
+};
+
+
+//
+auto epoch_domain::instance() noexcept(true) -> epoch_domain&
+{
+    // leaked on purpose: thread exits and static destructors may still pin or retire
+    static epoch_domain* const s_domain = new epoch_domain();
+
+    return *s_domain;
+}
+
+
+//
+auto epoch_domain::this_slot() noexcept(true) -> slot&
+{
+    static thread_local slot_holder t_holder;
+
+    return t_holder.m_slot;
+}
+
+
+//
+void epoch_domain::pin() noexcept(true)
+{
+    slot& v_slot = this_slot();
+
+    if (v_slot.m_pins++ == 0u)
+    {
+        // a stale epoch only holds the others back; seq_cst orders the
+        // store before every load the reader makes while pinned
+        v_slot.m_epoch.store(m_epoch.load(std::memory_order_relaxed), std::memory_order_seq_cst);
+    }
+}
+
+
+//
+void epoch_domain::unpin() noexcept(true)
+{
+    slot& v_slot = this_slot();
+
+    if (--v_slot.m_pins == 0u)
+    {
+        v_slot.m_epoch.store(0ul, std::memory_order_release);
+    }
+}
+
+
+//
+void epoch_domain::retire(void* p_pointer, deleter_type p_deleter) noexcept(true)
+{
+    std::unique_lock v_lock {m_mutex};
+
+    // read after the caller unlinked the pointer: a reader that can still
+    // reach it pinned an epoch no later than this one
+    const epoch_type v_epoch = m_epoch.load(std::memory_order_seq_cst);
+
+    try {
+        m_retired.push_back(retired {p_pointer, p_deleter, v_epoch});
+    }
+    catch (std::bad_alloc const&) {
+        // no room to queue it: wait out the readers instead
+        while (m_epoch.load(std::memory_order_seq_cst) < v_epoch + 2ul)
+        {
+            if (advance()) continue;
+
+            v_lock.unlock();
+            std::this_thread::yield();
+            v_lock.lock();
+        }
+
+        p_deleter(p_pointer);
+    }
+
+    static_cast<void>(advance());
+
+    reclaim();
+}
+
+
+//
+void epoch_domain::collect() noexcept(true)
+{
+    std::lock_guard v_lock {m_mutex};
+
+    static_cast<void>(advance());
+
+    reclaim();
+}
+
+
+//
+void epoch_domain::enlist(slot* p_slot) noexcept(true)
+{
+    std::lock_guard v_lock {m_mutex};
+
+    p_slot->m_next = m_slots;
+    m_slots        = p_slot;
+}
+
+
+//
+void epoch_domain::delist(slot* p_slot) noexcept(true)
+{
+    std::lock_guard v_lock {m_mutex};
+
+    for (slot** v_link = &m_slots; *v_link != nullptr; v_link = &(*v_link)->m_next)
+    {
+        if (*v_link == p_slot)
+        {
+            *v_link = p_slot->m_next;
+            break;
+        }
+    }
+}
+
+
+//
+auto epoch_domain::advance() noexcept(true) -> bool
+{
+    const epoch_type v_epoch = m_epoch.load(std::memory_order_seq_cst);
+
+    for (slot const* v_slot = m_slots; v_slot != nullptr; v_slot = v_slot->m_next)
+    {
+        const epoch_type v_seen = v_slot->m_epoch.load(std::memory_order_seq_cst);
+
+        if ((v_seen != 0ul) && (v_seen != v_epoch)) return false;
+    }
+
+    m_epoch.store(v_epoch + 1ul, std::memory_order_seq_cst);
+
+    return true;
+}
+
+
+//
+void epoch_domain::reclaim() noexcept(true)
+{
+    const epoch_type v_epoch = m_epoch.load(std::memory_order_seq_cst);
+
+    std::size_t v_kept = 0ul;
+
+    for (retired const& v_entry : m_retired)
+    {
+        if (v_entry.m_epoch + 2ul <= v_epoch)
+        {
+            v_entry.m_deleter(v_entry.m_pointer);
+        }
+        else {
+            m_retired[v_kept++] = v_entry;
+        }
+    }
+
+    m_retired.erase(m_retired.begin() + static_cast<std::ptrdiff_t>(v_kept), m_retired.end());
+}
+//
+//
@@ -11,74 +11,128 @@
 // //
 //  
 //  
-template <class T>
-forward_list<T>::forward_list() noexcept(true)  = default;
+template <class T, class Allocator>
+forward_list<T, Allocator>::forward_list() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+    : forward_list(Allocator())
+{}
+
+
+//  
+template <class T, class Allocator>
+forward_list<T, Allocator>::forward_list(Allocator const& p_alloc) noexcept(true)
+    : m_alloc(p_alloc)
+{}
 
 
 //  
-template <class T>
-forward_list<T>::forward_list(std::initializer_list<T> p_list)
+template <class T, class Allocator>
+forward_list<T, Allocator>::forward_list(std::initializer_list<T> p_list, Allocator const& p_alloc)
         noexcept(std::is_nothrow_copy_constructible<T>::value)
-    : forward_list(std::ranges::rbegin(p_list), std::ranges::rend(p_list))
+    : forward_list(std::ranges::rbegin(p_list), std::ranges::rend(p_list), p_alloc)
+{}
+
+
+//  
+template <class T, class Allocator>
+forward_list<T, Allocator>::forward_list(forward_list const& p_outer)
+        noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                 std::is_nothrow_default_constructible<Allocator>::value)
+    : forward_list(p_outer, alloc_traits::select_on_container_copy_construction(p_outer.get_allocator()))
 {}
 
 
 //  
-template <class T>
-forward_list<T>::forward_list(forward_list const& p_outer)
+template <class T, class Allocator>
+forward_list<T, Allocator>::forward_list(forward_list const& p_outer, Allocator const& p_alloc)
         noexcept(std::is_nothrow_copy_constructible<T>::value)
-    : forward_list( std::ranges::begin(p_outer), std::ranges::end(p_outer) )
+    : forward_list( std::ranges::begin(p_outer), std::ranges::end(p_outer), p_alloc )
 {
     m_head = reverse(m_head);
 }
 
 
 //  
-template <class T>
-forward_list<T>::forward_list(forward_list&& p_outer) noexcept(true)
-    : forward_list{}
+template <class T, class Allocator>
+forward_list<T, Allocator>::forward_list(forward_list&& p_outer) noexcept(true)
+    : forward_list(p_outer.get_allocator())
 {
     swap(*this, p_outer);
 }
 
 
 //  
-template <class T>
-auto forward_list<T>::operator=(forward_list p_list)
+template <class T, class Allocator>
+auto forward_list<T, Allocator>::operator=(forward_list p_list)
     noexcept(std::is_nothrow_copy_constructible<T>::value) -> forward_list &
 {
-    swap(*this, p_list);
+    // nodes may only change hands between equal allocators
+    if (alloc_traits::propagate_on_container_swap::value or (get_allocator() == p_list.get_allocator()))
+    {
+        swap(*this, p_list);
+    }
+    else {
+        forward_list v_copy(p_list, get_allocator());
+
+        swap(*this, v_copy);
+    }
 
     return *this;
 }
 
 
 //  
-template <class T>
-void forward_list<T>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
+template <class T, class Allocator>
+void forward_list<T, Allocator>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
 {
     assert(not empty());
 
     node_type* v_targ = m_head;
 
     m_head = m_head->m_next;
-    v_targ = ( delete v_targ, nullptr );
+    v_targ = ( deallocate_node(m_alloc, v_targ), nullptr );
 
     m_size = m_size - 1ul;
 }
 
 
 //  
-template <class T>
-[[nodiscard]] auto forward_list<T>::empty() const noexcept(true) -> bool
+template <class T, class Allocator>
+void forward_list<T, Allocator>::sort()
+    noexcept(std::is_nothrow_invocable<std::less<>&, const_reference, const_reference>::value)
+{
+    sort(std::less<>{});
+}
+
+
+//  
+template <class T, class Allocator>
+void forward_list<T, Allocator>::merge(forward_list& p_other)
+    noexcept(std::is_nothrow_invocable<std::less<>&, const_reference, const_reference>::value)
+{
+    merge(p_other, std::less<>{});
+}
+
+
+//  
+template <class T, class Allocator>
+auto forward_list<T, Allocator>::unique() noexcept(std::is_nothrow_destructible<T>::value)
+    -> typename forward_list::size_type
+{
+    return unique(std::equal_to<>{});
+}
+
+
+//  
+template <class T, class Allocator>
+[[nodiscard]] auto forward_list<T, Allocator>::empty() const noexcept(true) -> bool
 {
     return ( m_head == nullptr );
 }
 
 
 //  
-template <class T>
-[[nodiscard]] auto forward_list<T>::size() const noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto forward_list<T, Allocator>::size() const noexcept(true)
     -> typename forward_list::size_type
 {
     return m_size;
@@ -86,8 +140,17 @@ template <class T>
 
 
 //  
-template <class T>
-[[nodiscard]] auto forward_list<T>::front() const noexcept(true)
+template <class T, class Allocator>
+auto forward_list<T, Allocator>::get_allocator() const noexcept(true)
+    -> typename forward_list::allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
+
+//  
+template <class T, class Allocator>
+[[nodiscard]] auto forward_list<T, Allocator>::front() const noexcept(true)
     -> std::optional<typename forward_list::value_type>
 {
     return not empty()  ? std::optional{ m_head->data() }
@@ -96,8 +159,8 @@ template <class T>
 
 
 //  
-template <class T>
-[[nodiscard]] auto forward_list<T>::front() noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto forward_list<T, Allocator>::front() noexcept(true)
     -> std::optional<typename forward_list::value_type>
 {
     return not empty()  ? std::optional{ m_head->data() }
@@ -106,44 +169,58 @@ template <class T>
 
 
 //  
-template <class T>
-auto forward_list<T>::begin() noexcept(true) -> typename forward_list::iterator
+template <class T, class Allocator>
+auto forward_list<T, Allocator>::begin() noexcept(true) -> typename forward_list::iterator
 {
     return iterator{m_head};
 }
 
 
 //  
-template <class T>
-auto forward_list<T>::begin() const noexcept(true) -> typename forward_list::iterator
+template <class T, class Allocator>
+auto forward_list<T, Allocator>::begin() const noexcept(true) -> typename forward_list::iterator
 {
     return iterator{m_head};
 }
 
 
 //  
-template <class T>
-auto forward_list<T>::end() noexcept(true) -> typename forward_list::sentinel
+template <class T, class Allocator>
+auto forward_list<T, Allocator>::end() noexcept(true) -> typename forward_list::sentinel
 {
     return sentinel{};
 }
 
 
 //  
-template <class T>
-auto forward_list<T>::end() const noexcept(true) -> typename forward_list::sentinel
+template <class T, class Allocator>
+auto forward_list<T, Allocator>::end() const noexcept(true) -> typename forward_list::sentinel
 {
     return sentinel{};
 }
 
 
 //  
-template <class T>
-forward_list<T>::~forward_list() noexcept(std::is_nothrow_destructible<T>::value)
+template <class T, class Allocator>
+void forward_list<T, Allocator>::reserve(size_type p_count) requires(node_pooling<node_allocator_type>)
 {
-    while (not empty()) pop_front();
+    m_alloc.reserve(p_count > m_size ? p_count - m_size : 0ul);
+}
+
 
-    m_head = (delete m_head, nullptr);
+//  
+template <class T, class Allocator>
+void forward_list<T, Allocator>::shrink_to_fit() noexcept(true) requires(node_pooling<node_allocator_type>)
+{
+    m_alloc.shrink_to_fit();
+}
+
+
+//  
+template <class T, class Allocator>
+forward_list<T, Allocator>::~forward_list() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    while (not empty()) pop_front();
 }
 //  
 //  
@@ -163,5 +240,30 @@ template class forward_list<unsigned long>;
 template class forward_list<unsigned short>;
 template class forward_list<float>;
 template class forward_list<double>;
+template class forward_list<std::string>;
+
+//  
+template class forward_list<int, std::pmr::polymorphic_allocator<int>>;
+template class forward_list<char, std::pmr::polymorphic_allocator<char>>;
+template class forward_list<long, std::pmr::polymorphic_allocator<long>>;
+template class forward_list<short, std::pmr::polymorphic_allocator<short>>;
+template class forward_list<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class forward_list<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class forward_list<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class forward_list<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class forward_list<float, std::pmr::polymorphic_allocator<float>>;
+template class forward_list<double, std::pmr::polymorphic_allocator<double>>;
+
+//  
+template class forward_list<int, pool_allocator<int>>;
+template class forward_list<char, pool_allocator<char>>;
+template class forward_list<long, pool_allocator<long>>;
+template class forward_list<short, pool_allocator<short>>;
+template class forward_list<unsigned int, pool_allocator<unsigned int>>;
+template class forward_list<unsigned char, pool_allocator<unsigned char>>;
+template class forward_list<unsigned long, pool_allocator<unsigned long>>;
+template class forward_list<unsigned short, pool_allocator<unsigned short>>;
+template class forward_list<float, pool_allocator<float>>;
+template class forward_list<double, pool_allocator<double>>;
 //  
 //  
\ No newline at end of file
@@ -0,0 +1,426 @@
+#include <ds/indexed_list.hxx>
+
+
+// start indexed_list
+//
+//
+template <class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+    : indexed_list(Allocator())
+{}
+
+
+//
+template <class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(Allocator const& p_alloc) noexcept(true)
+    : m_alloc(p_alloc)
+{}
+
+
+//
+template <class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(std::initializer_list<T> p_list, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+    : indexed_list(std::ranges::begin(p_list), std::ranges::end(p_list), p_alloc)
+{}
+
+
+//
+template <class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(indexed_list const& p_outer)
+        noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                 std::is_nothrow_default_constructible<Allocator>::value)
+    : indexed_list(p_outer, alloc_traits::select_on_container_copy_construction(p_outer.get_allocator()))
+{}
+
+
+//
+template <class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(indexed_list const& p_outer, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+    : indexed_list(std::ranges::begin(p_outer), std::ranges::end(p_outer), p_alloc)
+{}
+
+
+//
+template <class T, class Allocator>
+indexed_list<T, Allocator>::indexed_list(indexed_list&& p_outer) noexcept(true)
+    : indexed_list(p_outer.get_allocator())
+{
+    swap(*this, p_outer);
+}
+
+
+//
+template <class T, class Allocator>
+auto indexed_list<T, Allocator>::operator=(indexed_list p_list)
+    noexcept(std::is_nothrow_copy_constructible<T>::value) -> indexed_list &
+{
+    // nodes may only change hands between equal allocators
+    if (alloc_traits::propagate_on_container_swap::value or (get_allocator() == p_list.get_allocator()))
+    {
+        swap(*this, p_list);
+    }
+    else {
+        indexed_list v_copy(p_list, get_allocator());
+
+        swap(*this, v_copy);
+    }
+
+    return *this;
+}
+
+
+//
+template <class T, class Allocator>
+void indexed_list<T, Allocator>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    assert(not empty());
+
+    free_node(unlink(0ul));
+}
+
+
+//
+template <class T, class Allocator>
+void indexed_list<T, Allocator>::pop_back() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    assert(not empty());
+
+    free_node(unlink(m_size - 1ul));
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto indexed_list<T, Allocator>::front() const noexcept(true)
+    -> std::optional<typename indexed_list::value_type>
+{
+    return not empty()  ? std::optional{m_head[0ul].m_next->m_data}
+                        : std::nullopt;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto indexed_list<T, Allocator>::front() noexcept(true)
+    -> std::optional<typename indexed_list::value_type>
+{
+    return not empty()  ? std::optional{m_head[0ul].m_next->m_data}
+                        : std::nullopt;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto indexed_list<T, Allocator>::back() const noexcept(true)
+    -> std::optional<typename indexed_list::value_type>
+{
+    return not empty()  ? std::optional{find_at(m_size - 1ul)->m_data}
+                        : std::nullopt;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto indexed_list<T, Allocator>::back() noexcept(true)
+    -> std::optional<typename indexed_list::value_type>
+{
+    return not empty()  ? std::optional{find_at(m_size - 1ul)->m_data}
+                        : std::nullopt;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto indexed_list<T, Allocator>::empty() const noexcept(true) -> bool
+{
+    return (m_size == 0ul);
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto indexed_list<T, Allocator>::size() const noexcept(true) -> typename indexed_list::size_type
+{
+    return m_size;
+}
+
+
+//
+template <class T, class Allocator>
+auto indexed_list<T, Allocator>::get_allocator() const noexcept(true) -> typename indexed_list::allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
+
+//
+template <class T, class Allocator>
+void indexed_list<T, Allocator>::reserve(size_type p_count) requires(node_pooling<node_allocator_type>)
+{
+    m_alloc.reserve(p_count > m_size ? p_count - m_size : 0ul);
+}
+
+
+//
+template <class T, class Allocator>
+void indexed_list<T, Allocator>::shrink_to_fit() noexcept(true) requires(node_pooling<node_allocator_type>)
+{
+    m_alloc.shrink_to_fit();
+}
+
+
+//
+template <class T, class Allocator>
+auto indexed_list<T, Allocator>::begin() const noexcept(true) -> typename indexed_list::iterator
+{
+    return iterator{m_head[0ul].m_next};
+}
+
+
+//
+template <class T, class Allocator>
+auto indexed_list<T, Allocator>::begin() noexcept(true) -> typename indexed_list::iterator
+{
+    return iterator{m_head[0ul].m_next};
+}
+
+
+//
+template <class T, class Allocator>
+auto indexed_list<T, Allocator>::end() const noexcept(true) -> typename indexed_list::iterator
+{
+    return iterator{nullptr};
+}
+
+
+//
+template <class T, class Allocator>
+auto indexed_list<T, Allocator>::end() noexcept(true) -> typename indexed_list::iterator
+{
+    return iterator{nullptr};
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto indexed_list<T, Allocator>::find_at(size_type p_pos) const noexcept(true) -> node_type*
+{
+    if (p_pos >= m_size) return nullptr;
+
+    const size_type v_rank = p_pos + 1ul;
+
+    node_type* v_node  = nullptr;
+    size_type  v_index = 0ul;
+
+    for (size_type v_level = m_level; v_level-- > 0ul; )
+    {
+        // the last link of a level reaches past the end, so no null test is needed
+        for (link_type const* v_link = &link_of(v_node, v_level);
+             v_index + v_link->m_width <= v_rank;
+             v_link = &link_of(v_node, v_level))
+        {
+            v_index = v_index + v_link->m_width;
+            v_node  = v_link->m_next;
+        }
+
+        if (v_index == v_rank) break;
+    }
+
+    return v_node;
+}
+
+
+//
+template <class T, class Allocator>
+void indexed_list<T, Allocator>::find_path(size_type p_rank, path& p_path) const noexcept(true)
+{
+    node_type* v_node  = nullptr;
+    size_type  v_index = 0ul;
+
+    for (size_type v_level = m_level; v_level-- > 0ul; )
+    {
+        for (link_type const* v_link = &link_of(v_node, v_level);
+             v_index + v_link->m_width < p_rank;
+             v_link = &link_of(v_node, v_level))
+        {
+            v_index = v_index + v_link->m_width;
+            v_node  = v_link->m_next;
+        }
+
+        p_path.m_node[v_level] = v_node;
+        p_path.m_rank[v_level] = v_index;
+    }
+}
+
+
+//
+template <class T, class Allocator>
+void indexed_list<T, Allocator>::link(node_type* p_node, size_type p_pos) noexcept(true)
+{
+    path v_path {};
+
+    find_path(p_pos + 1ul, v_path);
+
+    const size_type v_height = p_node->m_height;
+
+    // new levels start at the head and span everything
+    for (; m_level < v_height; m_level = m_level + 1ul)
+    {
+        v_path.m_node[m_level] = nullptr;
+        v_path.m_rank[m_level] = 0ul;
+
+        m_head[m_level] = link_type{nullptr, m_size + 1ul};
+    }
+
+    for (size_type v_level = 0ul; v_level < m_level; ++v_level)
+    {
+        link_type& v_prev = link_of(v_path.m_node[v_level], v_level);
+
+        if (v_level < v_height)
+        {
+            link_type& v_link = p_node->link_at(v_level);
+
+            v_link.m_next  = v_prev.m_next;
+            v_link.m_width = v_path.m_rank[v_level] + v_prev.m_width - p_pos;
+
+            v_prev.m_next  = p_node;
+            v_prev.m_width = p_pos + 1ul - v_path.m_rank[v_level];
+        }
+        else {
+            // the link above jumps over one more element now
+            v_prev.m_width = v_prev.m_width + 1ul;
+        }
+    }
+
+    m_size = m_size + 1ul;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto indexed_list<T, Allocator>::unlink(size_type p_pos) noexcept(true) -> node_type*
+{
+    path v_path {};
+
+    find_path(p_pos + 1ul, v_path);
+
+    node_type* v_node = link_of(v_path.m_node[0ul], 0ul).m_next;
+
+    for (size_type v_level = 0ul; v_level < m_level; ++v_level)
+    {
+        link_type& v_prev = link_of(v_path.m_node[v_level], v_level);
+
+        if (v_prev.m_next == v_node)
+        {
+            link_type const& v_link = v_node->link_at(v_level);
+
+            v_prev.m_next  = v_link.m_next;
+            v_prev.m_width = v_prev.m_width + v_link.m_width - 1ul;
+        }
+        else {
+            v_prev.m_width = v_prev.m_width - 1ul;
+        }
+    }
+
+    while ( (m_level > 1ul) && (m_head[m_level - 1ul].m_next == nullptr) )
+    {
+        m_level = m_level - 1ul;
+    }
+
+    m_size = m_size - 1ul;
+
+    return v_node;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto indexed_list<T, Allocator>::random_height() noexcept(true) -> size_type
+{
+    // xorshift64*
+    m_seed ^= m_seed >> 12u;
+    m_seed ^= m_seed << 25u;
+    m_seed ^= m_seed >> 27u;
+
+    const std::uint64_t v_bits = m_seed * 0x2545F4914F6CDD1Dull;
+
+    // two more zero bits for every further level
+    const size_type v_height = 1ul + (static_cast<size_type>(std::countr_zero(v_bits | (1ull << 63u))) >> 1u);
+
+    return std::min(v_height, max_height);
+}
+
+
+//
+template <class T, class Allocator>
+void indexed_list<T, Allocator>::free_node(node_type* p_node) noexcept(std::is_nothrow_destructible<T>::value)
+{
+    if (p_node->m_tower)
+    {
+        link_allocator_type v_link_alloc(m_alloc);
+
+        link_traits::deallocate(v_link_alloc, p_node->m_tower, p_node->m_height - 1ul);
+    }
+
+    p_node = (deallocate_node(m_alloc, p_node), nullptr);
+}
+
+
+//
+template <class T, class Allocator>
+indexed_list<T, Allocator>::~indexed_list() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    node_type* v_node = m_head[0ul].m_next;
+
+    while (v_node)
+    {
+        node_type* v_next = v_node->m_base.m_next;
+
+        free_node(v_node);
+
+        v_node = v_next;
+    }
+}
+//
+//
+
+//
+template class indexed_list<int>;
+template class indexed_list<char>;
+template class indexed_list<long>;
+template class indexed_list<short>;
+template class indexed_list<unsigned int>;
+template class indexed_list<unsigned char>;
+template class indexed_list<unsigned long>;
+template class indexed_list<unsigned short>;
+template class indexed_list<float>;
+template class indexed_list<double>;
+template class indexed_list<std::string>;
+
+//
+template class indexed_list<int, std::pmr::polymorphic_allocator<int>>;
+template class indexed_list<char, std::pmr::polymorphic_allocator<char>>;
+template class indexed_list<long, std::pmr::polymorphic_allocator<long>>;
+template class indexed_list<short, std::pmr::polymorphic_allocator<short>>;
+template class indexed_list<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class indexed_list<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class indexed_list<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class indexed_list<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class indexed_list<float, std::pmr::polymorphic_allocator<float>>;
+template class indexed_list<double, std::pmr::polymorphic_allocator<double>>;
+
+//
+template class indexed_list<int, pool_allocator<int>>;
+template class indexed_list<char, pool_allocator<char>>;
+template class indexed_list<long, pool_allocator<long>>;
+template class indexed_list<short, pool_allocator<short>>;
+template class indexed_list<unsigned int, pool_allocator<unsigned int>>;
+template class indexed_list<unsigned char, pool_allocator<unsigned char>>;
+template class indexed_list<unsigned long, pool_allocator<unsigned long>>;
+template class indexed_list<unsigned short, pool_allocator<unsigned short>>;
+template class indexed_list<float, pool_allocator<float>>;
+template class indexed_list<double, pool_allocator<double>>;
+//
+//
@@ -4,50 +4,77 @@
 
 //  start linked_list
 
-template <class T>
-list<T>::list() noexcept(std::is_nothrow_default_constructible<T>::value)
-    : m_head(new(std::nothrow) node_type{})
+template <class T, class Allocator>
+list<T, Allocator>::list() noexcept(std::is_nothrow_default_constructible<T>::value &&
+                                    std::is_nothrow_default_constructible<Allocator>::value)
+    : list(Allocator())
+{}
+
+
+//  
+template <class T, class Allocator>
+list<T, Allocator>::list(Allocator const& p_alloc) noexcept(std::is_nothrow_default_constructible<T>::value)
+    : m_alloc(p_alloc)
+    , m_head(allocate_node<node_type>(m_alloc))
     , m_size( 0ul )
 {}
 
  
 //  
-template <class T>
-list<T>::list(std::initializer_list<T> p_list)
+template <class T, class Allocator>
+list<T, Allocator>::list(std::initializer_list<T> p_list, Allocator const& p_alloc)
         noexcept(std::is_nothrow_copy_constructible<T>::value)
-    : list(std::ranges::begin(p_list), std::ranges::end(p_list))
+    : list(std::ranges::begin(p_list), std::ranges::end(p_list), p_alloc)
+{}
+
+
+//  
+template <class T, class Allocator>
+list<T, Allocator>::list(list const& p_outer) noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                                                       std::is_nothrow_default_constructible<Allocator>::value)
+    : list(p_outer, alloc_traits::select_on_container_copy_construction(p_outer.get_allocator()))
 {}
 
 
 //  
-template <class T>
-list<T>::list(list const& p_outer) noexcept(std::is_nothrow_copy_constructible<T>::value)
-    : list(std::ranges::begin(p_outer), std::ranges::end(p_outer))
+template <class T, class Allocator>
+list<T, Allocator>::list(list const& p_outer, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+    : list(std::ranges::begin(p_outer), std::ranges::end(p_outer), p_alloc)
 {}
 
  
 //  
-template <class T>
-list<T>::list(list&& p_outer) noexcept(true) : list{}
+template <class T, class Allocator>
+list<T, Allocator>::list(list&& p_outer) noexcept(true) : list(p_outer.get_allocator())
 {
     swap(*this, p_outer);
 }
 
  
 //  
-template <class T>
-auto list<T>::operator=(list p_list)
+template <class T, class Allocator>
+auto list<T, Allocator>::operator=(list p_list)
     noexcept(std::is_nothrow_copy_constructible<T>::value) -> list &
 {
-    swap(*this, p_list);
+    // nodes may only change hands between equal allocators
+    if (alloc_traits::propagate_on_container_swap::value or (get_allocator() == p_list.get_allocator()))
+    {
+        swap(*this, p_list);
+    }
+    else {
+        list v_copy(p_list, get_allocator());
+
+        swap(*this, v_copy);
+    }
 
     return *this;
 }
 
 
 //  
-template <class T>
-void list<T>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
+template <class T, class Allocator>
+void list<T, Allocator>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
 {
     assert(not empty());
 
@@ -56,15 +83,15 @@ void list<T>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
     v_curr->m_next->m_prev = m_head;
     m_head->m_next         = v_curr->m_next;
     
-    v_curr = (delete v_curr, nullptr);
+    v_curr = (deallocate_node(m_alloc, v_curr), nullptr);
 
     m_size = m_size - 1ul;
 }
 
  
 //  
-template <class T>
-void list<T>::pop_back() noexcept(std::is_notrow_destructible<T>::value)
+template <class T, class Allocator>
+void list<T, Allocator>::pop_back() noexcept(std::is_nothrow_destructible<T>::value)
 {
     assert(not empty());
 
@@ -73,31 +100,65 @@ void list<T>::pop_back() noexcept(std::is_notrow_destructible<T>::value)
     v_curr->m_prev->m_next = m_head;
     m_head->m_prev         = v_curr->m_prev;
     
-    v_curr = (delete v_curr, nullptr);
+    v_curr = (deallocate_node(m_alloc, v_curr), nullptr);
 
     m_size = m_size - 1ul;
 }
 
 
 //  
-template <class T>
-[[nodiscard]] auto list<T>::empty() const noexcept(true) -> bool
+template <class T, class Allocator>
+void list<T, Allocator>::sort()
+    noexcept(std::is_nothrow_invocable<std::less<>&, const_reference, const_reference>::value)
+{
+    sort(std::less<>{});
+}
+
+
+//  
+template <class T, class Allocator>
+void list<T, Allocator>::merge(list& p_other)
+    noexcept(std::is_nothrow_invocable<std::less<>&, const_reference, const_reference>::value)
+{
+    merge(p_other, std::less<>{});
+}
+
+
+//  
+template <class T, class Allocator>
+auto list<T, Allocator>::unique() noexcept(std::is_nothrow_destructible<T>::value) -> typename list::size_type
+{
+    return unique(std::equal_to<>{});
+}
+
+
+//  
+template <class T, class Allocator>
+[[nodiscard]] auto list<T, Allocator>::empty() const noexcept(true) -> bool
 {
     return ( (m_head == m_head->m_next) && (m_head == m_head->m_prev));
 }
 
  
 //  
-template <class T>
-[[nodiscard]] auto list<T>::size() const noexcept(true) -> typename list::size_type
+template <class T, class Allocator>
+[[nodiscard]] auto list<T, Allocator>::size() const noexcept(true) -> typename list::size_type
 {
     return m_size;
 }
 
 
 //  
-template <class T>
-[[nodiscard]] auto list<T>::front() const noexcept(true)
+template <class T, class Allocator>
+auto list<T, Allocator>::get_allocator() const noexcept(true) -> typename list::allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
+
+//  
+template <class T, class Allocator>
+[[nodiscard]] auto list<T, Allocator>::front() const noexcept(true)
     -> std::optional<typename list::value_type>
 {
     return not empty()  ? std::optional{m_head->m_next->data()}
@@ -106,8 +167,8 @@ template <class T>
 
  
 //  
-template <class T>
-[[nodiscard]] auto list<T>::back() const noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto list<T, Allocator>::back() const noexcept(true)
     -> std::optional<typename list::value_type>
 {
     return not empty()  ? std::optional{m_head->m_prev->data()}
@@ -116,76 +177,94 @@ template <class T>
 
  
 //  
-template <class T>
-auto list<T>::begin() noexcept(true) -> typename list::iterator
+template <class T, class Allocator>
+auto list<T, Allocator>::begin() noexcept(true) -> typename list::iterator
 {
     return iterator{m_head->m_next};
 }
 
  
 //  
-template <class T>
-auto list<T>::begin() const noexcept(true) -> typename list::iterator
+template <class T, class Allocator>
+auto list<T, Allocator>::begin() const noexcept(true) -> typename list::iterator
 {
     return iterator{m_head->m_next};
 }
 
  
 //  
-template <class T>
-auto list<T>::end() noexcept(true) -> typename list::iterator
+template <class T, class Allocator>
+auto list<T, Allocator>::end() noexcept(true) -> typename list::iterator
 {
     return iterator{m_head};
 }
 
  
 //  
-template <class T>
-auto list<T>::end() const noexcept(true) -> typename list::iterator
+template <class T, class Allocator>
+auto list<T, Allocator>::end() const noexcept(true) -> typename list::iterator
 {
     return iterator{m_head};
 }
 
  
 //  
-template <class T>
-auto list<T>::rbegin() noexcept(true) -> typename list::reverse_iterator
+template <class T, class Allocator>
+auto list<T, Allocator>::rbegin() noexcept(true) -> typename list::reverse_iterator
 {
     return reverse_iterator{m_head->m_prev};
 }
 
  
 //  
-template <class T>
-auto list<T>::rbegin() const noexcept(true) -> typename list::reverse_iterator
+template <class T, class Allocator>
+auto list<T, Allocator>::rbegin() const noexcept(true) -> typename list::reverse_iterator
 {
     return reverse_iterator{m_head->m_prev};
 }
 
   
 //  
-template <class T>
-auto list<T>::rend() noexcept(true) -> typename list::reverse_iterator
+template <class T, class Allocator>
+auto list<T, Allocator>::rend() noexcept(true) -> typename list::reverse_iterator
 {
     return reverse_iterator{m_head};
 }
 
  
 //  
-template <class T>
-auto list<T>::rend() const noexcept(true) -> typename list::reverse_iterator
+template <class T, class Allocator>
+auto list<T, Allocator>::rend() const noexcept(true) -> typename list::reverse_iterator
 {
     return reverse_iterator{m_head};
 }
 
  
 //  
-template <class T>
-list<T>::~list() noexcept(std::is_notrow_destructible<T>::value)
+template <class T, class Allocator>
+void list<T, Allocator>::reserve(size_type p_count) requires(node_pooling<node_allocator_type>)
+{
+    m_alloc.reserve(p_count > m_size ? p_count - m_size : 0ul);
+}
+
+
+//  
+template <class T, class Allocator>
+void list<T, Allocator>::shrink_to_fit() noexcept(true) requires(node_pooling<node_allocator_type>)
+{
+    m_alloc.shrink_to_fit();
+}
+
+
+//  
+template <class T, class Allocator>
+list<T, Allocator>::~list() noexcept(std::is_nothrow_destructible<T>::value)
 {
+    if (m_head == nullptr) return;
+
     while (not empty()) pop_front();
 
-    m_head = (delete m_head, nullptr);
+    m_head = (deallocate_node(m_alloc, m_head), nullptr);
 }
 //  
 //  
@@ -202,5 +281,30 @@ template class list<unsigned long>;
 template class list<unsigned short>;
 template class list<float>;
 template class list<double>;
+template class list<std::string>;
+
+//  
+template class list<int, std::pmr::polymorphic_allocator<int>>;
+template class list<char, std::pmr::polymorphic_allocator<char>>;
+template class list<long, std::pmr::polymorphic_allocator<long>>;
+template class list<short, std::pmr::polymorphic_allocator<short>>;
+template class list<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class list<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class list<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class list<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class list<float, std::pmr::polymorphic_allocator<float>>;
+template class list<double, std::pmr::polymorphic_allocator<double>>;
+
+//  
+template class list<int, pool_allocator<int>>;
+template class list<char, pool_allocator<char>>;
+template class list<long, pool_allocator<long>>;
+template class list<short, pool_allocator<short>>;
+template class list<unsigned int, pool_allocator<unsigned int>>;
+template class list<unsigned char, pool_allocator<unsigned char>>;
+template class list<unsigned long, pool_allocator<unsigned long>>;
+template class list<unsigned short, pool_allocator<unsigned short>>;
+template class list<float, pool_allocator<float>>;
+template class list<double, pool_allocator<double>>;
 //  
 //  
\ No newline at end of file
@@ -0,0 +1,274 @@
+
+#include <ds/mpmc_queue.hxx>
+
+
+// start mpmc_queue
+//
+template <mpmc_value T, class Allocator>
+mpmc_queue<T, Allocator>::mpmc_queue(size_type p_capacity, Allocator const& p_alloc) noexcept(true)
+    : m_alloc( p_alloc )
+{
+    const size_type v_capacity = std::bit_ceil(std::max(p_capacity, size_type {2ul}));
+
+    try {
+        m_slots = slot_traits::allocate(m_alloc, v_capacity);
+    }
+    catch (...) {
+        stats_failed<mpmc_queue>();
+        return;
+    }
+
+    stats_allocated<mpmc_queue>();
+
+    // slot i first admits the producer holding ticket i
+    for (size_type i = 0ul; i < v_capacity; ++i)
+    {
+        slot_traits::construct(m_alloc, m_slots + i, i);
+    }
+
+    m_capacity = v_capacity;
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+auto mpmc_queue<T, Allocator>::try_pop() noexcept(true) -> std::optional<typename mpmc_queue::value_type>
+{
+    size_type v_ticket {};
+
+    slot_type* v_slot = claim_pop(v_ticket);
+
+    if (v_slot == nullptr) return std::nullopt;
+
+    return drain(*v_slot, v_ticket);
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+auto mpmc_queue<T, Allocator>::pop() noexcept(true) -> std::optional<typename mpmc_queue::value_type>
+{
+    // no ring, no producer will ever come: waiting would hang
+    if (m_capacity == 0ul) return std::nullopt;
+
+    const size_type v_ticket = m_dequeue.fetch_add(1ul, std::memory_order_relaxed);
+
+    slot_type& v_slot = at(v_ticket);
+
+    wait_turn(v_slot, v_ticket + 1ul);
+
+    return drain(v_slot, v_ticket);
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+[[nodiscard]] auto mpmc_queue<T, Allocator>::empty() const noexcept(true) -> bool
+{
+    return (size() == 0ul);
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+[[nodiscard]] auto mpmc_queue<T, Allocator>::size() const noexcept(true)
+    -> typename mpmc_queue::size_type
+{
+    const size_type v_dequeue = m_dequeue.load(std::memory_order_acquire);
+    const size_type v_enqueue = m_enqueue.load(std::memory_order_acquire);
+
+    // blocked consumers hold tickets ahead of the producers
+    const auto v_diff = static_cast<std::ptrdiff_t>(v_enqueue - v_dequeue);
+
+    return std::min(static_cast<size_type>(std::max(v_diff, std::ptrdiff_t {0})), m_capacity);
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+[[nodiscard]] auto mpmc_queue<T, Allocator>::capacity() const noexcept(true)
+    -> typename mpmc_queue::size_type
+{
+    return m_capacity;
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+auto mpmc_queue<T, Allocator>::get_allocator() const noexcept(true)
+    -> typename mpmc_queue::allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+auto mpmc_queue<T, Allocator>::claim_push(size_type& p_ticket) noexcept(true) -> slot_type*
+{
+    if (m_capacity == 0ul) return nullptr;
+
+    p_ticket = m_enqueue.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        slot_type& v_slot = at(p_ticket);
+
+        const auto v_lag = static_cast<std::ptrdiff_t>(v_slot.m_turn.load(std::memory_order_acquire) - p_ticket);
+
+        if (v_lag == 0)
+        {
+            if (m_enqueue.compare_exchange_weak(p_ticket, p_ticket + 1ul, std::memory_order_relaxed))
+            {
+                return &v_slot;
+            }
+        }
+        else if (v_lag < 0) {
+            return nullptr;     // last lap's element is still there: full
+        }
+        else {
+            p_ticket = m_enqueue.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+auto mpmc_queue<T, Allocator>::claim_pop(size_type& p_ticket) noexcept(true) -> slot_type*
+{
+    if (m_capacity == 0ul) return nullptr;
+
+    p_ticket = m_dequeue.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        slot_type& v_slot = at(p_ticket);
+
+        const auto v_lag = static_cast<std::ptrdiff_t>(v_slot.m_turn.load(std::memory_order_acquire) - (p_ticket + 1ul));
+
+        if (v_lag == 0)
+        {
+            if (m_dequeue.compare_exchange_weak(p_ticket, p_ticket + 1ul, std::memory_order_relaxed))
+            {
+                return &v_slot;
+            }
+        }
+        else if (v_lag < 0) {
+            return nullptr;     // nothing written for this ticket yet: empty
+        }
+        else {
+            p_ticket = m_dequeue.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+void mpmc_queue<T, Allocator>::wait_turn(slot_type& p_slot, size_type p_turn) noexcept(true)
+{
+    size_type v_seen = p_slot.m_turn.load(std::memory_order_acquire);
+
+    while (v_seen != p_turn)
+    {
+        p_slot.m_turn.wait(v_seen, std::memory_order_relaxed);
+
+        v_seen = p_slot.m_turn.load(std::memory_order_acquire);
+    }
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+void mpmc_queue<T, Allocator>::pass_turn(slot_type& p_slot, size_type p_turn) noexcept(true)
+{
+    p_slot.m_turn.store(p_turn, std::memory_order_release);
+    p_slot.m_turn.notify_all();
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+auto mpmc_queue<T, Allocator>::drain(slot_type& p_slot, size_type p_ticket) noexcept(true)
+    -> typename mpmc_queue::value_type
+{
+    Allocator v_alloc(m_alloc);
+
+    T* v_elem = p_slot.data();
+
+    value_type v_value {std::move(*v_elem)};
+
+    alloc_traits::destroy(v_alloc, v_elem);
+
+    // next lap: the producer holding ticket + capacity
+    pass_turn(p_slot, p_ticket + m_capacity);
+
+    return v_value;
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+void mpmc_queue<T, Allocator>::ring() noexcept(true)
+{
+    // pairs with the fence in pop_for: either it sees our element or we see it listening
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (m_listeners.load(std::memory_order_relaxed) != 0ul) m_doorbell.release();
+}
+
+
+//
+template <mpmc_value T, class Allocator>
+mpmc_queue<T, Allocator>::~mpmc_queue() noexcept(true)
+{
+    if (m_slots == nullptr) return;
+
+    Allocator v_alloc(m_alloc);
+
+    const size_type v_enqueue = m_enqueue.load(std::memory_order_acquire);
+
+    for (size_type i = m_dequeue.load(std::memory_order_acquire); static_cast<std::ptrdiff_t>(v_enqueue - i) > 0; ++i)
+    {
+        alloc_traits::destroy(v_alloc, at(i).data());
+    }
+
+    for (size_type i = 0ul; i < m_capacity; ++i)
+    {
+        slot_traits::destroy(m_alloc, m_slots + i);
+    }
+
+    if ( m_slots ) stats_freed<mpmc_queue>();
+
+    m_slots = (slot_traits::deallocate(m_alloc, m_slots, m_capacity), nullptr);
+}
+//
+
+//
+template class mpmc_queue<int>;
+template class mpmc_queue<char>;
+template class mpmc_queue<long>;
+template class mpmc_queue<short>;
+template class mpmc_queue<unsigned int>;
+template class mpmc_queue<unsigned char>;
+template class mpmc_queue<unsigned long>;
+template class mpmc_queue<unsigned short>;
+template class mpmc_queue<float>;
+template class mpmc_queue<double>;
+template class mpmc_queue<std::string>;
+template class mpmc_queue<void*>;
+
+//
+template class mpmc_queue<int, std::pmr::polymorphic_allocator<int>>;
+template class mpmc_queue<char, std::pmr::polymorphic_allocator<char>>;
+template class mpmc_queue<long, std::pmr::polymorphic_allocator<long>>;
+template class mpmc_queue<short, std::pmr::polymorphic_allocator<short>>;
+template class mpmc_queue<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class mpmc_queue<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class mpmc_queue<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class mpmc_queue<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class mpmc_queue<float, std::pmr::polymorphic_allocator<float>>;
+template class mpmc_queue<double, std::pmr::polymorphic_allocator<double>>;
+//
+//
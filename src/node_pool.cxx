@@ -0,0 +1,214 @@
+//  --------------------------------------------
+//  --------------------------------------------
+        #include <ds/node_pool.hxx>
+//  --------------------------------------------
+//  --------------------------------------------
+
+#include <algorithm>
+#include <functional>
+
+
+// start node_pool
+
+
+
+//
+node_pool::node_pool(size_type p_slab_blocks) noexcept(true)
+    : m_slab_blocks(std::max(p_slab_blocks, size_type {1ul}))
+{
+}
+
+
+//
+auto node_pool::allocate(size_type p_size, size_type p_align) -> void*
+{
+    size_class& v_class = find(p_size, p_align);
+
+    if (not v_class.m_free) grow(v_class, m_slab_blocks);
+
+    free_block* v_block = v_class.m_free;
+
+    v_class.m_free   = v_block->m_next;
+    v_class.m_in_use = v_class.m_in_use + 1ul;
+
+    return v_block;
+}
+
+
+//
+void node_pool::deallocate(void* p_block, size_type p_size, size_type p_align) noexcept(true)
+{
+    size_class& v_class = find(p_size, p_align);
+
+    // the block goes back on the free list, the slab stays with the pool
+    v_class.m_free   = ::new (p_block) free_block {v_class.m_free};
+    v_class.m_in_use = v_class.m_in_use - 1ul;
+}
+
+
+//
+void node_pool::reserve(size_type p_size, size_type p_align, size_type p_count)
+{
+    size_class& v_class = find(p_size, p_align);
+
+    const size_type v_free = v_class.m_capacity - v_class.m_in_use;
+
+    if (v_free < p_count) grow(v_class, p_count - v_free);
+}
+
+
+//
+void node_pool::shrink_to_fit() noexcept(true)
+{
+    for (size_class& v_class : m_classes)
+    {
+        if (v_class.m_slabs.empty()) continue;
+
+        auto v_owner = [&v_class](free_block const* p_block) noexcept(true) -> size_type
+        {
+            auto v_found = std::ranges::upper_bound(v_class.m_slabs, reinterpret_cast<std::byte const*>(p_block),
+                                                    std::less {}, &slab::m_begin);
+
+            return static_cast<size_type>(v_found - v_class.m_slabs.begin()) - 1ul;
+        };
+
+        std::vector<size_type> v_free(v_class.m_slabs.size(), 0ul);
+
+        for (free_block* v_block = v_class.m_free; v_block; v_block = v_block->m_next)
+        {
+            v_free[v_owner(v_block)] += 1ul;
+        }
+
+        // unlink the blocks of every slab that is entirely free
+        free_block** v_link = &v_class.m_free;
+
+        while (*v_link)
+        {
+            const size_type v_slab = v_owner(*v_link);
+
+            if (v_free[v_slab] == v_class.m_slabs[v_slab].m_blocks)
+            {
+                *v_link = (*v_link)->m_next;
+            }
+            else {
+                v_link = &(*v_link)->m_next;
+            }
+        }
+
+        size_type v_kept = 0ul;
+
+        for (size_type i = 0ul; i < v_class.m_slabs.size(); ++i)
+        {
+            if (v_free[i] == v_class.m_slabs[i].m_blocks)
+            {
+                release(v_class, v_class.m_slabs[i]);
+            }
+            else {
+                v_class.m_slabs[v_kept++] = v_class.m_slabs[i];
+            }
+        }
+
+        v_class.m_slabs.resize(v_kept);
+    }
+}
+
+
+//
+auto node_pool::stats() const noexcept(true) -> node_pool_stats
+{
+    node_pool_stats v_stats {};
+
+    for (size_class const& v_class : m_classes)
+    {
+        v_stats.m_slabs    += v_class.m_slabs.size();
+        v_stats.m_capacity += v_class.m_capacity;
+        v_stats.m_in_use   += v_class.m_in_use;
+    }
+
+    v_stats.m_system_allocations   = m_system_allocations;
+    v_stats.m_system_deallocations = m_system_deallocations;
+
+    return v_stats;
+}
+
+
+//
+node_pool::~node_pool() noexcept(true)
+{
+    for (size_class& v_class : m_classes)
+    {
+        for (slab const& v_slab : v_class.m_slabs) release(v_class, v_slab);
+    }
+}
+
+
+//
+auto node_pool::block_size(size_type p_size, size_type p_align) noexcept(true) -> size_type
+{
+    const size_type v_align = std::max(p_align, alignof(free_block));
+    const size_type v_size  = std::max(p_size, sizeof(free_block));
+
+    return ((v_size + v_align - 1ul) / v_align) * v_align;
+}
+
+
+//
+auto node_pool::find(size_type p_size, size_type p_align) -> size_class&
+{
+    const size_type v_size  = block_size(p_size, p_align);
+    const size_type v_align = std::max(p_align, alignof(free_block));
+
+    // a handful of node types at most, a linear scan beats anything clever
+    for (size_class& v_class : m_classes)
+    {
+        if ((v_class.m_size == v_size) && (v_class.m_align == v_align)) return v_class;
+    }
+
+    size_class& v_class = m_classes.emplace_back();
+
+    v_class.m_size  = v_size;
+    v_class.m_align = v_align;
+
+    return v_class;
+}
+
+
+//
+void node_pool::grow(size_class& p_class, size_type p_blocks)
+{
+    auto v_begin = static_cast<std::byte*>(
+        ::operator new(p_blocks * p_class.m_size, std::align_val_t {p_class.m_align}));
+
+    m_system_allocations = m_system_allocations + 1ul;
+
+    auto v_where = std::ranges::upper_bound(p_class.m_slabs, v_begin, std::less {}, &slab::m_begin);
+
+    try {
+        p_class.m_slabs.insert(v_where, slab {v_begin, p_blocks});
+    }
+    catch (...) {
+        ::operator delete(v_begin, std::align_val_t {p_class.m_align});
+        throw;
+    }
+
+    // thread back to front so blocks leave the slab in address order
+    for (size_type i = p_blocks; i > 0ul; --i)
+    {
+        p_class.m_free = ::new (v_begin + (i - 1ul) * p_class.m_size) free_block {p_class.m_free};
+    }
+
+    p_class.m_capacity = p_class.m_capacity + p_blocks;
+}
+
+
+//
+void node_pool::release(size_class& p_class, slab const& p_slab) noexcept(true)
+{
+    ::operator delete(p_slab.m_begin, std::align_val_t {p_class.m_align});
+
+    p_class.m_capacity     = p_class.m_capacity - p_slab.m_blocks;
+    m_system_deallocations = m_system_deallocations + 1ul;
+}
+//
+//
+// end node_pool
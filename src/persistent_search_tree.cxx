@@ -0,0 +1,465 @@
+//  --------------------------------------------
+//  --------------------------------------------
+        #include <ds/persistent_search_tree.hxx>
+//  --------------------------------------------
+//  --------------------------------------------
+
+
+// start persistent_snapshot
+
+
+
+//
+template <persistent_key T>
+persistent_snapshot<T>::persistent_snapshot() noexcept(true) = default;
+
+
+//
+template <persistent_key T>
+persistent_snapshot<T>::persistent_snapshot(node_type const* p_root) noexcept(true)
+    : m_root(p_root)
+{
+}
+
+
+//
+template <persistent_key T>
+persistent_snapshot<T>::persistent_snapshot(persistent_snapshot const& p_outer) noexcept(true)
+    : m_root(p_outer.m_root)
+{
+    // the outer pin keeps the version alive until ours is in place
+    if (m_root != nullptr) epoch_domain::instance().pin();
+}
+
+
+//
+template <persistent_key T>
+persistent_snapshot<T>::persistent_snapshot(persistent_snapshot&& p_outer) noexcept(true)
+    : m_root(std::exchange(p_outer.m_root, nullptr))
+{
+}
+
+
+//
+template <persistent_key T>
+auto persistent_snapshot<T>::operator=(persistent_snapshot p_rhs) noexcept(true) -> persistent_snapshot&
+{
+    std::swap(m_root, p_rhs.m_root);
+
+    return *this;
+}
+
+
+//
+template <persistent_key T>
+persistent_snapshot<T>::~persistent_snapshot() noexcept(true)
+{
+    if (m_root != nullptr) epoch_domain::instance().unpin();
+}
+
+
+//
+template <persistent_key T>
+auto persistent_snapshot<T>::search(T const& p_key) const noexcept(true)
+    -> std::optional<typename persistent_snapshot::value_type>
+{
+    if (const_pointer v_found = find(p_key))
+    {
+        return *v_found;
+    }
+
+    return std::nullopt;
+}
+
+
+//
+template <persistent_key T>
+void persistent_snapshot<T>::print_inorder() const noexcept(true)
+{
+    if (not m_root) return;
+
+    print(m_root);
+
+    std::cout << std::endl;
+}
+
+
+//
+template <persistent_key T>
+void persistent_snapshot<T>::print(node_type const* p_node) noexcept(true)
+{
+    // recursion depth is the AVL height, below 1.45 * log2(n + 2)
+    if (p_node == nullptr) return;
+
+    print(p_node->m_left.get());
+
+    std::cout << p_node->m_data << ' ';
+
+    print(p_node->m_right.get());
+}
+
+
+//
+template <persistent_key T>
+auto persistent_snapshot<T>::empty() const noexcept(true) -> bool
+{
+    return (not m_root);
+}
+
+
+//
+template <persistent_key T>
+auto persistent_snapshot<T>::size() const noexcept(true) -> size_type
+{
+    return m_root ? m_root->m_count : 0ul;
+}
+
+
+//
+template <persistent_key T>
+auto persistent_snapshot<T>::max() const noexcept(true) -> std::optional<value_type>
+{
+    if (node_type const* v_current = m_root)
+    {
+        while (v_current->m_right)
+            v_current = v_current->m_right.get();
+
+        return v_current->m_data;
+    }
+
+    return std::nullopt;
+}
+
+
+//
+template <persistent_key T>
+auto persistent_snapshot<T>::min() const noexcept(true) -> std::optional<value_type>
+{
+    if (node_type const* v_current = m_root)
+    {
+        while (v_current->m_left)
+            v_current = v_current->m_left.get();
+
+        return v_current->m_data;
+    }
+
+    return std::nullopt;
+}
+
+
+// start persistent_search_tree
+
+
+
+//
+template <persistent_key T>
+persistent_search_tree<T>::persistent_search_tree() noexcept(true) = default;
+
+
+//
+template <persistent_key T>
+persistent_search_tree<T>::persistent_search_tree(std::initializer_list<T> p_list)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+    : persistent_search_tree()
+{
+    for (T const& v_value : p_list)
+    {
+        insert(v_value);
+    }
+}
+
+
+//
+template <persistent_key T>
+persistent_search_tree<T>::persistent_search_tree(persistent_search_tree const& p_outer) noexcept(true)
+    : m_root(p_outer.current().release())
+{
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::operator=(persistent_search_tree const& p_rhs) noexcept(true)
+    -> persistent_search_tree&
+{
+    retire(m_root.exchange(p_rhs.current().release(), std::memory_order_seq_cst));
+
+    return *this;
+}
+
+
+//
+template <persistent_key T>
+persistent_search_tree<T>::~persistent_search_tree() noexcept(true)
+{
+    retire(m_root.load(std::memory_order_relaxed));
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::snapshot() const noexcept(true) -> snapshot_type
+{
+    epoch_domain& v_domain = epoch_domain::instance();
+
+    v_domain.pin();
+
+    // seq_cst: the pin is visible to writers before the root is read
+    node_type const* v_root = m_root.load(std::memory_order_seq_cst);
+
+    if (v_root == nullptr)
+    {
+        v_domain.unpin();
+
+        return snapshot_type{};
+    }
+
+    return snapshot_type{v_root};
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::search(T const& p_key) const noexcept(true)
+    -> std::optional<typename persistent_search_tree::value_type>
+{
+    return snapshot().search(p_key);
+}
+
+
+//
+template <persistent_key T>
+void persistent_search_tree<T>::remove(T const& p_key) noexcept(true)
+{
+    update([&p_key](link_type const& p_root) { return detach(p_root, p_key); });
+}
+
+
+//
+template <persistent_key T>
+void persistent_search_tree<T>::clear() noexcept(true)
+{
+    retire(m_root.exchange(nullptr, std::memory_order_seq_cst));
+}
+
+
+//
+template <persistent_key T>
+void persistent_search_tree<T>::print_inorder() const noexcept(true)
+{
+    snapshot().print_inorder();
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::empty() const noexcept(true) -> bool
+{
+    return snapshot().empty();
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::size() const noexcept(true) -> size_type
+{
+    return snapshot().size();
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::max() const noexcept(true) -> std::optional<value_type>
+{
+    return snapshot().max();
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::min() const noexcept(true) -> std::optional<value_type>
+{
+    return snapshot().min();
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::make(node_type const* p_from, link_type p_left, link_type p_right)
+    -> link_type
+{
+    return link_type::adopt(new node_type const(std::move(p_left), std::move(p_right),
+                                                std::in_place, p_from->m_data));
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::current() const noexcept(true) -> link_type
+{
+    epoch_domain& v_domain = epoch_domain::instance();
+
+    // pinned, the root can not be freed between the load and the count
+    v_domain.pin();
+
+    link_type v_root = link_type::share(m_root.load(std::memory_order_seq_cst));
+
+    v_domain.unpin();
+
+    return v_root;
+}
+
+
+//
+template <persistent_key T>
+void persistent_search_tree<T>::retire(node_type const* p_root) noexcept(true)
+{
+    if (p_root != nullptr)
+    {
+        epoch_domain::instance().retire(const_cast<node_type*>(p_root), &release);
+    }
+}
+
+
+//
+template <persistent_key T>
+void persistent_search_tree<T>::release(void* p_root) noexcept(true)
+{
+    // dropping the last link frees the nodes no other version shares
+    link_type v_root = link_type::adopt(static_cast<node_type const*>(p_root));
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::balance(node_type const* p_from, link_type p_left, link_type p_right)
+    -> link_type
+{
+    int v_left  = height(p_left);
+    int v_right = height(p_right);
+
+    if (v_left > (v_right + 1))
+    {
+        node_type const* v_pivot = p_left.get();
+
+        // single right rotation, or left-right when the inner grandchild is taller
+        if (height(v_pivot->m_left) >= height(v_pivot->m_right))
+        {
+            return make(v_pivot, v_pivot->m_left, make(p_from, v_pivot->m_right, std::move(p_right)));
+        }
+
+        node_type const* v_inner = v_pivot->m_right.get();
+
+        return make(v_inner,
+                    make(v_pivot, v_pivot->m_left, v_inner->m_left),
+                    make(p_from, v_inner->m_right, std::move(p_right)));
+    }
+
+    if (v_right > (v_left + 1))
+    {
+        node_type const* v_pivot = p_right.get();
+
+        if (height(v_pivot->m_right) >= height(v_pivot->m_left))
+        {
+            return make(v_pivot, make(p_from, std::move(p_left), v_pivot->m_left), v_pivot->m_right);
+        }
+
+        node_type const* v_inner = v_pivot->m_left.get();
+
+        return make(v_inner,
+                    make(p_from, std::move(p_left), v_inner->m_left),
+                    make(v_pivot, v_inner->m_right, v_pivot->m_right));
+    }
+
+    return make(p_from, std::move(p_left), std::move(p_right));
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::attach(link_type const& p_root, link_type const& p_leaf) -> link_type
+{
+    if (not p_root) return p_leaf;
+
+    if (p_leaf->m_data <= p_root->m_data)
+    {
+        return balance(p_root.get(), attach(p_root->m_left, p_leaf), p_root->m_right);
+    }
+
+    return balance(p_root.get(), p_root->m_left, attach(p_root->m_right, p_leaf));
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::detach(link_type const& p_root, T const& p_key) -> link_type
+{
+    if (not p_root) return p_root;
+
+    if (p_key < p_root->m_data)
+    {
+        link_type v_left = detach(p_root->m_left, p_key);
+
+        // key absent below: share this subtree as is
+        if (v_left == p_root->m_left) return p_root;
+
+        return balance(p_root.get(), std::move(v_left), p_root->m_right);
+    }
+
+    if (p_root->m_data < p_key)
+    {
+        link_type v_right = detach(p_root->m_right, p_key);
+
+        if (v_right == p_root->m_right) return p_root;
+
+        return balance(p_root.get(), p_root->m_left, std::move(v_right));
+    }
+
+    if (not p_root->m_left)  return p_root->m_right;
+    if (not p_root->m_right) return p_root->m_left;
+
+    // the in-order successor moves up in place of the removed node
+    auto [v_right, v_next] = take_min(p_root->m_right);
+
+    return balance(v_next.get(), p_root->m_left, std::move(v_right));
+}
+
+
+//
+template <persistent_key T>
+auto persistent_search_tree<T>::take_min(link_type const& p_root) -> std::pair<link_type, link_type>
+{
+    if (not p_root->m_left) return {p_root->m_right, p_root};
+
+    auto [v_left, v_min] = take_min(p_root->m_left);
+
+    return {balance(p_root.get(), std::move(v_left), p_root->m_right), std::move(v_min)};
+}
+
+
+
+//
+template class persistent_snapshot<int>;
+template class persistent_snapshot<char>;
+template class persistent_snapshot<long>;
+template class persistent_snapshot<short>;
+template class persistent_snapshot<unsigned int>;
+template class persistent_snapshot<unsigned char>;
+template class persistent_snapshot<unsigned long>;
+template class persistent_snapshot<unsigned short>;
+template class persistent_snapshot<float>;
+template class persistent_snapshot<double>;
+template class persistent_snapshot<std::string>;
+
+//
+template class persistent_search_tree<int>;
+template class persistent_search_tree<char>;
+template class persistent_search_tree<long>;
+template class persistent_search_tree<short>;
+template class persistent_search_tree<unsigned int>;
+template class persistent_search_tree<unsigned char>;
+template class persistent_search_tree<unsigned long>;
+template class persistent_search_tree<unsigned short>;
+template class persistent_search_tree<float>;
+template class persistent_search_tree<double>;
+template class persistent_search_tree<std::string>;
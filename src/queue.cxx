@@ -4,58 +4,85 @@
 
 // start queue
 //  
-template <class T>
-queue<T>::queue() noexcept(std::is_nothrow_default_constructible<T>::value)
-    : m_head( new(std::nothrow) node_type{} )
+template <class T, class Allocator>
+queue<T, Allocator>::queue() noexcept(std::is_nothrow_default_constructible<T>::value &&
+                                      std::is_nothrow_default_constructible<Allocator>::value)
+    : queue(Allocator())
+{}
+
+
+//  
+template <class T, class Allocator>
+queue<T, Allocator>::queue(Allocator const& p_alloc) noexcept(std::is_nothrow_default_constructible<T>::value)
+    : m_alloc( p_alloc )
+    , m_head( allocate_node<node_type>(m_alloc) )
     , m_size( 0ul )
 {}
 
  
 //  
-template <class T>
-queue<T>::queue(queue const& p_outer)
-    noexcept(std::is_nothrow_copy_constructible<T>::value) : queue()
+template <class T, class Allocator>
+queue<T, Allocator>::queue(queue const& p_outer)
+    noexcept(std::is_nothrow_copy_constructible<T>::value &&
+             std::is_nothrow_default_constructible<Allocator>::value)
+    : queue(p_outer, alloc_traits::select_on_container_copy_construction(p_outer.get_allocator()))
+{}
+
+
+//  
+template <class T, class Allocator>
+queue<T, Allocator>::queue(queue const& p_outer, Allocator const& p_alloc)
+    noexcept(std::is_nothrow_copy_constructible<T>::value) : queue(p_alloc)
 {
+    if ( (m_head == nullptr) || (p_outer.m_head == nullptr) ) return;
+
     node_type* v_curr = p_outer.m_head->m_next;
     node_type* v_node = nullptr;
 
     while (v_curr != p_outer.m_head)
     {
-        v_node = new(std::nothrow) node_type(v_curr->m_data);
+        v_node = allocate_node<node_type>(m_alloc, v_curr->m_data);
         
         if ( v_node == nullptr ) break;
 
         m_head->push_back(v_node);
         v_curr = v_curr->m_next;
+        m_size = m_size + 1ul;
     }
- 
-
-    m_size = p_outer.m_size;
 }
 
 
 //  
-template <class T>
-queue<T>::queue(queue&& p_outer)  noexcept(true) : queue()
+template <class T, class Allocator>
+queue<T, Allocator>::queue(queue&& p_outer)  noexcept(true) : queue(p_outer.get_allocator())
 {
     swap(*this, p_outer);
 }
 
 
 //  
-template <class T>
-auto queue<T>::operator=(queue p_rhs)
+template <class T, class Allocator>
+auto queue<T, Allocator>::operator=(queue p_rhs)
     noexcept(std::is_nothrow_copy_constructible<T>::value) -> queue &
 {
-    swap(*this, p_rhs);
+    // nodes may only change hands between equal allocators
+    if (alloc_traits::propagate_on_container_swap::value or (get_allocator() == p_rhs.get_allocator()))
+    {
+        swap(*this, p_rhs);
+    }
+    else {
+        queue v_copy(p_rhs, get_allocator());
+
+        swap(*this, v_copy);
+    }
 
     return *this;
 }
 
 
 //  
-template <class T>
-void queue<T>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
+template <class T, class Allocator>
+void queue<T, Allocator>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
 {
     assert(not empty());
 
@@ -64,31 +91,47 @@ void queue<T>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
     m_head->m_next         = v_curr->m_next;
     v_curr->m_next->m_prev = m_head;
 
-    v_curr = (delete v_curr, nullptr);
+    v_curr = (deallocate_node(m_alloc, v_curr), nullptr);
 
     m_size = m_size - 1ul;
 }
 
  
 //  
-template <class T>
-void queue<T>::pop() noexcept(std::is_nothrow_destructible<T>::value)
+template <class T, class Allocator>
+void queue<T, Allocator>::pop() noexcept(std::is_nothrow_destructible<T>::value)
 {
     pop_front();
 }
 
+
+//  
+template <class T, class Allocator>
+auto queue<T, Allocator>::try_pop() noexcept(std::is_nothrow_move_constructible<T>::value)
+    -> std::optional<typename queue::value_type>
+{
+    if (empty()) return std::nullopt;
+
+    // one move out, the moved-from husk goes with the pop
+    std::optional<value_type> v_value {std::move(m_head->m_next->m_data)};
+
+    pop_front();
+
+    return v_value;
+}
+
  
 //  
-template <class T>
-[[nodiscard]] auto queue<T>::empty() const noexcept(true) -> bool
+template <class T, class Allocator>
+[[nodiscard]] auto queue<T, Allocator>::empty() const noexcept(true) -> bool
 {
     return ((m_head == m_head->m_prev) && (m_head == m_head->m_next));
 }
 
  
 //  
-template <class T>
-[[nodiscard]] auto queue<T>::size() const noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto queue<T, Allocator>::size() const noexcept(true)
     -> typename queue::size_type
 {
     return m_size;
@@ -96,16 +139,16 @@ template <class T>
 
  
 //  
-template <class T>
-[[nodiscard]] auto queue<T>::peek() const noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto queue<T, Allocator>::peek() const noexcept(true)
     -> std::optional<typename queue::value_type>
 {
     return not empty()  ? std::optional{m_head->m_next->data()}
                         : std::nullopt;
 }
 //  
-template <class T>
-[[nodiscard]] auto queue<T>::peek() noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto queue<T, Allocator>::peek() noexcept(true)
     -> std::optional<typename queue::value_type>
 {
     return not empty()  ? std::optional{m_head->m_next->data()}
@@ -114,8 +157,8 @@ template <class T>
 
   
 //  
-template <class T>
-[[nodiscard]] auto queue<T>::front() noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto queue<T, Allocator>::front() noexcept(true)
     -> std::optional<typename queue::value_type>
 {
     return peek();
@@ -123,8 +166,8 @@ template <class T>
 
 
 //  
-template <class T>
-[[nodiscard]] auto queue<T>::front() const noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto queue<T, Allocator>::front() const noexcept(true)
     -> std::optional<typename queue::value_type>
 {
     return peek();
@@ -132,8 +175,8 @@ template <class T>
 
  
 //  
-template <class T>
-[[nodiscard]] auto queue<T>::back() noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto queue<T, Allocator>::back() noexcept(true)
     -> std::optional<typename queue::value_type>
 {
     return not empty()  ? std::optional{m_head->m_prev->data()}
@@ -142,25 +185,92 @@ template <class T>
 
 
 //  
-template <class T>
-[[nodiscard]] auto queue<T>::back() const noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto queue<T, Allocator>::back() const noexcept(true)
     -> std::optional<typename queue::value_type>
 {
     return not empty()  ? std::optional{m_head->m_prev->data()}
                         : std::nullopt;
 }
 
+
+//  
+template <class T, class Allocator>
+[[nodiscard]] auto queue<T, Allocator>::front_ptr() const noexcept(true)
+    -> typename queue::const_pointer
+{
+    return not empty()  ? std::addressof(m_head->m_next->m_data)
+                        : nullptr;
+}
+
+
+//  
+template <class T, class Allocator>
+[[nodiscard]] auto queue<T, Allocator>::front_ptr() noexcept(true)
+    -> typename queue::pointer
+{
+    return not empty()  ? std::addressof(m_head->m_next->m_data)
+                        : nullptr;
+}
+
+
+//  
+template <class T, class Allocator>
+[[nodiscard]] auto queue<T, Allocator>::back_ptr() const noexcept(true)
+    -> typename queue::const_pointer
+{
+    return not empty()  ? std::addressof(m_head->m_prev->m_data)
+                        : nullptr;
+}
+
+
+//  
+template <class T, class Allocator>
+[[nodiscard]] auto queue<T, Allocator>::back_ptr() noexcept(true)
+    -> typename queue::pointer
+{
+    return not empty()  ? std::addressof(m_head->m_prev->m_data)
+                        : nullptr;
+}
+
+
+//  
+template <class T, class Allocator>
+auto queue<T, Allocator>::get_allocator() const noexcept(true)
+    -> typename queue::allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
  
 //  
-template <class T>
-queue<T>::~queue() noexcept(std::is_nothrow_destructible<T>::value)
+template <class T, class Allocator>
+void queue<T, Allocator>::reserve(size_type p_count) requires(node_pooling<node_allocator_type>)
+{
+    m_alloc.reserve(p_count > m_size ? p_count - m_size : 0ul);
+}
+
+
+//  
+template <class T, class Allocator>
+void queue<T, Allocator>::shrink_to_fit() noexcept(true) requires(node_pooling<node_allocator_type>)
+{
+    m_alloc.shrink_to_fit();
+}
+
+
+//  
+template <class T, class Allocator>
+queue<T, Allocator>::~queue() noexcept(std::is_nothrow_destructible<T>::value)
 {
+    if (m_head == nullptr) return;
+
     while (not empty())
     {
         pop_front();
     }
 
-    m_head = (delete m_head, nullptr);
+    m_head = (deallocate_node(m_alloc, m_head), nullptr);
 }
 //  
 
@@ -175,5 +285,30 @@ template class queue<unsigned long>;
 template class queue<unsigned short>;
 template class queue<float>;
 template class queue<double>;
+template class queue<std::string>;
+
+//  
+template class queue<int, std::pmr::polymorphic_allocator<int>>;
+template class queue<char, std::pmr::polymorphic_allocator<char>>;
+template class queue<long, std::pmr::polymorphic_allocator<long>>;
+template class queue<short, std::pmr::polymorphic_allocator<short>>;
+template class queue<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class queue<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class queue<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class queue<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class queue<float, std::pmr::polymorphic_allocator<float>>;
+template class queue<double, std::pmr::polymorphic_allocator<double>>;
+
+//  
+template class queue<int, pool_allocator<int>>;
+template class queue<char, pool_allocator<char>>;
+template class queue<long, pool_allocator<long>>;
+template class queue<short, pool_allocator<short>>;
+template class queue<unsigned int, pool_allocator<unsigned int>>;
+template class queue<unsigned char, pool_allocator<unsigned char>>;
+template class queue<unsigned long, pool_allocator<unsigned long>>;
+template class queue<unsigned short, pool_allocator<unsigned short>>;
+template class queue<float, pool_allocator<float>>;
+template class queue<double, pool_allocator<double>>;
 //  
 //  
\ No newline at end of file
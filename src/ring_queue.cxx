@@ -0,0 +1,404 @@
+
+#include <ds/ring_queue.hxx>
+
+
+// start ring_queue
+//
+template <class T, class Allocator>
+ring_queue<T, Allocator>::ring_queue() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+    : ring_queue(Allocator())
+{}
+
+
+//
+template <class T, class Allocator>
+ring_queue<T, Allocator>::ring_queue(Allocator const& p_alloc) noexcept(true)
+    : m_alloc( p_alloc )
+{}
+
+
+//
+template <class T, class Allocator>
+ring_queue<T, Allocator>::ring_queue(fixed_capacity_t, size_type p_capacity, Allocator const& p_alloc) noexcept(true)
+    : ring_queue(p_alloc)
+{
+    // fixed even when the ring could not be allocated: pushes are then dropped, never grown into
+    m_fixed = true;
+
+    if ( p_capacity ) static_cast<void>(relocate(std::bit_ceil(p_capacity)));
+}
+
+
+//
+template <class T, class Allocator>
+ring_queue<T, Allocator>::ring_queue(ring_queue const& p_outer)
+    noexcept(std::is_nothrow_copy_constructible<T>::value &&
+             std::is_nothrow_default_constructible<Allocator>::value)
+    : ring_queue(p_outer, alloc_traits::select_on_container_copy_construction(p_outer.get_allocator()))
+{}
+
+
+//
+template <class T, class Allocator>
+ring_queue<T, Allocator>::ring_queue(ring_queue const& p_outer, Allocator const& p_alloc)
+    noexcept(std::is_nothrow_copy_constructible<T>::value) : ring_queue(p_alloc)
+{
+    // a fixed ring stays fixed ( and the same size ) in the copy
+    const size_type v_capacity = p_outer.m_fixed ? p_outer.m_capacity
+                                                 : p_outer.m_size ? std::bit_ceil(p_outer.m_size) : 0ul;
+
+    m_fixed = p_outer.m_fixed;
+
+    if ( (v_capacity == 0ul) || (not relocate(v_capacity)) ) return;
+
+    for (size_type i = 0ul; i < p_outer.m_size; ++i)
+    {
+        push_back(p_outer.m_data[p_outer.slot(i)]);
+    }
+}
+
+
+//
+template <class T, class Allocator>
+ring_queue<T, Allocator>::ring_queue(ring_queue&& p_outer) noexcept(true) : ring_queue(p_outer.get_allocator())
+{
+    swap(*this, p_outer);
+}
+
+
+//
+template <class T, class Allocator>
+auto ring_queue<T, Allocator>::operator=(ring_queue p_rhs)
+    noexcept(std::is_nothrow_copy_constructible<T>::value) -> ring_queue &
+{
+    // the buffer may only change hands between equal allocators
+    if (alloc_traits::propagate_on_container_swap::value or (get_allocator() == p_rhs.get_allocator()))
+    {
+        swap(*this, p_rhs);
+    }
+    else {
+        ring_queue v_copy(p_rhs, get_allocator());
+
+        swap(*this, v_copy);
+    }
+
+    return *this;
+}
+
+
+//
+template <class T, class Allocator>
+void ring_queue<T, Allocator>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    assert(not empty());
+
+    alloc_traits::destroy(m_alloc, m_data + m_head);
+
+    m_head = slot(1ul);
+    m_size = m_size - 1ul;
+}
+
+
+//
+template <class T, class Allocator>
+void ring_queue<T, Allocator>::pop() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    pop_front();
+}
+
+
+//
+template <class T, class Allocator>
+auto ring_queue<T, Allocator>::try_pop() noexcept(std::is_nothrow_move_constructible<T>::value)
+    -> std::optional<typename ring_queue::value_type>
+{
+    if (empty()) return std::nullopt;
+
+    // one move out, the moved-from husk goes with the pop
+    std::optional<value_type> v_value {std::move(m_data[m_head])};
+
+    pop_front();
+
+    return v_value;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::empty() const noexcept(true) -> bool
+{
+    return (m_size == 0ul);
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::full() const noexcept(true) -> bool
+{
+    return (m_size == m_capacity);
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::size() const noexcept(true)
+    -> typename ring_queue::size_type
+{
+    return m_size;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::capacity() const noexcept(true)
+    -> typename ring_queue::size_type
+{
+    return m_capacity;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::is_fixed() const noexcept(true) -> bool
+{
+    return m_fixed;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::peek() const noexcept(true)
+    -> std::optional<typename ring_queue::value_type>
+{
+    return not empty()  ? std::optional{m_data[m_head]}
+                        : std::nullopt;
+}
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::peek() noexcept(true)
+    -> std::optional<typename ring_queue::value_type>
+{
+    return not empty()  ? std::optional{m_data[m_head]}
+                        : std::nullopt;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::front() noexcept(true)
+    -> std::optional<typename ring_queue::value_type>
+{
+    return peek();
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::front() const noexcept(true)
+    -> std::optional<typename ring_queue::value_type>
+{
+    return peek();
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::back() noexcept(true)
+    -> std::optional<typename ring_queue::value_type>
+{
+    return not empty()  ? std::optional{m_data[slot(m_size - 1ul)]}
+                        : std::nullopt;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::back() const noexcept(true)
+    -> std::optional<typename ring_queue::value_type>
+{
+    return not empty()  ? std::optional{m_data[slot(m_size - 1ul)]}
+                        : std::nullopt;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::front_ptr() const noexcept(true)
+    -> typename ring_queue::const_pointer
+{
+    return not empty()  ? m_data + m_head
+                        : nullptr;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::front_ptr() noexcept(true)
+    -> typename ring_queue::pointer
+{
+    return not empty()  ? m_data + m_head
+                        : nullptr;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::back_ptr() const noexcept(true)
+    -> typename ring_queue::const_pointer
+{
+    return not empty()  ? m_data + slot(m_size - 1ul)
+                        : nullptr;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto ring_queue<T, Allocator>::back_ptr() noexcept(true)
+    -> typename ring_queue::pointer
+{
+    return not empty()  ? m_data + slot(m_size - 1ul)
+                        : nullptr;
+}
+
+
+//
+template <class T, class Allocator>
+void ring_queue<T, Allocator>::reserve(size_type p_count) noexcept(true)
+{
+    if ( m_fixed || (p_count <= m_capacity) ) return;
+
+    static_cast<void>(relocate(std::bit_ceil(p_count)));
+}
+
+
+//
+template <class T, class Allocator>
+void ring_queue<T, Allocator>::shrink_to_fit() noexcept(true)
+{
+    if ( m_fixed ) return;
+
+    const size_type v_capacity = m_size ? std::bit_ceil(m_size) : 0ul;
+
+    if ( v_capacity < m_capacity ) static_cast<void>(relocate(v_capacity));
+}
+
+
+//
+template <class T, class Allocator>
+auto ring_queue<T, Allocator>::get_allocator() const noexcept(true)
+    -> typename ring_queue::allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
+
+//
+template <class T, class Allocator>
+auto ring_queue<T, Allocator>::make_room() noexcept(true) -> bool
+{
+    if ( m_size < m_capacity ) return true;
+
+    if ( m_fixed ) return false;
+
+    return relocate( m_capacity ? (m_capacity << 1ul) : initial_capacity );
+}
+
+
+//
+template <class T, class Allocator>
+auto ring_queue<T, Allocator>::relocate(size_type p_capacity) noexcept(true) -> bool
+{
+    T* v_data = nullptr;
+
+    if ( p_capacity )
+    {
+        try {
+            v_data = alloc_traits::allocate(m_alloc, p_capacity);
+        }
+        catch (...) {
+            stats_failed<ring_queue>();
+            return false;
+        }
+
+        stats_allocated<ring_queue>();
+    }
+
+    size_type v_done = 0ul;
+
+    // unwrap into [ 0, size ); copies stand in for moves that may throw
+    try {
+        for (; v_done < m_size; ++v_done)
+        {
+            alloc_traits::construct(m_alloc, v_data + v_done, std::move_if_noexcept(m_data[slot(v_done)]));
+        }
+    }
+    catch (...) {
+        while (v_done) alloc_traits::destroy(m_alloc, v_data + --v_done);
+
+        alloc_traits::deallocate(m_alloc, v_data, p_capacity);
+        stats_freed<ring_queue>();
+        return false;
+    }
+
+    for (size_type i = 0ul; i < m_size; ++i)
+    {
+        alloc_traits::destroy(m_alloc, m_data + slot(i));
+    }
+
+    if ( m_data )
+    {
+        alloc_traits::deallocate(m_alloc, m_data, m_capacity);
+        stats_freed<ring_queue>();
+    }
+
+    m_data     = v_data;
+    m_capacity = p_capacity;
+    m_head     = 0ul;
+
+    return true;
+}
+
+
+//
+template <class T, class Allocator>
+ring_queue<T, Allocator>::~ring_queue() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    while (not empty())
+    {
+        pop_front();
+    }
+
+    if ( m_data )
+    {
+        m_data = (alloc_traits::deallocate(m_alloc, m_data, m_capacity), nullptr);
+        stats_freed<ring_queue>();
+    }
+}
+//
+
+//
+template class ring_queue<int>;
+template class ring_queue<char>;
+template class ring_queue<long>;
+template class ring_queue<short>;
+template class ring_queue<unsigned int>;
+template class ring_queue<unsigned char>;
+template class ring_queue<unsigned long>;
+template class ring_queue<unsigned short>;
+template class ring_queue<float>;
+template class ring_queue<double>;
+template class ring_queue<std::string>;
+
+//
+template class ring_queue<int, std::pmr::polymorphic_allocator<int>>;
+template class ring_queue<char, std::pmr::polymorphic_allocator<char>>;
+template class ring_queue<long, std::pmr::polymorphic_allocator<long>>;
+template class ring_queue<short, std::pmr::polymorphic_allocator<short>>;
+template class ring_queue<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class ring_queue<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class ring_queue<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class ring_queue<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class ring_queue<float, std::pmr::polymorphic_allocator<float>>;
+template class ring_queue<double, std::pmr::polymorphic_allocator<double>>;
+//
+//
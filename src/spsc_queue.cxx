@@ -0,0 +1,167 @@
+
+#include <ds/spsc_queue.hxx>
+
+
+// start spsc_queue
+//
+template <class T, class Allocator>
+spsc_queue<T, Allocator>::spsc_queue(size_type p_capacity, Allocator const& p_alloc) noexcept(true)
+    : m_alloc( p_alloc )
+{
+    const size_type v_capacity = std::bit_ceil(std::max(p_capacity, size_type {2ul}));
+
+    try {
+        m_data = alloc_traits::allocate(m_alloc, v_capacity);
+    }
+    catch (...) {
+        stats_failed<spsc_queue>();
+        return;
+    }
+
+    stats_allocated<spsc_queue>();
+
+    m_capacity = v_capacity;
+}
+
+
+//
+template <class T, class Allocator>
+auto spsc_queue<T, Allocator>::try_pop() noexcept(std::is_nothrow_move_constructible<T>::value)
+    -> std::optional<typename spsc_queue::value_type>
+{
+    const size_type v_head = m_head.load(std::memory_order_relaxed);
+
+    if (ready_slots(v_head, 1ul) == 0ul) return std::nullopt;
+
+    T* v_elem = slot(v_head);
+
+    std::optional<value_type> v_value {std::move(*v_elem)};
+
+    alloc_traits::destroy(m_alloc, v_elem);
+
+    m_head.store(v_head + 1ul, std::memory_order_release);
+
+    return v_value;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto spsc_queue<T, Allocator>::empty() const noexcept(true) -> bool
+{
+    return (size() == 0ul);
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto spsc_queue<T, Allocator>::size() const noexcept(true)
+    -> typename spsc_queue::size_type
+{
+    // head first: a tail read afterwards can only be larger, never behind
+    const size_type v_head = m_head.load(std::memory_order_acquire);
+    const size_type v_tail = m_tail.load(std::memory_order_acquire);
+
+    return (v_tail - v_head);
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto spsc_queue<T, Allocator>::capacity() const noexcept(true)
+    -> typename spsc_queue::size_type
+{
+    return m_capacity;
+}
+
+
+//
+template <class T, class Allocator>
+auto spsc_queue<T, Allocator>::get_allocator() const noexcept(true)
+    -> typename spsc_queue::allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
+
+//
+template <class T, class Allocator>
+auto spsc_queue<T, Allocator>::free_slots(size_type p_tail, size_type p_wanted) noexcept(true)
+    -> size_type
+{
+    size_type v_free = m_capacity - (p_tail - m_head_cache);
+
+    if (v_free < p_wanted)
+    {
+        m_head_cache = m_head.load(std::memory_order_acquire);
+
+        v_free = m_capacity - (p_tail - m_head_cache);
+    }
+
+    return v_free;
+}
+
+
+//
+template <class T, class Allocator>
+auto spsc_queue<T, Allocator>::ready_slots(size_type p_head, size_type p_wanted) noexcept(true)
+    -> size_type
+{
+    size_type v_ready = m_tail_cache - p_head;
+
+    if (v_ready < p_wanted)
+    {
+        m_tail_cache = m_tail.load(std::memory_order_acquire);
+
+        v_ready = m_tail_cache - p_head;
+    }
+
+    return v_ready;
+}
+
+
+//
+template <class T, class Allocator>
+spsc_queue<T, Allocator>::~spsc_queue() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    if (m_data == nullptr) return;
+
+    const size_type v_tail = m_tail.load(std::memory_order_acquire);
+
+    for (size_type i = m_head.load(std::memory_order_acquire); i != v_tail; ++i)
+    {
+        alloc_traits::destroy(m_alloc, slot(i));
+    }
+
+    if ( m_data ) stats_freed<spsc_queue>();
+
+    m_data = (alloc_traits::deallocate(m_alloc, m_data, m_capacity), nullptr);
+}
+//
+
+//
+template class spsc_queue<int>;
+template class spsc_queue<char>;
+template class spsc_queue<long>;
+template class spsc_queue<short>;
+template class spsc_queue<unsigned int>;
+template class spsc_queue<unsigned char>;
+template class spsc_queue<unsigned long>;
+template class spsc_queue<unsigned short>;
+template class spsc_queue<float>;
+template class spsc_queue<double>;
+template class spsc_queue<std::string>;
+
+//
+template class spsc_queue<int, std::pmr::polymorphic_allocator<int>>;
+template class spsc_queue<char, std::pmr::polymorphic_allocator<char>>;
+template class spsc_queue<long, std::pmr::polymorphic_allocator<long>>;
+template class spsc_queue<short, std::pmr::polymorphic_allocator<short>>;
+template class spsc_queue<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class spsc_queue<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class spsc_queue<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class spsc_queue<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class spsc_queue<float, std::pmr::polymorphic_allocator<float>>;
+template class spsc_queue<double, std::pmr::polymorphic_allocator<double>>;
+//
+//
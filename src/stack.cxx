@@ -4,64 +4,83 @@
 // star stack
 //  
 //  
-template <class T>
-stack<T>::stack() noexcept(true) = default;
+template <class T, class Allocator>
+stack<T, Allocator>::stack() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+    : stack(Allocator())
+{}
 
 
 //  
-template <class T>
-stack<T>::stack(stack const &p_outer)
-    noexcept(std::is_nothrow_copy_constructible<T>::value) : stack()
-{
-    node_type* v_curr   = p_outer.m_head;
+template <class T, class Allocator>
+stack<T, Allocator>::stack(Allocator const &p_alloc) noexcept(true)
+    : m_alloc(p_alloc)
+{}
 
-    if ( auto v_node = new(std::nothrow) node_type{v_curr->m_data, nullptr})
-    {
-        node_type* v_tracer = nullptr;
 
-        m_head   = v_node;
-        v_curr   = v_curr->m_next;
-        v_tracer = m_head;
+//  
+template <class T, class Allocator>
+stack<T, Allocator>::stack(stack const &p_outer)
+    noexcept(std::is_nothrow_copy_constructible<T>::value &&
+             std::is_nothrow_default_constructible<Allocator>::value)
+    : stack(p_outer, alloc_traits::select_on_container_copy_construction(p_outer.get_allocator()))
+{}
+
 
-        while (v_curr)
-        {
-            v_node = new(std::nothrow) node_type{v_curr->m_data, nullptr};
+//  
+template <class T, class Allocator>
+stack<T, Allocator>::stack(stack const &p_outer, Allocator const &p_alloc)
+    noexcept(std::is_nothrow_copy_constructible<T>::value) : stack(p_alloc)
+{
+    node_type* v_curr   = p_outer.m_head;
+    node_type* v_tracer = nullptr;
 
-            if (v_node == nullptr) break;
+    while (v_curr)
+    {
+        node_type* v_node = allocate_node<node_type>(m_alloc, v_curr->m_data, nullptr);
 
-            v_tracer->m_next = v_node;
-            v_tracer         = v_tracer->m_next;
-            v_curr           = v_curr->m_next;
-        }
+        if (v_node == nullptr) break;
 
-        m_size = p_outer.m_size;
+        if (v_tracer) v_tracer->m_next = v_node;
+        else          m_head           = v_node;
 
+        v_tracer = v_node;
+        v_curr   = v_curr->m_next;
+        m_size   = m_size + 1ul;
     }
 }
 
 
 //  
-template <class T>
-stack<T>::stack(stack &&p_outer) noexcept(true) : stack()
+template <class T, class Allocator>
+stack<T, Allocator>::stack(stack &&p_outer) noexcept(true) : stack(p_outer.get_allocator())
 {
     swap(*this, p_outer);
 }
 
 
 //  
-template <class T>
-stack<T> &stack<T>::operator=(stack p_rhs)
-    noexcept(std::is_nothrow_copy_constructible<T>::value)
+template <class T, class Allocator>
+auto stack<T, Allocator>::operator=(stack p_rhs)
+    noexcept(std::is_nothrow_copy_constructible<T>::value) -> stack &
 {
-    swap(*this, p_rhs);
+    // nodes may only change hands between equal allocators
+    if (alloc_traits::propagate_on_container_swap::value or (get_allocator() == p_rhs.get_allocator()))
+    {
+        swap(*this, p_rhs);
+    }
+    else {
+        stack v_copy(p_rhs, get_allocator());
+
+        swap(*this, v_copy);
+    }
 
     return *this;
 }
 
 
 //  
-template <class T>
-void stack<T>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
+template <class T, class Allocator>
+void stack<T, Allocator>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
 {
     assert(not empty());
 
@@ -69,31 +88,47 @@ void stack<T>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
 
     m_head = m_head->m_next;
 
-    v_curr = (delete v_curr, nullptr);
+    v_curr = (deallocate_node(m_alloc, v_curr), nullptr);
 
     m_size = m_size - 1ul;
 }
 
 
 //  
-template <class T>
-void stack<T>::pop() noexcept(std::is_nothrow_destructible<T>::value)
+template <class T, class Allocator>
+void stack<T, Allocator>::pop() noexcept(std::is_nothrow_destructible<T>::value)
 {
     pop_front();
 }
 
 
 //  
-template <class T>
-[[nodiscard]] auto stack<T>::empty() const noexcept(true) -> bool
+template <class T, class Allocator>
+auto stack<T, Allocator>::try_pop() noexcept(std::is_nothrow_move_constructible<T>::value)
+    -> std::optional<typename stack::value_type>
+{
+    if (empty()) return std::nullopt;
+
+    // one move out, the moved-from husk goes with the pop
+    std::optional<value_type> v_value {std::move(m_head->m_data)};
+
+    pop_front();
+
+    return v_value;
+}
+
+
+//  
+template <class T, class Allocator>
+[[nodiscard]] auto stack<T, Allocator>::empty() const noexcept(true) -> bool
 {
     return (m_head == nullptr);
 }
 
 
 //  
-template <class T>
-[[nodiscard]] auto stack<T>::size() const noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto stack<T, Allocator>::size() const noexcept(true)
     -> typename stack::size_type
 {
     return m_size;
@@ -103,8 +138,8 @@ template <class T>
 
 //  
 //  
-template <class T>
-[[nodiscard]] auto stack<T>::peep() const noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto stack<T, Allocator>::peep() const noexcept(true)
     -> std::optional<typename stack::value_type>
 {
     return (not empty() ? std::optional{m_head->data()}
@@ -113,8 +148,8 @@ template <class T>
 
 
 //  
-template <class T>
-[[nodiscard]] auto stack<T>::peep() noexcept(true)
+template <class T, class Allocator>
+[[nodiscard]] auto stack<T, Allocator>::peep() noexcept(true)
     -> std::optional<typename stack::value_type>
 {
     return (not empty() ? std::optional{m_head->data()}
@@ -123,8 +158,53 @@ template <class T>
 
 
 //  
-template <class T>
-stack<T>::~stack() noexcept(std::is_nothrow_destructible<T>::value)
+template <class T, class Allocator>
+[[nodiscard]] auto stack<T, Allocator>::peep_ptr() const noexcept(true)
+    -> typename stack::const_pointer
+{
+    return not empty()  ? std::addressof(m_head->m_data)
+                        : nullptr;
+}
+
+
+//  
+template <class T, class Allocator>
+[[nodiscard]] auto stack<T, Allocator>::peep_ptr() noexcept(true)
+    -> typename stack::pointer
+{
+    return not empty()  ? std::addressof(m_head->m_data)
+                        : nullptr;
+}
+
+
+//  
+template <class T, class Allocator>
+auto stack<T, Allocator>::get_allocator() const noexcept(true)
+    -> typename stack::allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
+
+//  
+template <class T, class Allocator>
+void stack<T, Allocator>::reserve(size_type p_count) requires(node_pooling<node_allocator_type>)
+{
+    m_alloc.reserve(p_count > m_size ? p_count - m_size : 0ul);
+}
+
+
+//  
+template <class T, class Allocator>
+void stack<T, Allocator>::shrink_to_fit() noexcept(true) requires(node_pooling<node_allocator_type>)
+{
+    m_alloc.shrink_to_fit();
+}
+
+
+//  
+template <class T, class Allocator>
+stack<T, Allocator>::~stack() noexcept(std::is_nothrow_destructible<T>::value)
 {
     while (not empty())
     {
@@ -149,5 +229,30 @@ template class stack<unsigned long>;
 template class stack<unsigned short>;
 template class stack<float>;
 template class stack<double>;
+template class stack<std::string>;
+
+//  
+template class stack<int, std::pmr::polymorphic_allocator<int>>;
+template class stack<char, std::pmr::polymorphic_allocator<char>>;
+template class stack<long, std::pmr::polymorphic_allocator<long>>;
+template class stack<short, std::pmr::polymorphic_allocator<short>>;
+template class stack<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class stack<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class stack<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class stack<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class stack<float, std::pmr::polymorphic_allocator<float>>;
+template class stack<double, std::pmr::polymorphic_allocator<double>>;
+
+//  
+template class stack<int, pool_allocator<int>>;
+template class stack<char, pool_allocator<char>>;
+template class stack<long, pool_allocator<long>>;
+template class stack<short, pool_allocator<short>>;
+template class stack<unsigned int, pool_allocator<unsigned int>>;
+template class stack<unsigned char, pool_allocator<unsigned char>>;
+template class stack<unsigned long, pool_allocator<unsigned long>>;
+template class stack<unsigned short, pool_allocator<unsigned short>>;
+template class stack<float, pool_allocator<float>>;
+template class stack<double, pool_allocator<double>>;
 //  
 //  
\ No newline at end of file
@@ -0,0 +1,197 @@
+//  --------------------------------------------
+//  --------------------------------------------
+        #include <ds/static_search_set.hxx>
+//  --------------------------------------------
+//  --------------------------------------------
+
+
+// start static_search_set
+
+
+
+//
+template <std::totally_ordered T>
+static_search_set<T>::static_search_set() noexcept(true) = default;
+
+
+//
+template <std::totally_ordered T>
+static_search_set<T>::static_search_set(std::initializer_list<T> p_list)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+    : static_search_set()
+{
+    std::vector<T> v_sorted(p_list);
+
+    std::ranges::sort(v_sorted);
+
+    assign_sorted(std::make_move_iterator(v_sorted.begin()), v_sorted.size());
+}
+
+
+//
+template <std::totally_ordered T>
+static_search_set<T>::static_search_set(static_search_set const& p_outer)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+    : static_search_set()
+{
+    if ((p_outer.m_size == 0ul) || (not allocate(p_outer.m_size))) return;
+
+    // uninitialized_copy_n undoes its own partial copy; m_size stays 0 until it is done
+    if constexpr (std::is_nothrow_copy_constructible<T>::value)
+    {
+        std::uninitialized_copy_n(p_outer.m_keys + 1, p_outer.m_size, m_keys + 1);
+    }
+    else {
+        try {
+            std::uninitialized_copy_n(p_outer.m_keys + 1, p_outer.m_size, m_keys + 1);
+        }
+        catch (...) {
+            deallocate();
+            throw;
+        }
+    }
+
+    m_size = p_outer.m_size;
+}
+
+
+//
+template <std::totally_ordered T>
+static_search_set<T>::static_search_set(static_search_set&& p_outer) noexcept(true)
+    : static_search_set()
+{
+    swap(*this, p_outer);
+}
+
+
+//
+template <std::totally_ordered T>
+auto static_search_set<T>::operator=(static_search_set p_rhs) noexcept(true) -> static_search_set&
+{
+    swap(*this, p_rhs);
+
+    return *this;
+}
+
+
+//
+template <std::totally_ordered T>
+auto static_search_set<T>::search(T const& p_key) const noexcept(true)
+    -> std::optional<typename static_search_set::value_type>
+{
+    const_pointer v_found = find(p_key);
+
+    return (v_found != nullptr) ? std::optional<value_type>(*v_found) : std::nullopt;
+}
+
+
+//
+template <std::totally_ordered T>
+auto static_search_set<T>::empty() const noexcept(true) -> bool
+{
+    return (m_size == 0ul);
+}
+
+
+//
+template <std::totally_ordered T>
+auto static_search_set<T>::size() const noexcept(true) -> size_type
+{
+    return m_size;
+}
+
+
+//
+template <std::totally_ordered T>
+auto static_search_set<T>::max() const noexcept(true) -> std::optional<value_type>
+{
+    if (m_size == 0ul) return std::nullopt;
+
+    // rightmost slot: keep taking the right child
+    size_type v_slot = 1ul;
+
+    while (((2ul * v_slot) + 1ul) <= m_size) v_slot = (2ul * v_slot) + 1ul;
+
+    return m_keys[v_slot];
+}
+
+
+//
+template <std::totally_ordered T>
+auto static_search_set<T>::min() const noexcept(true) -> std::optional<value_type>
+{
+    if (m_size == 0ul) return std::nullopt;
+
+    // leftmost slot: the highest power of two in range
+    return m_keys[std::bit_floor(m_size)];
+}
+
+
+//
+template <std::totally_ordered T>
+static_search_set<T>::~static_search_set() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    if (m_keys == nullptr) return;
+
+    std::destroy_n(m_keys + 1, m_size);
+
+    deallocate();
+}
+
+
+//
+template <std::totally_ordered T>
+auto static_search_set<T>::allocate(size_type p_count) noexcept(true) -> bool
+{
+    // line aligned, so the root and its first descendants share one line
+    void* v_block = ::operator new[]((p_count + 1ul) * sizeof(T),
+                                     std::align_val_t {std::max(cache_line, alignof(T))},
+                                     std::nothrow);
+
+    m_keys = static_cast<T*>(v_block);
+
+    if (m_keys) stats_allocated<static_search_set>();
+    else        stats_failed<static_search_set>();
+
+    return (m_keys != nullptr);
+}
+
+
+//
+template <std::totally_ordered T>
+void static_search_set<T>::deallocate() noexcept(true)
+{
+    ::operator delete[](m_keys, std::align_val_t {std::max(cache_line, alignof(T))});
+
+    stats_freed<static_search_set>();
+
+    m_keys = nullptr;
+}
+
+
+//
+template <std::totally_ordered T>
+void static_search_set<T>::destroy_subtree(size_type p_slot, size_type p_count) noexcept(true)
+{
+    if (p_slot > p_count) return;
+
+    destroy_subtree(2ul * p_slot, p_count);
+    destroy_subtree((2ul * p_slot) + 1ul, p_count);
+
+    std::destroy_at(m_keys + p_slot);
+}
+
+
+
+//
+template class static_search_set<int>;
+template class static_search_set<char>;
+template class static_search_set<long>;
+template class static_search_set<short>;
+template class static_search_set<unsigned int>;
+template class static_search_set<unsigned char>;
+template class static_search_set<unsigned long>;
+template class static_search_set<unsigned short>;
+template class static_search_set<float>;
+template class static_search_set<double>;
+template class static_search_set<std::string>;
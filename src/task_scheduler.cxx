@@ -0,0 +1,173 @@
+
+#include <ds/task_scheduler.hxx>
+
+
+/** which scheduler the calling thread works for, and as which worker **/
+static thread_local task_scheduler const* t_scheduler = nullptr;
+static thread_local std::size_t           t_worker    = 0ul;
+
+
+// start task_scheduler
+//
+task_scheduler::task_scheduler(size_type p_workers) : m_inbox(inbox_capacity)
+{
+    const size_type v_workers = std::max(p_workers, size_type {1ul});
+
+    // every deque exists before the first thief looks at it
+    m_workers.reserve(v_workers);
+
+    for (size_type i = 0ul; i < v_workers; ++i)
+    {
+        m_workers.push_back(std::make_unique<worker>());
+    }
+
+    for (size_type i = 0ul; i < v_workers; ++i)
+    {
+        m_workers[i]->m_thread = std::thread(&task_scheduler::run, this, i);
+    }
+}
+
+
+//
+auto task_scheduler::workers() const noexcept(true) -> size_type
+{
+    return m_workers.size();
+}
+
+
+//
+void task_scheduler::schedule(task_type* p_task) noexcept(true)
+{
+    const size_type v_self = current_worker();
+
+    if (v_self != workers())
+    {
+        // a deque that can not grow leaves the task to its submitter
+        if (not m_workers[v_self]->m_deque.push(p_task)) return execute(p_task);
+    }
+    else if (m_inbox.capacity() != 0ul) {
+        m_inbox.push(static_cast<void*>(p_task));
+    }
+    else {
+        return execute(p_task);
+    }
+
+    wake_one();
+}
+
+
+//
+auto task_scheduler::find_task(size_type p_self) noexcept(true) -> task_type*
+{
+    const size_type v_workers = workers();
+
+    if (p_self != v_workers)
+    {
+        if (auto v_task = m_workers[p_self]->m_deque.pop()) return static_cast<task_type*>(*v_task);
+    }
+
+    if (auto v_task = m_inbox.try_pop()) return static_cast<task_type*>(*v_task);
+
+    // start right after ourselves, so thieves spread over the victims
+    for (size_type i = 1ul; i <= v_workers; ++i)
+    {
+        const size_type v_victim = (p_self + i) % v_workers;
+
+        if (v_victim == p_self) continue;
+
+        if (auto v_task = m_workers[v_victim]->m_deque.steal()) return static_cast<task_type*>(*v_task);
+    }
+
+    return nullptr;
+}
+
+
+//
+void task_scheduler::execute(task_type* p_task) noexcept(true)
+{
+    std::unique_ptr<task_type> v_task(p_task);
+
+    // a packaged_task: whatever the job throws lands in its future
+    (*v_task)();
+}
+
+
+//
+auto task_scheduler::current_worker() const noexcept(true) -> size_type
+{
+    return (t_scheduler == this) ? t_worker : workers();
+}
+
+
+//
+void task_scheduler::run(size_type p_self) noexcept(true)
+{
+    t_scheduler = this;
+    t_worker    = p_self;
+
+    while (true)
+    {
+        if (task_type* v_task = find_task(p_self))
+        {
+            execute(v_task);
+            continue;
+        }
+
+        // read the signal, then look once more: a submit in between changes the signal
+        const std::uint32_t v_seen = m_signal.load(std::memory_order_seq_cst);
+
+        if (task_type* v_task = find_task(p_self))
+        {
+            execute(v_task);
+            continue;
+        }
+
+        if (m_stop.load(std::memory_order_acquire)) break;
+
+        m_signal.wait(v_seen, std::memory_order_seq_cst);
+    }
+
+    t_scheduler = nullptr;
+}
+
+
+//
+void task_scheduler::help(size_type p_self) noexcept(true)
+{
+    if (task_type* v_task = find_task(p_self)) execute(v_task);
+    else                                       std::this_thread::yield();
+}
+
+
+//
+void task_scheduler::wake_one() noexcept(true)
+{
+    m_signal.fetch_add(1u, std::memory_order_seq_cst);
+    m_signal.notify_one();
+}
+
+
+//
+task_scheduler::~task_scheduler() noexcept(true)
+{
+    m_stop.store(true, std::memory_order_release);
+
+    m_signal.fetch_add(1u, std::memory_order_seq_cst);
+    m_signal.notify_all();
+
+    for (auto& v_worker : m_workers)
+    {
+        if (v_worker->m_thread.joinable()) v_worker->m_thread.join();
+    }
+}
+
+
+//
+auto shared_scheduler() -> task_scheduler&
+{
+    static task_scheduler s_scheduler;
+
+    return s_scheduler;
+}
+//
+//
@@ -0,0 +1,485 @@
+#include <ds/unrolled_forward_list.hxx>
+
+
+// start unrolled_forward_list
+//
+//
+template <class T, class Allocator>
+unrolled_forward_list<T, Allocator>::unrolled_forward_list() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+    : unrolled_forward_list(Allocator())
+{}
+
+
+//
+template <class T, class Allocator>
+unrolled_forward_list<T, Allocator>::unrolled_forward_list(Allocator const& p_alloc) noexcept(true)
+    : m_alloc(p_alloc)
+{}
+
+
+//
+template <class T, class Allocator>
+unrolled_forward_list<T, Allocator>::unrolled_forward_list(std::initializer_list<T> p_list, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+    : unrolled_forward_list(std::ranges::begin(p_list), std::ranges::end(p_list), p_alloc)
+{}
+
+
+//
+template <class T, class Allocator>
+unrolled_forward_list<T, Allocator>::unrolled_forward_list(unrolled_forward_list const& p_outer)
+        noexcept(std::is_nothrow_copy_constructible<T>::value &&
+                 std::is_nothrow_default_constructible<Allocator>::value)
+    : unrolled_forward_list(p_outer, alloc_traits::select_on_container_copy_construction(p_outer.get_allocator()))
+{}
+
+
+//
+template <class T, class Allocator>
+unrolled_forward_list<T, Allocator>::unrolled_forward_list(unrolled_forward_list const& p_outer, Allocator const& p_alloc)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+    : unrolled_forward_list(std::ranges::begin(p_outer), std::ranges::end(p_outer), p_alloc)
+{}
+
+
+//
+template <class T, class Allocator>
+unrolled_forward_list<T, Allocator>::unrolled_forward_list(unrolled_forward_list&& p_outer) noexcept(true)
+    : unrolled_forward_list(p_outer.get_allocator())
+{
+    swap(*this, p_outer);
+}
+
+
+//
+template <class T, class Allocator>
+auto unrolled_forward_list<T, Allocator>::operator=(unrolled_forward_list p_list)
+    noexcept(std::is_nothrow_copy_constructible<T>::value) -> unrolled_forward_list &
+{
+    // nodes may only change hands between equal allocators
+    if (alloc_traits::propagate_on_container_swap::value or (get_allocator() == p_list.get_allocator()))
+    {
+        swap(*this, p_list);
+    }
+    else {
+        unrolled_forward_list v_copy(p_list, get_allocator());
+
+        swap(*this, v_copy);
+    }
+
+    return *this;
+}
+
+
+//
+template <class T, class Allocator>
+void unrolled_forward_list<T, Allocator>::pop_front() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    assert(not empty());
+
+    Allocator v_alloc(m_alloc);
+
+    alloc_traits::destroy(v_alloc, m_head->at(m_head->first()));
+
+    close_slot(0ul);
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto unrolled_forward_list<T, Allocator>::front() const noexcept(true)
+    -> std::optional<typename unrolled_forward_list::value_type>
+{
+    return not empty()  ? std::optional{*m_head->at(m_head->first())}
+                        : std::nullopt;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto unrolled_forward_list<T, Allocator>::front() noexcept(true)
+    -> std::optional<typename unrolled_forward_list::value_type>
+{
+    return not empty()  ? std::optional{*m_head->at(m_head->first())}
+                        : std::nullopt;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto unrolled_forward_list<T, Allocator>::find(const_reference p_value) const noexcept(true)
+    -> typename unrolled_forward_list::iterator
+{
+    for (node_type* v_node = m_head; v_node; v_node = v_node->m_next)
+    {
+        const size_type v_slot = scan_find(v_node, p_value);
+
+        if (v_slot != node_capacity) return iterator{v_node, v_slot};
+    }
+
+    return end();
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto unrolled_forward_list<T, Allocator>::count(const_reference p_value) const noexcept(true)
+    -> typename unrolled_forward_list::size_type
+{
+    size_type v_count = 0ul;
+
+    for (node_type const* v_node = m_head; v_node; v_node = v_node->m_next)
+    {
+        v_count = v_count + scan_count(v_node, p_value);
+    }
+
+    return v_count;
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto unrolled_forward_list<T, Allocator>::contains(const_reference p_value) const noexcept(true) -> bool
+{
+    return (find(p_value) != end());
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto unrolled_forward_list<T, Allocator>::empty() const noexcept(true) -> bool
+{
+    return (m_size == 0ul);
+}
+
+
+//
+template <class T, class Allocator>
+[[nodiscard]] auto unrolled_forward_list<T, Allocator>::size() const noexcept(true)
+    -> typename unrolled_forward_list::size_type
+{
+    return m_size;
+}
+
+
+//
+template <class T, class Allocator>
+auto unrolled_forward_list<T, Allocator>::get_allocator() const noexcept(true)
+    -> typename unrolled_forward_list::allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
+
+//
+template <class T, class Allocator>
+void unrolled_forward_list<T, Allocator>::reserve(size_type p_count) requires(node_pooling<node_allocator_type>)
+{
+    const size_type v_missing = p_count > m_size ? p_count - m_size : 0ul;
+
+    m_alloc.reserve((v_missing + node_capacity - 1ul) / node_capacity);
+}
+
+
+//
+template <class T, class Allocator>
+void unrolled_forward_list<T, Allocator>::shrink_to_fit() noexcept(true) requires(node_pooling<node_allocator_type>)
+{
+    m_alloc.shrink_to_fit();
+}
+
+
+//
+template <class T, class Allocator>
+auto unrolled_forward_list<T, Allocator>::begin() const noexcept(true) -> typename unrolled_forward_list::iterator
+{
+    return m_head ? iterator{m_head, m_head->first()} : end();
+}
+
+
+//
+template <class T, class Allocator>
+auto unrolled_forward_list<T, Allocator>::begin() noexcept(true) -> typename unrolled_forward_list::iterator
+{
+    return m_head ? iterator{m_head, m_head->first()} : end();
+}
+
+
+//
+template <class T, class Allocator>
+auto unrolled_forward_list<T, Allocator>::end() const noexcept(true) -> typename unrolled_forward_list::iterator
+{
+    return iterator{nullptr, 0ul};
+}
+
+
+//
+template <class T, class Allocator>
+auto unrolled_forward_list<T, Allocator>::end() noexcept(true) -> typename unrolled_forward_list::iterator
+{
+    return iterator{nullptr, 0ul};
+}
+
+
+//
+template <class T, class Allocator>
+auto unrolled_forward_list<T, Allocator>::locate(size_type p_pos) const noexcept(true) -> place
+{
+    node_type* v_prev = nullptr;
+    node_type* v_node = m_head;
+
+    while (p_pos >= v_node->m_count)
+    {
+        p_pos  = p_pos - v_node->m_count;
+        v_prev = std::exchange(v_node, v_node->m_next);
+    }
+
+    return place{v_prev, v_node, v_node->first() + p_pos};
+}
+
+
+//
+template <class T, class Allocator>
+auto unrolled_forward_list<T, Allocator>::open_slot(size_type p_pos) noexcept(true) -> T*
+{
+    node_type* v_node = nullptr;
+    size_type  v_cut  = 0ul;    /** the slots in front of the cut move down by one **/
+
+    if (p_pos == 0ul)
+    {
+        if (m_head == nullptr or m_head->m_count == node_capacity)
+        {
+            if ( (v_node = allocate_node<node_type>(m_alloc)) == nullptr ) return nullptr;
+
+            v_node->m_next = m_head;
+            m_head         = v_node;
+        }
+
+        v_node = m_head;
+        v_cut  = m_head->first();
+    }
+    else {
+        const place v_place = locate(p_pos - 1ul);
+
+        v_node = v_place.m_node;
+        v_cut  = v_place.m_slot + 1ul;
+
+        node_type* v_next = v_node->m_next;
+
+        // right behind the last element of a node is the front of the next one
+        if (v_cut == node_capacity and v_next and v_next->m_count < node_capacity)
+        {
+            v_node = v_next;
+            v_cut  = v_next->first();
+        }
+        else if (v_node->m_count == node_capacity)
+        {
+            node_type* v_spare = allocate_node<node_type>(m_alloc);
+
+            if (v_spare == nullptr) return nullptr;
+
+            split(v_node, v_spare);
+
+            // the front half slid back by what the spare took, the back half kept its slots
+            if (v_cut <= v_spare->first()) v_cut = v_cut + v_spare->m_count;
+            else                           v_node = v_spare;
+        }
+    }
+
+    const size_type v_first = v_node->first();
+
+    for (size_type i = v_first; i < v_cut; ++i) relocate(v_node->at(i), v_node->slot(i - 1ul));
+
+    v_node->m_count = v_node->m_count + 1u;
+    m_size          = m_size + 1ul;
+
+    return v_node->slot(v_cut - 1ul);
+}
+
+
+//
+template <class T, class Allocator>
+void unrolled_forward_list<T, Allocator>::close_slot(size_type p_pos) noexcept(true)
+{
+    const place v_place = locate(p_pos);
+
+    node_type* v_node = v_place.m_node;
+
+    for (size_type i = v_place.m_slot; i-- > v_node->first(); ) relocate(v_node->at(i), v_node->slot(i + 1ul));
+
+    v_node->m_count = v_node->m_count - 1u;
+    m_size          = m_size - 1ul;
+
+    if (v_node->m_count == 0u)
+    {
+        (v_place.m_prev ? v_place.m_prev->m_next : m_head) = v_node->m_next;
+
+        v_node = (deallocate_node(m_alloc, v_node), nullptr);
+    }
+}
+
+
+//
+template <class T, class Allocator>
+void unrolled_forward_list<T, Allocator>::split(node_type* p_node, node_type* p_spare) noexcept(true)
+{
+    const size_type v_moved = p_node->m_count / 2ul;
+    const size_type v_kept  = p_node->m_count - v_moved;
+    const size_type v_first = p_node->first();
+
+    for (size_type i = node_capacity - v_moved; i < node_capacity; ++i) relocate(p_node->at(i), p_spare->slot(i));
+
+    for (size_type i = v_first + v_kept; i-- > v_first; ) relocate(p_node->at(i), p_node->slot(i + v_moved));
+
+    p_node->m_count  = static_cast<std::uint32_t>(v_kept);
+    p_spare->m_count = static_cast<std::uint32_t>(v_moved);
+
+    p_spare->m_next = p_node->m_next;
+    p_node->m_next  = p_spare;
+}
+
+
+//
+template <class T, class Allocator>
+void unrolled_forward_list<T, Allocator>::relocate(T* p_from, T* p_to) noexcept(true)
+{
+    Allocator v_alloc(m_alloc);
+
+    alloc_traits::construct(v_alloc, p_to, std::move(*p_from));
+    alloc_traits::destroy(v_alloc, p_from);
+}
+
+
+//
+template <class T, class Allocator>
+auto unrolled_forward_list<T, Allocator>::chunk_hits(const_pointer p_chunk, const_reference p_value) noexcept(true)
+    -> unsigned
+{
+    constexpr size_type v_lanes = 16ul / sizeof(T);
+
+    // a fixed trip count and an integer sum, the shape gcc and clang turn into compare + reduce
+    unsigned v_hits = 0u;
+
+    for (size_type j = 0ul; j < v_lanes; ++j) v_hits += (p_chunk[j] == p_value) ? 1u : 0u;
+
+    return v_hits;
+}
+
+
+//
+template <class T, class Allocator>
+auto unrolled_forward_list<T, Allocator>::scan_find(node_type const* p_node, const_reference p_value) noexcept(true)
+    -> size_type
+{
+    size_type i = p_node->first();
+
+    if constexpr (std::is_arithmetic<T>::value)
+    {
+        constexpr size_type v_lanes = 16ul / sizeof(T);
+
+        static_assert(node_capacity % v_lanes == 0ul);
+
+        T const* v_slots = std::launder(reinterpret_cast<T const*>(p_node->m_storage));
+
+        for (; i % v_lanes != 0ul; ++i)
+        {
+            if (v_slots[i] == p_value) return i;
+        }
+
+        // one vector compare per chunk, branch once on the whole chunk
+        for (; i < node_capacity; i += v_lanes)
+        {
+            if (chunk_hits(v_slots + i, p_value) != 0u) break;
+        }
+    }
+
+    for (; i < node_capacity; ++i)
+    {
+        if (*p_node->at(i) == p_value) return i;
+    }
+
+    return node_capacity;
+}
+
+
+//
+template <class T, class Allocator>
+auto unrolled_forward_list<T, Allocator>::scan_count(node_type const* p_node, const_reference p_value) noexcept(true)
+    -> size_type
+{
+    size_type v_count = 0ul;
+    size_type i       = p_node->first();
+
+    if constexpr (std::is_arithmetic<T>::value)
+    {
+        constexpr size_type v_lanes = 16ul / sizeof(T);
+
+        T const* v_slots = std::launder(reinterpret_cast<T const*>(p_node->m_storage));
+
+        for (; i % v_lanes != 0ul; ++i) v_count = v_count + (v_slots[i] == p_value ? 1ul : 0ul);
+
+        for (; i < node_capacity; i += v_lanes) v_count = v_count + chunk_hits(v_slots + i, p_value);
+
+        return v_count;
+    }
+
+    for (; i < node_capacity; ++i)
+    {
+        if (*p_node->at(i) == p_value) v_count = v_count + 1ul;
+    }
+
+    return v_count;
+}
+
+
+//
+template <class T, class Allocator>
+unrolled_forward_list<T, Allocator>::~unrolled_forward_list() noexcept(std::is_nothrow_destructible<T>::value)
+{
+    while (not empty()) pop_front();
+}
+//
+//
+// end unrolled_forward_list
+
+
+
+//
+//
+template class unrolled_forward_list<int>;
+template class unrolled_forward_list<char>;
+template class unrolled_forward_list<long>;
+template class unrolled_forward_list<short>;
+template class unrolled_forward_list<unsigned int>;
+template class unrolled_forward_list<unsigned char>;
+template class unrolled_forward_list<unsigned long>;
+template class unrolled_forward_list<unsigned short>;
+template class unrolled_forward_list<float>;
+template class unrolled_forward_list<double>;
+template class unrolled_forward_list<std::string>;
+
+//
+template class unrolled_forward_list<int, std::pmr::polymorphic_allocator<int>>;
+template class unrolled_forward_list<char, std::pmr::polymorphic_allocator<char>>;
+template class unrolled_forward_list<long, std::pmr::polymorphic_allocator<long>>;
+template class unrolled_forward_list<short, std::pmr::polymorphic_allocator<short>>;
+template class unrolled_forward_list<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class unrolled_forward_list<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class unrolled_forward_list<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class unrolled_forward_list<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class unrolled_forward_list<float, std::pmr::polymorphic_allocator<float>>;
+template class unrolled_forward_list<double, std::pmr::polymorphic_allocator<double>>;
+
+//
+template class unrolled_forward_list<int, pool_allocator<int>>;
+template class unrolled_forward_list<char, pool_allocator<char>>;
+template class unrolled_forward_list<long, pool_allocator<long>>;
+template class unrolled_forward_list<short, pool_allocator<short>>;
+template class unrolled_forward_list<unsigned int, pool_allocator<unsigned int>>;
+template class unrolled_forward_list<unsigned char, pool_allocator<unsigned char>>;
+template class unrolled_forward_list<unsigned long, pool_allocator<unsigned long>>;
+template class unrolled_forward_list<unsigned short, pool_allocator<unsigned short>>;
+template class unrolled_forward_list<float, pool_allocator<float>>;
+template class unrolled_forward_list<double, pool_allocator<double>>;
+//
+//
@@ -0,0 +1,263 @@
+
+#include <ds/work_stealing_deque.hxx>
+
+
+// start work_stealing_deque
+//
+template <stealable T, class Allocator>
+work_stealing_deque<T, Allocator>::work_stealing_deque(size_type p_capacity, Allocator const& p_alloc) noexcept(true)
+    : m_alloc( p_alloc )
+{
+    m_array.store(make_array(std::bit_ceil(std::max(p_capacity, size_type {2ul}))), std::memory_order_relaxed);
+}
+
+
+//
+template <stealable T, class Allocator>
+auto work_stealing_deque<T, Allocator>::push(T p_value) noexcept(true) -> bool
+{
+    const std::ptrdiff_t v_bottom = m_bottom.load(std::memory_order_relaxed);
+    const std::ptrdiff_t v_top    = m_top.load(std::memory_order_acquire);
+
+    array_type* v_array = m_array.load(std::memory_order_relaxed);
+
+    if ( (v_array == nullptr) || (static_cast<size_type>(v_bottom - v_top) >= v_array->m_capacity) )
+    {
+        v_array = grow(v_array, v_top, v_bottom);
+
+        if (v_array == nullptr) return false;
+    }
+
+    v_array->at(v_bottom).store(p_value, std::memory_order_relaxed);
+
+    // the element is in place before a thief can see the new bottom
+    m_bottom.store(v_bottom + 1, std::memory_order_release);
+
+    return true;
+}
+
+
+//
+template <stealable T, class Allocator>
+auto work_stealing_deque<T, Allocator>::pop() noexcept(true) -> std::optional<typename work_stealing_deque::value_type>
+{
+    const std::ptrdiff_t v_bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+
+    array_type* v_array = m_array.load(std::memory_order_relaxed);
+
+    // claim the bottom first, then look at the top: a thief does it the other way round
+    m_bottom.store(v_bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::ptrdiff_t v_top = m_top.load(std::memory_order_relaxed);
+
+    if (v_top > v_bottom)
+    {
+        m_bottom.store(v_bottom + 1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+    std::optional<value_type> v_value {v_array->at(v_bottom).load(std::memory_order_relaxed)};
+
+    if (v_top == v_bottom)
+    {
+        // last element: race the thieves for it
+        if (not m_top.compare_exchange_strong(v_top, v_top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            v_value.reset();
+        }
+
+        m_bottom.store(v_bottom + 1, std::memory_order_relaxed);
+    }
+
+    return v_value;
+}
+
+
+//
+template <stealable T, class Allocator>
+auto work_stealing_deque<T, Allocator>::steal() noexcept(true) -> std::optional<typename work_stealing_deque::value_type>
+{
+    std::ptrdiff_t v_top = m_top.load(std::memory_order_acquire);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const std::ptrdiff_t v_bottom = m_bottom.load(std::memory_order_acquire);
+
+    if (v_top >= v_bottom) return std::nullopt;
+
+    array_type* v_array = m_array.load(std::memory_order_acquire);
+
+    const value_type v_value = v_array->at(v_top).load(std::memory_order_relaxed);
+
+    if (not m_top.compare_exchange_strong(v_top, v_top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        return std::nullopt;
+    }
+
+    return v_value;
+}
+
+
+//
+template <stealable T, class Allocator>
+[[nodiscard]] auto work_stealing_deque<T, Allocator>::empty() const noexcept(true) -> bool
+{
+    return (size() == 0ul);
+}
+
+
+//
+template <stealable T, class Allocator>
+[[nodiscard]] auto work_stealing_deque<T, Allocator>::size() const noexcept(true)
+    -> typename work_stealing_deque::size_type
+{
+    const std::ptrdiff_t v_top    = m_top.load(std::memory_order_acquire);
+    const std::ptrdiff_t v_bottom = m_bottom.load(std::memory_order_acquire);
+
+    // a pop in flight lowers the bottom below the top for a moment
+    return static_cast<size_type>(std::max(v_bottom - v_top, std::ptrdiff_t {0}));
+}
+
+
+//
+template <stealable T, class Allocator>
+[[nodiscard]] auto work_stealing_deque<T, Allocator>::capacity() const noexcept(true)
+    -> typename work_stealing_deque::size_type
+{
+    array_type* v_array = m_array.load(std::memory_order_acquire);
+
+    return v_array ? v_array->m_capacity : 0ul;
+}
+
+
+//
+template <stealable T, class Allocator>
+auto work_stealing_deque<T, Allocator>::get_allocator() const noexcept(true)
+    -> typename work_stealing_deque::allocator_type
+{
+    return allocator_type(m_alloc);
+}
+
+
+//
+template <stealable T, class Allocator>
+auto work_stealing_deque<T, Allocator>::make_array(size_type p_capacity) noexcept(true) -> array_type*
+{
+    slot_allocator_type v_slot_alloc(m_alloc);
+
+    array_type* v_array = nullptr;
+
+    try {
+        v_array = array_traits::allocate(m_alloc, 1ul);
+    }
+    catch (...) {
+        stats_failed<work_stealing_deque>();
+        return nullptr;
+    }
+
+    array_traits::construct(m_alloc, v_array);
+
+    try {
+        v_array->m_slots = slot_traits::allocate(v_slot_alloc, p_capacity);
+    }
+    catch (...) {
+        array_traits::destroy(m_alloc, v_array);
+        array_traits::deallocate(m_alloc, v_array, 1ul);
+        stats_failed<work_stealing_deque>();
+        return nullptr;
+    }
+
+    for (size_type i = 0ul; i < p_capacity; ++i)
+    {
+        slot_traits::construct(v_slot_alloc, v_array->m_slots + i);
+    }
+
+    v_array->m_capacity = p_capacity;
+
+    stats_allocated<work_stealing_deque>();
+
+    return v_array;
+}
+
+
+//
+template <stealable T, class Allocator>
+auto work_stealing_deque<T, Allocator>::grow(array_type* p_array, std::ptrdiff_t p_top, std::ptrdiff_t p_bottom) noexcept(true)
+    -> array_type*
+{
+    array_type* v_array = make_array(p_array ? (p_array->m_capacity << 1ul) : initial_capacity);
+
+    if (v_array == nullptr) return nullptr;
+
+    if (p_array)
+    {
+        // same indices in the new ring, so thieves holding a top stay valid
+        for (std::ptrdiff_t i = p_top; i < p_bottom; ++i)
+        {
+            v_array->at(i).store(p_array->at(i).load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        v_array->m_prev = p_array;
+    }
+
+    m_array.store(v_array, std::memory_order_release);
+
+    return v_array;
+}
+
+
+//
+template <stealable T, class Allocator>
+work_stealing_deque<T, Allocator>::~work_stealing_deque() noexcept(true)
+{
+    slot_allocator_type v_slot_alloc(m_alloc);
+
+    array_type* v_array = m_array.load(std::memory_order_acquire);
+
+    while (v_array)
+    {
+        array_type* v_prev = v_array->m_prev;
+
+        for (size_type i = 0ul; i < v_array->m_capacity; ++i)
+        {
+            slot_traits::destroy(v_slot_alloc, v_array->m_slots + i);
+        }
+
+        slot_traits::deallocate(v_slot_alloc, v_array->m_slots, v_array->m_capacity);
+
+        array_traits::destroy(m_alloc, v_array);
+        array_traits::deallocate(m_alloc, v_array, 1ul);
+        stats_freed<work_stealing_deque>();
+
+        v_array = v_prev;
+    }
+}
+//
+
+//
+template class work_stealing_deque<int>;
+template class work_stealing_deque<char>;
+template class work_stealing_deque<long>;
+template class work_stealing_deque<short>;
+template class work_stealing_deque<unsigned int>;
+template class work_stealing_deque<unsigned char>;
+template class work_stealing_deque<unsigned long>;
+template class work_stealing_deque<unsigned short>;
+template class work_stealing_deque<float>;
+template class work_stealing_deque<double>;
+template class work_stealing_deque<void*>;
+
+//
+template class work_stealing_deque<int, std::pmr::polymorphic_allocator<int>>;
+template class work_stealing_deque<char, std::pmr::polymorphic_allocator<char>>;
+template class work_stealing_deque<long, std::pmr::polymorphic_allocator<long>>;
+template class work_stealing_deque<short, std::pmr::polymorphic_allocator<short>>;
+template class work_stealing_deque<unsigned int, std::pmr::polymorphic_allocator<unsigned int>>;
+template class work_stealing_deque<unsigned char, std::pmr::polymorphic_allocator<unsigned char>>;
+template class work_stealing_deque<unsigned long, std::pmr::polymorphic_allocator<unsigned long>>;
+template class work_stealing_deque<unsigned short, std::pmr::polymorphic_allocator<unsigned short>>;
+template class work_stealing_deque<float, std::pmr::polymorphic_allocator<float>>;
+template class work_stealing_deque<double, std::pmr::polymorphic_allocator<double>>;
+//
+//